@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025 Arm Limited.
+ * Copyright (c) 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -437,8 +437,19 @@ public:
         Options(TuningMode mode, int32_t compute_units) : opts{detail::as_cenum<AclTuningMode>(mode), compute_units}
         {
         }
+        /** Constructor
+         *
+         * No tuning will be performed and the queue will own a scheduler bound to the given cores
+         *
+         * @param[in] cpu_ids CPU cores the queue is bound to, one worker thread per core
+         */
+        explicit Options(const std::vector<int32_t> &cpu_ids)
+            : opts{AclTuningModeNone, static_cast<int32_t>(cpu_ids.size())}, cpu_ids(cpu_ids)
+        {
+        }
 
-        AclQueueOptions opts;
+        AclQueueOptions      opts;
+        std::vector<int32_t> cpu_ids{}; /**< CPU cores the queue is bound to */
     };
 
 public:
@@ -464,7 +475,17 @@ public:
     explicit Queue(Context &ctx, const Options &options = Options(), StatusCode *status = nullptr)
     {
         AclQueue   queue;
-        const auto st = detail::as_enum<StatusCode>(AclCreateQueue(&queue, ctx.get(), &options.opts));
+        StatusCode st = StatusCode::Success;
+        if (options.cpu_ids.empty())
+        {
+            st = detail::as_enum<StatusCode>(AclCreateQueue(&queue, ctx.get(), &options.opts));
+        }
+        else
+        {
+            const AclQueueCpuSetOptions cpu_set_opts{options.opts, options.cpu_ids.data(),
+                                                     static_cast<int32_t>(options.cpu_ids.size())};
+            st = detail::as_enum<StatusCode>(AclCreateQueueOnCpuSet(&queue, ctx.get(), &cpu_set_opts));
+        }
         reset(queue);
         report_status(st, "[Compute Library] Failed to create queue!");
         if (status)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025 Arm Limited.
+ * Copyright (c) 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -82,6 +82,25 @@ AclStatus AclDestroyContext(AclContext ctx);
  */
 AclStatus AclCreateQueue(AclQueue *queue, AclContext ctx, const AclQueueOptions *options);
 
+/** Create an operator queue bound to a set of CPU cores
+ *
+ * The queue owns a scheduler whose worker threads are pinned to the given cores, so that queues bound to disjoint
+ * sets of cores can run operators concurrently.
+ *
+ * @param[in, out] queue   A valid non-zero queue object is not failures occur
+ * @param[in]      ctx     Context to be used. Must be a CPU context
+ * @param[in]      options Queue options, including the CPU cores, to be used for the operators using the queue
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if the context is not a CPU context
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+AclStatus AclCreateQueueOnCpuSet(AclQueue *queue, AclContext ctx, const AclQueueCpuSetOptions *options);
+
 /** Wait until all elements on the queue have been completed
  *
  * @param[in] queue Queue to wait on completion
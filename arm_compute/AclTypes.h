@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025 Arm Limited.
+ * Copyright (c) 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -162,6 +162,15 @@ typedef struct
     int32_t       compute_units; /**< Compute Units that the queue will deploy */
 } AclQueueOptions;
 
+/**< Options of a queue bound to a set of CPU cores */
+typedef struct
+{
+    AclQueueOptions opts;        /**< Queue options */
+    const int32_t  *cpu_ids;     /**< CPU cores the queue is bound to. The queue owns a scheduler with one worker
+                                      thread pinned to each core */
+    int32_t         num_cpu_ids; /**< Number of entries in cpu_ids */
+} AclQueueCpuSetOptions;
+
 /**< Supported data types */
 typedef enum AclDataType
 {
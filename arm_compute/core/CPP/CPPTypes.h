@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -170,11 +170,34 @@ public:
      * @return the size of the L1 cache
      */
     unsigned int get_L1_cache_size() const;
-    /** Gets the L2 cache size
+    /** Gets the L2 cache size available to each core
      *
-     * @return the size of the L1 cache
+     * @return the size of the L2 cache
      */
     unsigned int get_L2_cache_size() const;
+    /** Gets the size of the last level cache beyond L2 (L3 or system level cache)
+     *
+     * @return the size of the L3 cache, 0 if there is none or it can't be detected
+     */
+    unsigned int get_L3_cache_size() const;
+    /** Gets the number of CPUs sharing the last level cache beyond L2
+     *
+     * @return the number of CPUs sharing the L3 cache, 0 if there is none or it can't be detected
+     */
+    unsigned int get_L3_cache_shared_cpus() const;
+    /** Override the cache sizes used to block the workloads
+     *
+     * @note Only functions configured after the call are affected.
+     *
+     * @warning The sizes are shared by the whole process and read without synchronization by the functions being
+     *          configured. This method is not thread safe: call it before any function is configured concurrently.
+     *
+     * @param[in] L1_size     Size in bytes of the L1 data cache
+     * @param[in] L2_size     Size in bytes of the L2 cache available to each core
+     * @param[in] L3_size     Size in bytes of the cache beyond L2, 0 if there is none
+     * @param[in] L3_num_cpus Number of CPUs sharing the cache beyond L2
+     */
+    void set_cache_sizes(unsigned int L1_size, unsigned int L2_size, unsigned int L3_size, unsigned int L3_num_cpus);
     /** Return the maximum number of CPUs present
      *
      * @return Number of CPUs
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -352,5 +352,17 @@ enum class WeightFormat
     OHWIo64i8      = 0x804000
 };
 
+/** Sparsity pattern of the weights of a matrix multiplication
+ *
+ * Sparse weights are provided dense, with explicit zeros, and are compressed when the weights are prepared so that
+ * the multiplication skips the zero values. The patterns are defined along the K dimension of the weights.
+ */
+enum class WeightsSparsity
+{
+    DENSE,          /**< Dense weights */
+    STRUCTURED_2_4, /**< At most 2 non-zero values in each group of 4 values along K, checked on compression */
+    BLOCK_4X4       /**< Blocks of 4 values along K by 4 outputs that are all zero are skipped */
+};
+
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_CORE_CORETYPES_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1681,7 +1681,8 @@ public:
           _kernel_height(0),
           _num_kernels(0),
           _retain_internal_weights(false),
-          _weight_format(arm_compute::WeightFormat::UNSPECIFIED)
+          _weight_format(arm_compute::WeightFormat::UNSPECIFIED),
+          _weights_sparsity(WeightsSparsity::DENSE)
     {
     }
     /** Constructor
@@ -1692,19 +1693,22 @@ public:
      * @param[in] num_kernels             Number of convolution kernels.
      * @param[in] retain_internal_weights (Optional) True if internal reshaped weights must be retained. Used for reconfiguration purposes. Default is false.
      * @param[in] weight_format           (Optional) arm_gemm:WeightFormat enumeration requested by the user. Default is arm_compute::WeightFormat::UNSPECIFIED.
+     * @param[in] weights_sparsity        (Optional) Sparsity pattern of the weights. Default is @ref WeightsSparsity::DENSE.
      */
     WeightsInfo(bool                      are_reshaped,
                 unsigned int              kernel_width,
                 unsigned int              kernel_height,
                 unsigned int              num_kernels,
                 bool                      retain_internal_weights = false,
-                arm_compute::WeightFormat weight_format           = arm_compute::WeightFormat::UNSPECIFIED)
+                arm_compute::WeightFormat weight_format           = arm_compute::WeightFormat::UNSPECIFIED,
+                WeightsSparsity           weights_sparsity        = WeightsSparsity::DENSE)
         : _are_reshaped(are_reshaped),
           _kernel_width(kernel_width),
           _kernel_height(kernel_height),
           _num_kernels(num_kernels),
           _retain_internal_weights(retain_internal_weights),
-          _weight_format(weight_format)
+          _weight_format(weight_format),
+          _weights_sparsity(weights_sparsity)
     {
     }
     /** Flag which specifies if the weights tensor has been reshaped.
@@ -1743,6 +1747,14 @@ public:
     {
         _weight_format = weight_format;
     }
+    WeightsSparsity weights_sparsity() const
+    {
+        return _weights_sparsity;
+    }
+    void set_weights_sparsity(WeightsSparsity weights_sparsity)
+    {
+        _weights_sparsity = weights_sparsity;
+    }
 
     unsigned int kernel_width() const
     {
@@ -1760,6 +1772,7 @@ private:
     unsigned int              _num_kernels;
     bool                      _retain_internal_weights;
     arm_compute::WeightFormat _weight_format;
+    WeightsSparsity           _weights_sparsity;
 };
 
 /** GEMM reshape information class. This class stores the necessary information about matrix A and matrix B reshape.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 
 #include "arm_compute/core/CoreTypes.h"
 #include "arm_compute/function_info/ActivationLayerInfo.h"
+#include "arm_compute/function_info/GEMMInfo.h"
 
 namespace arm_compute
 {
@@ -46,6 +47,8 @@ struct FullyConnectedLayerInfo
     bool       enable_fast_math{false};                  /**<  Enable fast math computation. */
     /* Other parameters */
     bool fp_mixed_precision{false}; /**<  Use wider accumulators (32 bit instead of 16 for FP16) to improve accuracy. */
+    /* Information about block-quantized 4-bit weights */
+    Int4WeightsInfo int4_weights_info{}; /**<  Layout of the 4-bit weights. Disabled by default. */
 
     /** Sets the weights trained data layout
      *
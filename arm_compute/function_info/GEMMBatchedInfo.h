@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_GEMMBATCHEDINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_GEMMBATCHEDINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <cstddef>
+
+namespace arm_compute
+{
+/** Description of one of the independent matrix products of a batched GEMM
+ *
+ * The problem computes D = A * B (+ bias) where A is a MxK matrix, B a KxN matrix and D a MxN matrix. The matrices
+ * are views into the tensors passed to the batched GEMM, which are addressed as flat buffers: offsets and strides are
+ * expressed in elements from the first element of each tensor.
+ *
+ * The values of a row of A and of a row of D must be contiguous. B can have any strides, as it is packed before the
+ * multiplication. Problems with the same view of B share their packed weights.
+ */
+struct GEMMBatchedProblem
+{
+    /** Default constructor */
+    GEMMBatchedProblem() = default;
+    /** Constructor for matrices stored contiguously, each row of a matrix directly following the previous one
+     *
+     * @param[in] m        Number of rows of A and D
+     * @param[in] n        Number of columns of B and D
+     * @param[in] k        Number of columns of A and rows of B
+     * @param[in] a_offset Offset of the first element of A
+     * @param[in] b_offset Offset of the first element of B
+     * @param[in] d_offset Offset of the first element of D
+     * @param[in] bias_offset (Optional) Offset of the first element of the bias
+     */
+    GEMMBatchedProblem(unsigned int m,
+                       unsigned int n,
+                       unsigned int k,
+                       size_t       a_offset,
+                       size_t       b_offset,
+                       size_t       d_offset,
+                       size_t       bias_offset = 0)
+        : m(m),
+          n(n),
+          k(k),
+          a_offset(a_offset),
+          lda(k),
+          b_offset(b_offset),
+          b_stride_k(n),
+          b_stride_n(1),
+          bias_offset(bias_offset),
+          d_offset(d_offset),
+          ldd(n)
+    {
+    }
+
+    unsigned int m{0};           /**< Number of rows of A and D */
+    unsigned int n{0};           /**< Number of columns of B and D */
+    unsigned int k{0};           /**< Number of columns of A and rows of B */
+    size_t       a_offset{0};    /**< Offset of the first element of A */
+    size_t       lda{0};         /**< Distance between two consecutive rows of A */
+    size_t       b_offset{0};    /**< Offset of the first element of B */
+    size_t       b_stride_k{0};  /**< Distance between two consecutive rows of B */
+    size_t       b_stride_n{1};  /**< Distance between two consecutive columns of B */
+    size_t       bias_offset{0}; /**< Offset of the first element of the bias. Only used if a bias is provided */
+    size_t       d_offset{0};    /**< Offset of the first element of D */
+    size_t       ldd{0};         /**< Distance between two consecutive rows of D */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_GEMMBATCHEDINFO_H
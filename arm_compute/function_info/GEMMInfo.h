@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,6 +80,64 @@ struct GEMMLowpOutputStageInfo
         return !(*this == rhs);
     }
 };
+/** Block-quantized signed 4-bit weights descriptor
+ *
+ * The weights are stored in a @ref DataType::U8 tensor of shape [row_size(K), N] where each row holds the K values
+ * of one output column, split in groups of @ref group_size values. Each group is stored as a block made of:
+ * -# The scale of the group, stored with @ref scale_data_type (F32 or F16)
+ * -# The zero point of the group, stored as a signed 8-bit integer, only if @ref has_zero_points is set
+ * -# group_size / 2 bytes of signed 4-bit values, two per byte, the value with the lower index in the low nibble
+ *
+ * If K is not a multiple of @ref group_size, the last group of each row is padded to the full block size.
+ * A weight is dequantized as (value - zero_point) * scale.
+ */
+struct Int4WeightsInfo
+{
+    /** Default constructor. Block-quantized 4-bit weights are disabled. */
+    Int4WeightsInfo() = default;
+    /** Constructor
+     *
+     * @param[in] group_size      Number of values sharing the same scale and zero point. Must be a multiple of 32
+     * @param[in] scale_data_type (Optional) Data type of the scales. Supported: F32/F16
+     * @param[in] has_zero_points (Optional) True if each group stores a zero point after its scale
+     */
+    Int4WeightsInfo(unsigned int group_size, DataType scale_data_type = DataType::F32, bool has_zero_points = false)
+        : group_size(group_size), scale_data_type(scale_data_type), has_zero_points(has_zero_points)
+    {
+    }
+    /** Check if the weights are block-quantized 4-bit values
+     *
+     * @return True if a group size has been set
+     */
+    bool enabled() const
+    {
+        return group_size != 0;
+    }
+    /** Size in bytes of the block storing one group
+     *
+     * @return The size of a block in bytes
+     */
+    size_t block_size() const
+    {
+        const size_t scale_size = (scale_data_type == DataType::F16) ? 2 : 4;
+        return scale_size + (has_zero_points ? 1 : 0) + group_size / 2;
+    }
+    /** Size in bytes of the row storing the weights of one output column
+     *
+     * @param[in] k Number of values in a row
+     *
+     * @return The size of a row in bytes
+     */
+    size_t row_size(size_t k) const
+    {
+        return ((k + group_size - 1) / group_size) * block_size();
+    }
+
+    unsigned int group_size{0};                  /**< Number of values per group. 0 if disabled */
+    DataType     scale_data_type{DataType::F32}; /**< Data type of the scales */
+    bool         has_zero_points{false};         /**< True if each group has a zero point */
+};
+
 /** GEMM information class. This class stores the necessary information to compute GEMM functions
  *
  * This object also contains the information about how matrix A and matrix B have been reshaped
@@ -106,7 +164,9 @@ public:
           _fixed_format(false),
           _weight_format(arm_compute::WeightFormat::UNSPECIFIED),
           _accumulate(false),
-          _use_fp32_acc(false)
+          _use_fp32_acc(false),
+          _int4_weights_info(),
+          _weights_sparsity(WeightsSparsity::DENSE)
     {
     }
     /** Constructor
@@ -162,7 +222,9 @@ public:
           _fixed_format(fixed_format),
           _weight_format(weight_format),
           _accumulate(accumulate),
-          _use_fp32_acc(use_fp32_acc)
+          _use_fp32_acc(use_fp32_acc),
+          _int4_weights_info(),
+          _weights_sparsity(WeightsSparsity::DENSE)
     {
     }
     /** Flag which specifies if the matrix A has been reshaped
@@ -378,6 +440,43 @@ public:
     {
         _use_fp32_acc = use_fp32_acc;
     }
+    /** Block-quantized 4-bit weights descriptor of matrix B
+     *
+     * @return The @ref Int4WeightsInfo of matrix B. Disabled if matrix B is not made of 4-bit values
+     */
+    const Int4WeightsInfo &int4_weights_info() const
+    {
+        return _int4_weights_info;
+    }
+    /** Set the block-quantized 4-bit weights descriptor of matrix B
+     *
+     * @note When enabled, matrix B is stored as described by @ref Int4WeightsInfo, with one row per column of the output
+     *
+     * @param[in] int4_weights_info @ref Int4WeightsInfo object to set
+     */
+    void set_int4_weights_info(const Int4WeightsInfo &int4_weights_info)
+    {
+        _int4_weights_info = int4_weights_info;
+    }
+    /** Sparsity pattern of matrix B
+     *
+     * @return The @ref WeightsSparsity of matrix B
+     */
+    WeightsSparsity weights_sparsity() const
+    {
+        return _weights_sparsity;
+    }
+    /** Set the sparsity pattern of matrix B
+     *
+     * @note Matrix B is still provided dense. It is compressed when the weights are prepared, so matrix B
+     *       is expected to be constant.
+     *
+     * @param[in] weights_sparsity @ref WeightsSparsity to set
+     */
+    void set_weights_sparsity(WeightsSparsity weights_sparsity)
+    {
+        _weights_sparsity = weights_sparsity;
+    }
 
 private:
     bool                      _is_a_reshaped;
@@ -397,6 +496,8 @@ private:
     arm_compute::WeightFormat _weight_format;
     bool                      _accumulate;
     bool                      _use_fp32_acc;
+    Int4WeightsInfo           _int4_weights_info;
+    WeightsSparsity           _weights_sparsity;
 };
 } //namespace arm_compute
 #endif // ACL_ARM_COMPUTE_FUNCTION_INFO_GEMMINFO_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,7 @@
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/INodeVisitor.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/MemoryFootprint.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/TensorDescriptor.h"
 #include "arm_compute/graph/TypePrinter.h"
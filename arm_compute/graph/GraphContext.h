@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,6 +39,9 @@ namespace arm_compute
 {
 namespace graph
 {
+// Forward declarations
+class MemoryFootprintRecorder;
+
 /** Contains structs required for memory management */
 struct MemoryManagerContext
 {
@@ -124,13 +127,28 @@ public:
      * @return Weights manager contexts
      */
     std::map<Target, WeightsManagerContext> &weights_managers();
-    /** Finalizes memory managers in graph context */
-    void finalize();
+    /** Sets the recorder of the memory of the functions of the nodes
+     *
+     * @param[in] recorder Memory footprint recorder
+     */
+    void set_memory_footprint_recorder(std::shared_ptr<MemoryFootprintRecorder> recorder);
+    /** Gets the recorder of the memory of the functions of the nodes
+     *
+     * @return The memory footprint recorder if the graph is finalized, else nullptr
+     */
+    MemoryFootprintRecorder *memory_footprint_recorder();
+    /** Finalizes memory managers in graph context
+     *
+     * @param[in] num_concurrent_tasks (Optional) Maximum number of tasks executed concurrently. Each one needs its own
+     *                                 pool for the auxiliary memory of its function.
+     */
+    void finalize(unsigned int num_concurrent_tasks = 1);
 
 private:
-    GraphConfig                             _config;           /**< Graph configuration */
-    std::map<Target, MemoryManagerContext>  _memory_managers;  /**< Memory managers for each target */
-    std::map<Target, WeightsManagerContext> _weights_managers; /**< Weights managers for each target */
+    GraphConfig                              _config;                    /**< Graph configuration */
+    std::map<Target, MemoryManagerContext>   _memory_managers;           /**< Memory managers for each target */
+    std::map<Target, WeightsManagerContext>  _weights_managers;          /**< Weights managers for each target */
+    std::shared_ptr<MemoryFootprintRecorder> _memory_footprint_recorder; /**< Memory recorded for the nodes */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -76,6 +76,17 @@ public:
      * @param[in] graph Graph to execute
      */
     void execute_graph(Graph &graph);
+    /** Executes a graph on the first samples of its batch
+     *
+     * The smallest batch configured with GraphConfig::dynamic_batch holding @p batch_size samples is run, only the
+     * first @p batch_size samples of the outputs are meaningful.
+     *
+     * @note An error is raised if @p batch_size is 0 or larger than the batch size of the graph inputs.
+     *
+     * @param[in] graph      Graph to execute
+     * @param[in] batch_size Number of samples to run, at most the batch size of the graph inputs
+     */
+    void execute_graph(Graph &graph, unsigned int batch_size);
     /** Invalidates the graph execution workload
      *
      * @param[in] graph Graph to invalidate
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
  * @publicapi
  */
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
 
 #include <memory>
@@ -57,6 +58,20 @@ public:
     {
         return true;
     }
+    /** Returns memory the tensor can use as is, instead of being allocated and then accessed
+     *
+     * @note Only called for the tensors of constant nodes, before they are allocated
+     *
+     * @param[in] info Metadata of the tensor
+     *
+     * @return Memory holding the tensor data with the padding of @p info, which must outlive the accessor.
+     *         nullptr if the tensor must be allocated and accessed
+     */
+    virtual void *memory_to_import(const ITensorInfo &info)
+    {
+        ARM_COMPUTE_UNUSED(info);
+        return nullptr;
+    }
 };
 
 using ITensorAccessorUPtr = std::unique_ptr<ITensorAccessor>;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -46,6 +46,17 @@ public:
     virtual ~ITensorHandle() = default;
     /** Allocates backend memory for the handle */
     virtual void allocate() = 0;
+    /** Uses external memory as backend memory of the handle, instead of allocating it
+     *
+     * @param[in] memory Memory holding the tensor data, with the padding of the tensor. Must outlive the handle
+     *
+     * @return True if the memory has been imported, false if the backend doesn't support importing it
+     */
+    virtual bool import_memory(void *memory)
+    {
+        ARM_COMPUTE_UNUSED(memory);
+        return false;
+    }
     /** Allocates backend memory for the handle */
     virtual void free() = 0;
     /** Set backend tensor to be managed by a memory group
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MEMORYFOOTPRINT_H
+#define ACL_ARM_COMPUTE_GRAPH_MEMORYFOOTPRINT_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/IAllocator.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class TrackingAllocator;
+
+namespace graph
+{
+// Forward declarations
+class Graph;
+class GraphContext;
+class INode;
+
+/** Memory held by a node or a graph, by category, in bytes */
+struct MemoryFootprint
+{
+    size_t activations{0};         /**< Output tensors of the nodes which aren't constant, without padding */
+    size_t weights{0};             /**< Output tensors of the constant nodes still allocated, without padding */
+    size_t padding{0};             /**< Padding of the allocated output tensors */
+    size_t workspace{0};           /**< Temporary tensors of the functions, backed by the function memory managers */
+    size_t transformed_weights{0}; /**< Tensors held by the functions outside of the memory managers (CPU) */
+
+    /** Total of all the categories
+     *
+     * @return The number of bytes held
+     */
+    size_t total() const;
+    /** Accumulate another footprint
+     *
+     * @param[in] other Footprint to add
+     *
+     * @return This footprint
+     */
+    MemoryFootprint &operator+=(const MemoryFootprint &other);
+};
+
+/** Memory held by a node */
+struct NodeMemoryFootprint
+{
+    NodeID          id{EmptyNodeID};       /**< Node ID */
+    NodeType        type{NodeType::Dummy}; /**< Node type */
+    std::string     name{};                /**< Node name */
+    MemoryFootprint footprint{};           /**< Memory held by the node */
+};
+
+/** Memory held by a finalized graph
+ *
+ * The activations and workspaces of the nodes are requirements: when they are memory managed, they share the memory
+ * of the pools of the memory managers.
+ */
+struct GraphMemoryFootprint
+{
+    std::vector<NodeMemoryFootprint> nodes{};             /**< Footprints of the nodes */
+    MemoryFootprint                  total{};             /**< Sum of the footprints of the nodes */
+    size_t                           transition_pools{0}; /**< Memory of the pools shared by the managed activations */
+    size_t                           function_pools{0};   /**< Memory of the pools shared by the workspaces */
+};
+
+/** Records the memory of the functions of a graph while they are configured and prepared
+ *
+ * The workspace of a node is the growth of the objects managed by the function memory managers while its function is
+ * configured. Its transformed weights are the tensors allocated through @ref allocator while its function is
+ * configured or prepared, and which aren't freed yet.
+ */
+class MemoryFootprintRecorder final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] allocator (Optional) Allocator of the tensors which aren't memory managed, nullptr for the default one
+     */
+    explicit MemoryFootprintRecorder(IAllocator *allocator = nullptr);
+    /** Destructor */
+    ~MemoryFootprintRecorder();
+    /** Allocator to set as allocator of the thread configuring and preparing the functions
+     *
+     * @return The tracking allocator
+     */
+    IAllocator *allocator();
+    /** Start accounting the memory to a node
+     *
+     * @param[in] node Node whose function is about to be configured or prepared
+     * @param[in] ctx  Graph context holding the memory managers
+     */
+    void begin_node(const INode &node, GraphContext &ctx);
+    /** Stop accounting the memory to the node
+     *
+     * @param[in] ctx Graph context holding the memory managers
+     */
+    void end_node(GraphContext &ctx);
+    /** Workspace of the function of a node
+     *
+     * @param[in] nid Node ID
+     *
+     * @return The size of the objects managed by the function memory managers for the node
+     */
+    size_t workspace(NodeID nid) const;
+    /** Transformed weights of the function of a node
+     *
+     * @param[in] nid Node ID
+     *
+     * @return The size of the tensors allocated for the node and still held
+     */
+    size_t transformed_weights(NodeID nid) const;
+
+private:
+    std::unique_ptr<TrackingAllocator> _tracker;      /**< Allocator tracking the memory of each node */
+    std::map<NodeID, size_t>           _workspaces;   /**< Workspace of each node */
+    NodeID                             _node;         /**< Node the memory is accounted to */
+    size_t                             _managed_size; /**< Size managed by the function memory managers at begin_node */
+};
+
+/** Compute the memory held by a finalized graph
+ *
+ * @param[in] g   Graph
+ * @param[in] ctx Context the graph was finalized with
+ *
+ * @return The memory footprint of each node and of the graph
+ */
+GraphMemoryFootprint memory_footprint(const Graph &g, GraphContext &ctx);
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MEMORYFOOTPRINT_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -102,6 +102,15 @@ struct GraphConfig
     std::string   tuner_file{"acl_tuner.csv"};         /**< File to load/store tuning values from */
     std::string   mlgo_file{"heuristics.mlgo"};        /**< Filename to load MLGO heuristics from */
     CLBackendType backend_type{CLBackendType::Native}; /**< CL backend type to use */
+    unsigned int  max_concurrent_branches{1};          /**< Max number of independent branches run concurrently (CPU) */
+    int           numa_node{-1};                       /**< NUMA node to bind CPU threads and memory to (-1: none) */
+    bool          use_interval_memory_planner{false};  /**< Plan memory from the lifetime intervals of tensors (CPU) */
+    std::string   prepared_weights_cache{};            /**< Prepared weights cache directory (CPU), empty: unchanged */
+    bool          use_huge_pages{false};               /**< Back CPU tensors with recycled huge pages */
+    bool          consume_weights{false};              /**< Free the original weights once prepared (CPU) */
+    bool          dynamic_batch{false};                /**< Configure the graph for smaller batches too (CPU) */
+    std::string   cpu_tuner_file{"acl_cpu_tuner.csv"}; /**< File to load/store the GEMM kernels tuning from (CPU) */
+    bool          record_memory_footprint{false};      /**< Record the workspace and transformed weights of each node */
 };
 
 /**< Device target types */
@@ -209,8 +218,9 @@ enum class NodeType
 /** Backend Memory Manager affinity **/
 enum class MemoryManagerAffinity
 {
-    Buffer, /**< Affinity at buffer level */
-    Offset  /**< Affinity at offset level */
+    Buffer,  /**< Affinity at buffer level */
+    Offset,  /**< Affinity at offset level */
+    Interval /**< Affinity at offset level, offsets planned from the lifetime intervals of the objects */
 };
 
 /** NodeID-index struct
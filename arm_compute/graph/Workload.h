@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "arm_compute/runtime/IMemoryGroup.h"
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -45,6 +46,10 @@ namespace graph
 class ITensorHandle;
 class INode;
 class Graph;
+namespace detail
+{
+class BranchExecutor;
+} // namespace detail
 
 struct ExecutionTask;
 
@@ -97,14 +102,27 @@ struct ExecutionTask
     void prepare();
 };
 
+/** Tasks running a workload on the first samples of its batch */
+struct BatchWorkload
+{
+    std::vector<std::unique_ptr<ITensorHandle>> handles = {}; /**< Views of the batched tensors */
+    std::vector<ExecutionTask>                  tasks   = {}; /**< Tasks configured on the views */
+    std::vector<unsigned int>                   stages  = {}; /**< Number of independent tasks per stage */
+};
+
 /** Execution workload */
 struct ExecutionWorkload
 {
-    std::vector<Tensor *>      inputs  = {};        /**< Input handles */
-    std::vector<Tensor *>      outputs = {};        /**< Output handles */
-    std::vector<ExecutionTask> tasks   = {};        /**< Execution workload */
-    Graph                     *graph   = {nullptr}; /**< Graph bound to the workload */
-    GraphContext              *ctx     = {nullptr}; /**< Graph execution context */
+    std::vector<Tensor *>                   inputs          = {};        /**< Input handles */
+    std::vector<Tensor *>                   outputs         = {};        /**< Output handles */
+    std::vector<ExecutionTask>              tasks           = {};        /**< Execution workload */
+    Graph                                  *graph           = {nullptr}; /**< Graph bound to the workload */
+    GraphContext                           *ctx             = {nullptr}; /**< Graph execution context */
+    std::vector<unsigned int>               stages          = {};        /**< Number of independent tasks per stage */
+    std::shared_ptr<detail::BranchExecutor> branch_executor = {nullptr}; /**< Executor of independent tasks */
+    std::map<unsigned int, BatchWorkload>   batch_workloads = {};        /**< Smaller batch workloads, per batch size */
+    unsigned int                            max_batch_size  = {0};       /**< Batch size the tasks are configured for */
+    unsigned int                            batch_size      = {0};       /**< Batch size to run (0: max_batch_size) */
 };
 } // namespace graph
 } // namespace arm_compute
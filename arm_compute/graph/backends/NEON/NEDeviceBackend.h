@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,12 @@
 
 #include "arm_compute/graph/IDeviceBackend.h"
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/HugePageAllocator.h"
+#include "arm_compute/runtime/NumaAllocator.h"
+
+#include <map>
+#include <memory>
+#include <utility>
 
 namespace arm_compute
 {
@@ -59,7 +65,12 @@ public:
     void                                          sync() override;
 
 private:
-    Allocator _allocator; /**< Backend allocator */
+    /** Key of the NUMA allocators: node and whether huge pages are requested */
+    using NumaAllocatorKey = std::pair<int, bool>;
+
+    Allocator                                                  _allocator;             /**< Backend allocator */
+    std::map<NumaAllocatorKey, std::unique_ptr<NumaAllocator>> _numa_allocators{};     /**< NUMA allocators in use */
+    std::unique_ptr<HugePageAllocator>                         _huge_page_allocator{}; /**< Huge page allocator */
 };
 } // namespace backends
 } // namespace graph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -55,6 +55,7 @@ public:
 
     // Inherited overridden methods
     void                        allocate() override;
+    bool                        import_memory(void *memory) override;
     void                        free() override;
     void                        manage(IMemoryGroup *mg) override;
     void                        map(bool blocking) override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -63,6 +63,13 @@ void allocate_all_input_tensors(INode &node);
  * @param[in] node Node to allocate the output tensor of
  */
 void allocate_all_output_tensors(INode &node);
+/** Imports or allocates all output tensors of a constant node.
+ *
+ * The memory provided by the accessor of a tensor, if any, is imported. Otherwise the tensor is allocated.
+ *
+ * @param[in] node Node to import or allocate the output tensor of
+ */
+void import_or_allocate_all_output_tensors(INode &node);
 /** Allocates const tensor of a given graph
  *
  * @param[in] g Graph to allocate the tensors
@@ -82,6 +89,35 @@ void allocate_all_tensors(Graph &g);
  * @return The execution workload
  */
 ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order);
+/** Group the tasks of a workload in stages of independent tasks that can be executed concurrently
+ *
+ * Tasks are reordered by stage, each task being placed one stage after the latest task it depends on.
+ *
+ * @note Does nothing if @p max_concurrent_branches is lower than 2 or if the graph has no independent tasks
+ *
+ * @param[in]     g                       Graph the workload was created from
+ * @param[in,out] workload                Workload to configure
+ * @param[in]     max_concurrent_branches Maximum number of tasks to execute concurrently
+ */
+void configure_execution_stages(Graph &g, ExecutionWorkload &workload, unsigned int max_concurrent_branches);
+/** Configure the nodes of a graph again for every power of two batch size below the one of its inputs
+ *
+ * The tasks of a smaller batch read and write views of the first samples of the batched tensors, the constant
+ * tensors being shared with the workload.
+ *
+ * @note No smaller batch is configured if a node moves data across the samples of the batch
+ * @note The stages of the smaller batches are only set if @ref configure_execution_stages created a branch executor,
+ *       so it must be called first
+ *
+ * @param[in]     g          Graph the workload was created from
+ * @param[in]     ctx        Graph context to use
+ * @param[in,out] workload   Workload to configure
+ * @param[in]     node_order The order to configure the nodes
+ */
+void configure_batch_workloads(Graph                     &g,
+                               GraphContext              &ctx,
+                               ExecutionWorkload         &workload,
+                               const std::vector<NodeID> &node_order);
 /** Release the memory of all unused const nodes
  *
  * @param[in] g Graph to release the memory from
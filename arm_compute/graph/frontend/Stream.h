@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,6 +66,16 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+    /** Executes the stream on the first samples of its batch
+     *
+     * @param[in] batch_size Number of samples to run, see @ref GraphManager::execute_graph
+     */
+    void run(unsigned int batch_size);
+    /** Graph context of the stream
+     *
+     * @return The graph context, which holds the backend resources once the stream is finalized
+     */
+    GraphContext &context();
 
     // Inherited overridden methods
     void         add_layer(ILayer &layer) override;
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_AFFINITYPOOLMANAGER_H
+#define ACL_ARM_COMPUTE_RUNTIME_AFFINITYPOOLMANAGER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IMemoryPool.h"
+#include "arm_compute/runtime/IPoolManager.h"
+
+#include "support/Mutex.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+/** Lock-free memory pool manager with thread affinity
+ *
+ * Pools are claimed and returned with atomic operations only, and a thread locking a pool gets back the pool it
+ * used last time if it is free. A thread running the same workload over and over, such as a request thread executing
+ * a graph, therefore keeps working on the same pool without any mutex or semaphore hand-off.
+ *
+ * A thread finding all the pools occupied blocks until one is unlocked, like with @ref PoolManager.
+ *
+ * @note Pools must be registered, released and cleared while none of them is locked.
+ */
+class AffinityPoolManager : public IPoolManager
+{
+public:
+    /** Default Constructor */
+    AffinityPoolManager() = default;
+    /** Prevent instances of this class to be copy constructed */
+    AffinityPoolManager(const AffinityPoolManager &) = delete;
+    /** Prevent instances of this class to be copied */
+    AffinityPoolManager &operator=(const AffinityPoolManager &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    AffinityPoolManager(AffinityPoolManager &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    AffinityPoolManager &operator=(AffinityPoolManager &&) = delete;
+
+    // Inherited methods overridden:
+    IMemoryPool                 *lock_pool() override;
+    void                         unlock_pool(IMemoryPool *pool) override;
+    void                         register_pool(std::unique_ptr<IMemoryPool> pool) override;
+    std::unique_ptr<IMemoryPool> release_pool() override;
+    void                         clear_pools() override;
+    size_t                       num_pools() const override;
+
+private:
+    /** Managed pool and its state */
+    struct Slot
+    {
+        std::unique_ptr<IMemoryPool> pool{nullptr};  /**< Managed pool */
+        std::atomic<bool>            occupied{false}; /**< True while the pool is locked */
+        std::atomic<uintptr_t>       owner{0};        /**< Token of the thread which locked the pool last */
+    };
+    /** Try to lock a free pool, the one used last by the calling thread first
+     *
+     * @return The locked pool, nullptr if all the pools are occupied
+     */
+    IMemoryPool *try_lock_pool();
+
+    std::vector<std::unique_ptr<Slot>> _slots{};       /**< Managed pools */
+    std::atomic<unsigned int>          _num_waiters{0}; /**< Number of threads blocked in lock_pool() */
+    arm_compute::Mutex                 _mtx{};          /**< Mutex used by the blocked threads only */
+#ifndef NO_MULTI_THREADING
+    std::condition_variable _cv{}; /**< Condition variable to wake up the blocked threads */
+#endif /* NO_MULTI_THREADING */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_AFFINITYPOOLMANAGER_H
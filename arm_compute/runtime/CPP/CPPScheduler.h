@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,24 +28,62 @@
  * @publicapi
  */
 
+#include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/runtime/IScheduler.h"
 
+#include <cstdint>
 #include <memory>
 
 namespace arm_compute
 {
 /** C++11 implementation of a pool of threads to automatically split a kernel's execution among several threads.
  *
- * It has 2 scheduling modes: Linear or Fanout (please refer to the implementation for details)
- * The mode is selected automatically based on the runtime environment. However it can be forced via an environment
- * variable ARM_COMPUTE_CPP_SCHEDULER_MODE. e.g.:
+ * It has 3 scheduling modes: Linear, Fanout or Steal (please refer to the implementation for details)
+ * The mode is selected automatically between Linear and Fanout based on the runtime environment. However it can be
+ * forced via @ref CPPScheduler::set_scheduling_mode or an environment variable ARM_COMPUTE_CPP_SCHEDULER_MODE. e.g.:
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=linear      # Force select the linear scheduling mode
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=fanout      # Force select the fanout scheduling mode
+ * ARM_COMPUTE_CPP_SCHEDULER_MODE=steal       # Force select the work-stealing scheduling mode
+ *
+ * Independently of the mode, the threads can be kept "hot" between jobs: after each job they busy-wait for a bounded
+ * time before going to sleep, which removes the wake-up latency of back-to-back kernels. This is disabled by default
+ * and can be enabled via @ref CPPScheduler::set_spin_wait or the environment variable
+ * ARM_COMPUTE_CPP_SCHEDULER_SPIN_US. e.g.:
+ * ARM_COMPUTE_CPP_SCHEDULER_SPIN_US=200      # Busy-wait up to 200us for new work before sleeping
+ *
+ * When the threads are pinned to cores of different types (e.g. big.LITTLE) through
+ * @ref CPPScheduler::set_num_threads_with_affinity, statically split windows are sized according to the capacity of
+ * the core running them. The capacities come from a calibration table per @ref CPUModel and can be overridden with
+ * measured values via @ref CPPScheduler::set_core_capacity.
 */
 class CPPScheduler final : public IScheduler
 {
 public:
+    /** Scheduling modes available to dispatch the workloads to the threads */
+    enum class SchedulingMode
+    {
+        Auto,   /**< Select between Linear and Fanout based on the number of threads */
+        Linear, /**< Main thread wakes all the threads, workloads are pulled from a shared counter */
+        Fanout, /**< Threads wake each other up, workloads are pulled from a shared counter */
+        Steal,  /**< Each thread owns a deque of workloads and steals from its peers once it is empty */
+    };
+
+    /** Busy-wait configuration of the thread pool */
+    struct SpinWaitConfig
+    {
+        unsigned int spin_duration_us{0}; /**< Time in us a thread polls for work before sleeping, 0 disables it */
+        unsigned int max_backoff{64};     /**< Maximum number of relax iterations between two polls */
+    };
+
+    /** Statistics on the time taken to dispatch the workloads to the worker threads */
+    struct DispatchStats
+    {
+        uint64_t num_dispatches{0};   /**< Number of multi-threaded dispatches measured */
+        uint64_t total_latency_ns{0}; /**< Accumulated time until the last worker thread picked up its job */
+        uint64_t max_latency_ns{0};   /**< Highest dispatch latency measured */
+    };
+
     /** Constructor: create a pool of threads. */
     CPPScheduler();
     /** Default destructor */
@@ -58,6 +96,54 @@ public:
      */
     static CPPScheduler &get();
 
+    /** Force the scheduling mode used to dispatch the workloads
+     *
+     * @note This overrides the mode selected through ARM_COMPUTE_CPP_SCHEDULER_MODE
+     *
+     * @param[in] mode Scheduling mode to use. @ref SchedulingMode::Auto restores the automatic selection.
+     */
+    void set_scheduling_mode(SchedulingMode mode);
+
+    /** Set the busy-wait configuration of the thread pool
+     *
+     * @note This overrides the value set through ARM_COMPUTE_CPP_SCHEDULER_SPIN_US
+     *
+     * @param[in] config Busy-wait configuration to use
+     */
+    void set_spin_wait(const SpinWaitConfig &config);
+    /** Get the busy-wait configuration of the thread pool
+     *
+     * @return The busy-wait configuration
+     */
+    SpinWaitConfig spin_wait_config() const;
+
+    /** Enable or disable the collection of dispatch statistics
+     *
+     * @param[in] enable True to measure the dispatch latency of each multi-threaded run
+     */
+    void set_dispatch_stats_enabled(bool enable);
+    /** Get the dispatch statistics collected since the last reset
+     *
+     * @return The dispatch statistics
+     */
+    DispatchStats dispatch_stats() const;
+    /** Reset the dispatch statistics */
+    void reset_dispatch_stats();
+
+    /** Enable or disable the capacity-weighted split of the windows
+     *
+     * @note Enabled by default. It only has an effect when the threads are pinned to cores of different types.
+     *
+     * @param[in] enable True to size the windows of each thread according to the capacity of its core
+     */
+    void set_capacity_weighted_split(bool enable);
+    /** Override the calibrated capacity of a type of core
+     *
+     * @param[in] model    Type of core
+     * @param[in] capacity Measured throughput of the core, relative to the other types. Must be positive.
+     */
+    void set_core_capacity(CPUModel model, float capacity);
+
     // Inherited functions overridden
     void         set_num_threads(unsigned int num_threads) override;
     void         set_num_threads_with_affinity(unsigned int num_threads, BindFunc func) override;
@@ -66,6 +152,7 @@ public:
     void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
 
 protected:
+    std::shared_ptr<const std::vector<float>> thread_capacities() const override;
     /** Will run the workloads in parallel using num_threads
      *
      * @param[in] workloads Workloads to run
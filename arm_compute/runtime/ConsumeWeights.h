@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CONSUMEWEIGHTS_H
+#define ACL_ARM_COMPUTE_RUNTIME_CONSUMEWEIGHTS_H
+
+/** @file
+ * @publicapi
+ */
+
+namespace arm_compute
+{
+/** Set whether the operators consume their original weights when prepared
+ *
+ * Once enabled, every CPU operator whose prepare() transforms the weights into a tensor it owns (reshape, transpose,
+ * permute, Winograd transform, assembly pretranspose...) marks the original weights as unused, as run() doesn't read
+ * them anymore. The caller can then free them, which the graph does after each function is prepared, so the model is
+ * not resident twice. Operators which read the original weights in run() leave them marked as used.
+ *
+ * The mode is disabled by default. It can be enabled without changing the application by setting
+ * ARM_COMPUTE_CONSUME_WEIGHTS to 1.
+ *
+ * @note The original weights must not be updated and the operator prepared again after they have been consumed.
+ *
+ * @param[in] consume True to mark the original weights as unused after prepare
+ */
+void set_consume_weights(bool consume);
+/** Return whether the operators consume their original weights when prepared
+ *
+ * @return True if the original weights are marked as unused after prepare
+ */
+bool consume_weights();
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CONSUMEWEIGHTS_H
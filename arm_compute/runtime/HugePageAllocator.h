@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
+#define ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace arm_compute
+{
+/** Allocator backing large buffers with huge pages and recycling freed buffers
+ *
+ * Buffers of at least @ref huge_page_size are mapped 2 MiB-aligned, from the reserved huge pages when there are some
+ * and otherwise as transparent huge pages, which reduces the TLB misses of the kernels streaming through large
+ * activation pools and workspaces. Smaller buffers are page-aligned.
+ *
+ * Sizes are rounded up to size classes, and freed buffers are kept per size class to be handed out again without
+ * mapping new pages, as long as the cached memory stays under a limit.
+ *
+ * @note On systems without mmap support, buffers use the default allocation and are still recycled.
+ */
+class HugePageAllocator final : public IAllocator
+{
+public:
+    /** Size of a huge page */
+    static constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+    /** Allocator statistics */
+    struct Stats
+    {
+        size_t num_allocations{0};   /**< Number of allocations */
+        size_t num_recycled{0};      /**< Number of allocations served from a freed buffer */
+        size_t bytes_in_use{0};      /**< Bytes of the buffers currently allocated, rounded to the size classes */
+        size_t bytes_cached{0};      /**< Bytes of the freed buffers kept for later allocations */
+        size_t peak_bytes_mapped{0}; /**< Peak of the bytes in use and cached */
+        size_t huge_page_bytes{0};   /**< Bytes of the buffers in use or cached which are backed by huge pages */
+    };
+
+    /** Constructor
+     *
+     * @param[in] max_cached_size (Optional) Maximum number of bytes of freed buffers to keep for later allocations
+     */
+    explicit HugePageAllocator(size_t max_cached_size = 256 * 1024 * 1024);
+    /** Destructor
+     *
+     * @note The memory regions made by the allocator stay valid, their buffers are unmapped when they are destroyed.
+     */
+    ~HugePageAllocator();
+    /** Prevent instances of this class from being copied */
+    HugePageAllocator(const HugePageAllocator &) = delete;
+    /** Prevent instances of this class from being copied */
+    HugePageAllocator &operator=(const HugePageAllocator &) = delete;
+
+    /** Get the statistics of the allocator
+     *
+     * @return The statistics
+     */
+    Stats stats() const;
+    /** Unmap the freed buffers kept for later allocations */
+    void release_cached();
+    /** Size class of an allocation
+     *
+     * @param[in] size Size of the allocation in bytes
+     *
+     * @return Number of bytes actually allocated
+     */
+    static size_t size_class(size_t size);
+
+    // Inherited methods overridden:
+    void                          *allocate(size_t size, size_t alignment) override;
+    void                           free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    struct Pool;
+    // Shared with the memory regions, which can outlive the allocator
+    std::shared_ptr<Pool> _pool;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
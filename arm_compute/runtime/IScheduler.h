@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,8 +32,12 @@
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/core/Types.h"
 
+#include <cstdint>
 #include <functional>
+#include <future>
 #include <limits>
+#include <memory>
+#include <mutex>
 
 namespace arm_compute
 {
@@ -65,6 +69,19 @@ public:
      */
     static constexpr unsigned int split_dimensions_all = std::numeric_limits<unsigned>::max();
 
+    /** Estimated cost of a kernel's execution over its whole window
+     *
+     * When provided through the scheduler hints, the window is partitioned by a cost model: the number of workloads
+     * is limited to the parallelism the amount of work can sustain, and the split dimension(s) are picked among all
+     * the window dimensions, the hinted one being preferred. The kernel must therefore support any sub-window.
+     */
+    struct WorkloadCost
+    {
+        uint64_t     macs{0};    /**< Number of multiply-accumulate (or equivalent arithmetic) operations */
+        uint64_t     bytes{0};   /**< Number of bytes read and written */
+        unsigned int granule{1}; /**< Preferred multiple of iterations per split along the hinted dimension */
+    };
+
     /** Scheduler hints
      *
      * Collection of preferences set by the function regarding how to split a given workload
@@ -129,11 +146,39 @@ public:
         {
             return _threshold;
         }
+        /** Set the estimated cost of the workload
+         *
+         * @param[in] cost Estimated cost of the kernel's execution over its whole window
+         *
+         * @return the Hints object
+         */
+        Hints &set_cost(const WorkloadCost &cost)
+        {
+            _cost = cost;
+            return *this;
+        }
+        /** Return the estimated cost of the workload
+         *
+         * @return The estimated cost
+         */
+        const WorkloadCost &cost() const
+        {
+            return _cost;
+        }
+        /** Return whether a cost has been set for the workload
+         *
+         * @return True if the cost model should be used to partition the workload
+         */
+        bool has_cost() const
+        {
+            return _cost.macs != 0 || _cost.bytes != 0;
+        }
 
     private:
         unsigned int _split_dimension{};
         StrategyHint _strategy{};
         int          _threshold{};
+        WorkloadCost _cost{};
     };
     /** Signature for the workloads to execute */
     using Workload = std::function<void(const ThreadInfo &)>;
@@ -141,7 +186,7 @@ public:
     IScheduler();
 
     /** Destructor. */
-    virtual ~IScheduler() = default;
+    virtual ~IScheduler();
 
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
@@ -178,6 +223,26 @@ public:
      */
     virtual void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) = 0;
 
+    /** Runs the kernel asynchronously: the calling thread returns as soon as the kernel has been queued.
+     *
+     * Asynchronous kernels are executed one after the other in submission order, each of them using the whole
+     * scheduler through @ref schedule_op.
+     *
+     * @note The kernel and the tensors referenced by @p tensors must remain valid until the returned future is ready.
+     *
+     * @param[in] kernel  Kernel to execute.
+     * @param[in] hints   Hints for the scheduler.
+     * @param[in] window  Window to use for kernel execution.
+     * @param[in] tensors Vector containing the tensors to operate on.
+     *
+     * @return A future that becomes ready once the kernel has completed. It holds the exception thrown by the kernel, if any.
+     */
+    virtual std::future<void>
+    schedule_op_async(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors);
+
+    /** Completion barrier: block until all the kernels scheduled through @ref schedule_op_async have completed */
+    virtual void sync();
+
     /** Execute all the passed workloads
      *
      * @note There is no guarantee regarding the order in which the workloads will be executed or whether or not they will be executed in parallel.
@@ -202,6 +267,17 @@ public:
     unsigned int num_threads_hint() const;
 
 protected:
+    /** Get the relative capacity of each thread of the scheduler
+     *
+     * When the threads run on cores of different types, the windows of a static split are sized proportionally to the
+     * capacity of the thread executing them, so that all the threads finish at the same time.
+     *
+     * @note This is queried on every static split: implementations should return a cached snapshot rather than
+     *       compute or copy the capacities.
+     *
+     * @return The capacity of each thread indexed by thread id, or nullptr if all the threads are equivalent
+     */
+    virtual std::shared_ptr<const std::vector<float>> thread_capacities() const;
     /** Execute all the passed workloads
      *
      * @note there is no guarantee regarding the order in which the workloads will be executed or whether or not they will be executed in parallel.
@@ -210,6 +286,14 @@ protected:
      */
     virtual void run_workloads(std::vector<Workload> &workloads) = 0;
 
+    /** Execute all the passed workloads and record them in the @ref SchedulerTracer if it is enabled
+     *
+     * @param[in] workloads Array of workloads to run
+     * @param[in] tag       Name of the kernel the workloads belong to (Can be null).
+     * @param[in] window    (Optional) Window of the kernel the workloads belong to.
+     */
+    void run_traced_workloads(std::vector<Workload> &workloads, const char *tag, const Window *window = nullptr);
+
     /** Common scheduler logic to execute the given kernel
      *
      * @param[in] kernel  Kernel to execute.
@@ -237,7 +321,20 @@ protected:
                                       const CPUInfo    &cpu_info);
 
 private:
-    unsigned int _num_threads_hint = {};
+    /** Partition the window of a kernel using the cost provided in the hints and run the resulting workloads
+     *
+     * @param[in] kernel  Kernel to execute.
+     * @param[in] hints   Hints for the scheduler. Must contain a cost.
+     * @param[in] window  Window to use for kernel execution.
+     * @param[in] tensors Vector containing the tensors to operate on.
+     */
+    void schedule_partitioned(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors);
+
+    struct AsyncQueue;
+
+    unsigned int                _num_threads_hint = {};
+    std::unique_ptr<AsyncQueue> _async_queue{nullptr};
+    std::mutex                  _async_queue_mutex{};
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_ISCHEDULER_H
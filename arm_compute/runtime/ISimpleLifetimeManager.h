@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,6 +57,19 @@ public:
     ISimpleLifetimeManager(ISimpleLifetimeManager &&) = default;
     /** Allow instances of this class to be moved */
     ISimpleLifetimeManager &operator=(ISimpleLifetimeManager &&) = default;
+    /** Total size of the objects whose lifetime has been managed
+     *
+     * @return The sum of the sizes of the managed objects of all the groups, including the released ones
+     */
+    size_t managed_size() const;
+    /** Size of the memory of a pool created by this manager
+     *
+     * @note The default implementation sums the maximum sizes of the blobs. Managers laying the blobs out differently
+     *       should override it.
+     *
+     * @return The size in bytes of the blobs of a pool
+     */
+    virtual size_t pool_size() const;
 
     // Inherited methods overridden:
     void register_group(IMemoryGroup *group) override;
@@ -101,6 +114,7 @@ protected:
     std::map<void *, Element> _active_elements; /**< A map that contains the active elements */
     std::list<Blob>           _free_blobs;      /**< Free blobs */
     std::list<Blob>           _occupied_blobs;  /**< Occupied blobs */
+    size_t                    _managed_size;    /**< Total size of the managed objects */
     std::map<IMemoryGroup *, std::map<void *, Element>>
         _finalized_groups; /**< A map that contains the finalized groups */
 };
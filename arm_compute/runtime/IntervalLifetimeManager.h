@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_INTERVALLIFETIMEMANAGER_H
+#define ACL_ARM_COMPUTE_RUNTIME_INTERVALLIFETIMEMANAGER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+#include "arm_compute/runtime/Types.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class BlobLifetimeManager;
+class IMemoryPool;
+class OffsetLifetimeManager;
+
+/** Concrete class that tracks the lifetime intervals of registered tensors and plans their offsets in a single blob
+ *
+ * Unlike @ref OffsetLifetimeManager, which packs the reused blobs back-to-back, the offsets are assigned with a
+ * best-fit policy: each object, largest first, is placed in the smallest gap left by the objects whose lifetime
+ * overlaps with its own. The plan is never larger than the one of an @ref OffsetLifetimeManager.
+ */
+class IntervalLifetimeManager : public ISimpleLifetimeManager
+{
+public:
+    using info_type = BlobInfo;
+
+    /** Memory footprint of the plan compared to the other lifetime managers */
+    struct Footprint
+    {
+        size_t planned{0};   /**< Size of the blob planned by this manager */
+        size_t offset{0};    /**< Size of the blob an @ref OffsetLifetimeManager would need */
+        size_t blob{0};      /**< Total size of the blobs a @ref BlobLifetimeManager would need */
+        size_t peak_live{0}; /**< Highest total size of the objects alive at the same time: lower bound of any plan */
+    };
+
+public:
+    /** Constructor */
+    IntervalLifetimeManager();
+    /** Destructor */
+    ~IntervalLifetimeManager();
+    /** Prevent instances of this class to be copy constructed */
+    IntervalLifetimeManager(const IntervalLifetimeManager &) = delete;
+    /** Prevent instances of this class to be copied */
+    IntervalLifetimeManager &operator=(const IntervalLifetimeManager &) = delete;
+    /** Allow instances of this class to be move constructed */
+    IntervalLifetimeManager(IntervalLifetimeManager &&);
+    /** Allow instances of this class to be moved */
+    IntervalLifetimeManager &operator=(IntervalLifetimeManager &&);
+    /** Accessor to the pool internal configuration meta-data
+     *
+     * @return Lifetime manager internal configuration meta-data
+     */
+    const info_type &info() const;
+    /** Accessor to the memory footprint of the plan and of the plans of the other lifetime managers
+     *
+     * @return The footprints accumulated over all the finalized groups
+     */
+    const Footprint &footprint() const;
+
+    // Inherited methods overridden:
+    void                         start_lifetime(void *obj) override;
+    void                         end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
+    size_t                       pool_size() const override;
+    std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
+    MappingType                  mapping_type() const override;
+
+private:
+    // Inherited methods overridden:
+    void update_blobs_and_mappings() override;
+
+private:
+    /** Lifetime of an object in number of lifetime events */
+    struct Interval
+    {
+        size_t start; /**< Event at which the lifetime starts */
+        size_t end;   /**< Event at which the lifetime ends */
+    };
+
+    BlobInfo                               _blob;             /**< Memory blob size */
+    Footprint                              _footprint;        /**< Footprint of the plans */
+    std::map<void *, Interval>             _intervals;        /**< Lifetime of the objects of the active group */
+    size_t                                 _clock;            /**< Number of lifetime events of the active group */
+    std::unique_ptr<BlobLifetimeManager>   _blob_reference;   /**< Blob manager replaying the lifetimes */
+    std::unique_ptr<OffsetLifetimeManager> _offset_reference; /**< Offset manager replaying the lifetimes */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_INTERVALLIFETIMEMANAGER_H
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_NEGEMMTUNER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_NEGEMMTUNER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Tuner of the assembly kernels used by the CPU GEMM-based functions
+ *
+ * By default the assembly GEMM picks its kernel from static cycle estimates. When tuning is enabled, the first
+ * configuration of a GEMM times every kernel compatible with its shape, data types and number of threads instead, and
+ * keeps the fastest in the tuning table. Later configurations of the same GEMM, in the same process or through a
+ * tuning file in a later one, use the kernel from the table without timing it again.
+ *
+ * Tuning is disabled by default. It can be set up without changing the application with the
+ * ARM_COMPUTE_GEMM_TUNING_FILE environment variable, which sets the tuning file, and ARM_COMPUTE_GEMM_TUNE set to 1,
+ * which enables the tuning of new GEMMs.
+ *
+ * @note The GEMM identifiers include the CPU models and ISA extensions of the system, so the entries tuned on other
+ *       CPUs are ignored.
+ * @note Fixed format, indirect and dynamically shaped GEMMs always use the default kernel.
+ */
+class NEGEMMTuner
+{
+public:
+    /** Access the tuner singleton
+     *
+     * @return The tuner
+     */
+    static NEGEMMTuner &get();
+    /** Prevent instances of this class from being copied */
+    NEGEMMTuner(const NEGEMMTuner &) = delete;
+    /** Prevent instances of this class from being copied */
+    NEGEMMTuner &operator=(const NEGEMMTuner &) = delete;
+
+    /** Setter for tune_new_kernels option
+     *
+     * @param[in] tune_new_kernels Time the kernels of the GEMMs which are not present in the table ?
+     */
+    void set_tune_new_kernels(bool tune_new_kernels);
+    /** Tune GEMMs that are not in the tuning table
+     *
+     * @return True if tuning of new GEMMs is enabled.
+     */
+    bool tune_new_kernels() const;
+    /** Set the number of timed runs of each kernel
+     *
+     * @param[in] num_iterations Number of timed runs, the fastest one is kept. Must be >= 1
+     */
+    void set_num_iterations(unsigned int num_iterations);
+    /** Get the number of timed runs of each kernel
+     *
+     * @return Number of timed runs
+     */
+    unsigned int num_iterations() const;
+    /** Set the tuning file
+     *
+     * The tuning table is loaded from the file if it exists, and the file is rewritten every time a new GEMM is tuned.
+     *
+     * @param[in] filename Path of the tuning file. An empty path stops saving the newly tuned GEMMs
+     */
+    void set_tuning_file(const std::string &filename);
+    /** Get the tuning file
+     *
+     * @return Path of the tuning file, empty if none is set
+     */
+    std::string tuning_file() const;
+    /** Return whether the tuner can change the kernel of a GEMM
+     *
+     * @return True if tuning of new GEMMs is enabled or the tuning table is not empty
+     */
+    bool is_enabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    /** Manually add the kernel to use for a GEMM
+     *
+     * @param[in] gemm_id     Unique identifier of the GEMM
+     * @param[in] kernel_name Name of the assembly kernel to use for the given GEMM
+     */
+    void add_tuning_params(const std::string &gemm_id, const std::string &kernel_name);
+    /** Find the kernel to use for a GEMM
+     *
+     * @param[in]  gemm_id     Unique identifier of the GEMM
+     * @param[out] kernel_name Name of the assembly kernel to use for the given GEMM, if found
+     *
+     * @return True if the GEMM is in the tuning table
+     */
+    bool find_tuning_params(const std::string &gemm_id, std::string &kernel_name) const;
+    /** Import tuning parameters table
+     *
+     * @param[in] tuning_params_table The unordered_map container to import
+     */
+    void import_tuning_params(const std::unordered_map<std::string, std::string> &tuning_params_table);
+    /** Get a copy of the tuning params table
+     *
+     * @return The tuning params table, mapping the GEMM identifiers to kernel names
+     */
+    std::unordered_map<std::string, std::string> tuning_params_table() const;
+    /** Remove every entry of the tuning table */
+    void clear();
+
+    /** Load the tuning parameters table from file
+     *
+     * @note Malformed rows are skipped with a warning.
+     *
+     * @param[in] filename Load the tuning parameters table from this file. (Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the content of the tuning parameters table to file
+     *
+     * The rows already in the file are kept, unless the table has an entry for the same GEMM identifier.
+     *
+     * @param[in] filename Save the tuning parameters table to this file.
+     *
+     * @return true if the file was created
+     */
+    bool save_to_file(const std::string &filename) const;
+
+private:
+    NEGEMMTuner();
+    void update_enabled();
+    bool save_table(const std::string &filename) const;
+
+    std::atomic<bool>                            _enabled{false};
+    mutable std::mutex                           _mtx{};
+    std::unordered_map<std::string, std::string> _tuning_params_table{};
+    std::string                                  _tuning_file{};
+    bool                                         _tune_new_kernels{false};
+    unsigned int                                 _num_iterations{5};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_NEGEMMTUNER_H
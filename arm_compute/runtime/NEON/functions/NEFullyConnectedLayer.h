@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -116,12 +116,24 @@ public:
      * |F32            |F32                |F32    |F32            |
      * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
+     * |F16            |U8                 |F16    |F16            |
+     * |F32            |U8                 |F32    |F32            |
+     *
+     * @note U8 weights are only accepted as block-quantized 4-bit weights described by
+     *       @ref FullyConnectedLayerInfo::int4_weights_info. They are never transposed and hold one row of
+     *       @ref Int4WeightsInfo::row_size() bytes per output.
+     * @note F32 weights can be sparse, see @ref WeightsInfo::weights_sparsity(). They are provided dense with
+     *       explicit zeros and compressed when the function is prepared. With WeightsSparsity::STRUCTURED_2_4,
+     *       an exception is thrown if a group of 4 values along K has more than 2 non-zero values.
+     *
+     * @note @p input and @p output can have dynamic shapes: they are configured with an initial shape and their
+     *       batch size can change between runs. The weights are only prepared once.
      *
      * @param[in]  input        Source tensor. Data type supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      * @param[in]  weights      Weights tensor. The weights must be 2 dimensional.
      *                          If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                          If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
-     *                          Data type supported: Same as @p input.
+     *                          Data type supported: Same as @p input, U8 for block-quantized 4-bit weights.
      * @param[in]  biases       Bias tensor. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
      * @param[out] output       Destination tensor. Its shape should be equal to the output of a matrix multiplication between:
      *                          - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,14 +67,18 @@ public:
      * |F32          |F32         |F32       |F32            |
      * |F16          |F16         |F16       |F16            |
      * |BFLOAT16     |BFLOAT16    |BFLOAT16  |BFLOAT16       |
+     * |F32          |U8          |F32       |F32            |
+     * |F16          |U8          |F16       |F16            |
      *
      * @note GEMM: General Matrix Multiply - [alpha * A * B + beta * C].
      * @note GEMM: The tensors a, b, c, d must have the same data type. You should not mix data types when calling this function.
+     * @note GEMM: If @ref GEMMInfo::int4_weights_info() is enabled, b is a U8 tensor of block-quantized 4-bit weights, alpha must be 1 and c can only be a bias with beta equal to 1.
+     * @note GEMM: If @ref GEMMInfo::weights_sparsity() is not WeightsSparsity::DENSE, only F32 is supported, b is a dense 2D matrix with explicit zeros, alpha must be 1 and c can only be a bias with beta equal to 1. With WeightsSparsity::STRUCTURED_2_4, running the function throws an exception if a group of 4 values of b along K has more than 2 non-zero values.
      *
      * @note Batched GEMM only supports broadcasting cases where RHS rank < LHS rank but not the other way around
      *
      * @param[in]  a         First input tensor  (Matrix A or Vector A). Data type supported: BFLOAT16/F16/F32
-     * @param[in]  b         Second input tensor (Matrix B). Data type supported: same as @p a
+     * @param[in]  b         Second input tensor (Matrix B). Data type supported: same as @p a, or U8 for block-quantized 4-bit weights
      * @param[in]  c         Third input tensor  (Matrix C). It can be a nullptr if just the multiplication between @p a and @p b is needed. Data type supported: same as @p a
      * @param[out] d         Output tensor. Data type supported: same as @p a
      * @param[in]  alpha     Weight of the matrix product
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMBATCHED_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMBATCHED_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/function_info/GEMMBatchedInfo.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to compute many small independent matrix products in a single call. This function calls the following
+ * kernels:
+ *
+ *  -# cpu::CpuGemmBatched
+ *
+ * Attention heads, grouped convolutions or mixtures of experts produce many small GEMMs: running them one by one with
+ * @ref NEGEMM pays the dispatch and packing overhead for each of them. This function packs all the B matrices once and
+ * gives each thread whole problems, which can have different shapes.
+ */
+class NEGEMMBatched : public IFunction
+{
+public:
+    /** Constructor */
+    NEGEMMBatched(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMBatched(const NEGEMMBatched &) = delete;
+    /** Default move constructor */
+    NEGEMMBatched(NEGEMMBatched &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMBatched &operator=(const NEGEMMBatched &) = delete;
+    /** Default move assignment operator */
+    NEGEMMBatched &operator=(NEGEMMBatched &&) = default;
+    /** Default destructor */
+    ~NEGEMMBatched();
+    /** Initialise the kernel's inputs, output
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0         |src1        |src2      |dst            |
+     * |:------------|:-----------|:---------|:--------------|
+     * |F32          |F32         |F32       |F32            |
+     *
+     * @note Each problem computes D = A * B (+ bias) on views of @p a, @p b, @p c and @p d described by @ref GEMMBatchedProblem.
+     * @note The views of D of the different problems must not overlap. The elements of @p d outside of these views are left untouched.
+     *
+     * @param[in]  a         Tensor holding the A matrices. Data type supported: F32
+     * @param[in]  b         Tensor holding the B matrices. Data type supported: same as @p a
+     * @param[in]  c         Tensor holding the biases. Can be nullptr. Data type supported: same as @p a
+     * @param[out] d         Tensor holding the D matrices. Must be initialized. Data type supported: same as @p a
+     * @param[in]  problems  Problems of the batched GEMM
+     * @param[in]  gemm_info (Optional) Specifies if the B matrices should only be packed on the first run and the fused
+     *                       activation, which can be RELU, BOUNDED_RELU or LU_BOUNDED_RELU
+     */
+    void configure(const ITensor                         *a,
+                   const ITensor                         *b,
+                   const ITensor                         *c,
+                   ITensor                               *d,
+                   const std::vector<GEMMBatchedProblem> &problems,
+                   const GEMMInfo                        &gemm_info = GEMMInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMBatched.
+     *
+     * Similar to @ref NEGEMMBatched::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                     *a,
+                           const ITensorInfo                     *b,
+                           const ITensorInfo                     *c,
+                           const ITensorInfo                     *d,
+                           const std::vector<GEMMBatchedProblem> &problems,
+                           const GEMMInfo                        &gemm_info = GEMMInfo());
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMBATCHED_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 
 #include "arm_compute/core/Types.h"
 #include "arm_compute/function_info/ActivationLayerInfo.h"
+#include "arm_compute/function_info/GEMMInfo.h"
 #include "arm_compute/runtime/IFunction.h"
 
 #include <memory>
@@ -50,6 +51,11 @@ public:
     {
         return _fixed_format;
     }
+    // get block-quantized 4-bit rhs info
+    const Int4WeightsInfo &int4_weights_info() const
+    {
+        return _int4_weights_info;
+    }
     // Set fast math flag
     CpuMatMulSettings &fast_math(bool fmath)
     {
@@ -62,10 +68,17 @@ public:
         _fixed_format = fixed_format;
         return *this;
     }
+    // Set block-quantized 4-bit rhs info
+    CpuMatMulSettings &int4_weights_info(const Int4WeightsInfo &int4_weights_info)
+    {
+        _int4_weights_info = int4_weights_info;
+        return *this;
+    }
 
 private:
-    bool _fast_math{false};
-    bool _fixed_format{false};
+    bool            _fast_math{false};
+    bool            _fixed_format{false};
+    Int4WeightsInfo _int4_weights_info{};
 };
 
 // Forward declarations
@@ -106,9 +119,17 @@ public:
      * |BFLOAT16       |BFLOAT16           |BFLOAT16       |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |QASYMM8_SIGNED |
      * |QASYMM8        |QASYMM8            |QASYMM8        |
+     * |F32            |U8                 |F32            |
+     * |F16            |U8                 |F16            |
+     *
+     * @note U8 rhs is only accepted as block-quantized 4-bit weights described by
+     *       @ref CpuMatMulSettings::int4_weights_info. The rhs must be 2 dimensional, stored transposed
+     *       (@ref MatMulInfo::adj_rhs set) with one row of @ref Int4WeightsInfo::row_size() bytes per output
+     *       column, and is shared by all the batches of @p lhs. Constant weights are packed only once, on the first
+     *       run or in @ref prepare().
      *
      * @param[in]  lhs      Left-hand side tensor info. Data types supported: F16/F32/QASYMM8_SIGNED/QASYMM8.
-     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs.
+     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs, U8 for block-quantized 4-bit weights.
      * @param[out] dst      Output tensor to store the result of the batched matrix multiplication. Data types supported: same as @p lhs / @p rhs.
      * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo.
      * @param[in]  settings Contains flags for function level settings i.e fast math
@@ -123,7 +144,7 @@ public:
     /** Static function to check if given info will lead to a valid configuration of @ref NEMatMul
      *
      * @param[in]  lhs      Left-hand side tensor info. Data types supported: F16/F32/QASYMM8_SIGNED/QASYMM8.
-     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs.
+     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs, U8 for block-quantized 4-bit weights.
      * @param[out] dst      Output tensor info to store the result of the batched matrix multiplication. Data types supported: same as @p lhs / @p rhs.
      * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo.
      * @param[in]  settings Contains flags for function level settings i.e fast math
@@ -140,6 +161,7 @@ public:
 
     // Inherited methods overridden
     void run() override;
+    void prepare() override;
 
 private:
     struct Impl;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,7 +72,8 @@ public:
      * @param[in,out] input  Source tensor. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32. If the width is not a
      *                       multiple of the internal processing block size, @ref NEFillBorder replicates the
      *                       last value of each row to the nearest multiple.
-     * @param[out]    output Destination tensor. Data types supported: same as @p input.
+     * @param[out]    output Destination tensor. Data types supported: same as @p input. Can be @p input to compute
+     *                       a floating point softmax in-place.
      * @param[in]     beta   (Optional) A scaling factor for the exponent.
      * @param[in]     axis   (Optional) The dimension in which to apply the function. E.g. for input of shape 4x5x6 and
      *                       axis=1, softmax will be applied to 4x6=24 vectors of size 5. Defaults to 0
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NUMAALLOCATOR_H
+#define ACL_ARM_COMPUTE_RUNTIME_NUMAALLOCATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace arm_compute
+{
+namespace numa
+{
+/** Return the number of NUMA nodes of the system
+ *
+ * @return Number of nodes, 1 if the system is not NUMA or the topology can't be read
+ */
+unsigned int num_nodes();
+/** Return the CPUs of a NUMA node
+ *
+ * @param[in] node Node to query
+ *
+ * @return The ids of the CPUs of the node, all the CPUs if the topology can't be read
+ */
+std::vector<int> node_cpus(unsigned int node);
+/** Return the NUMA node of a CPU
+ *
+ * @param[in] cpu CPU to query
+ *
+ * @return The node the CPU belongs to, 0 if the topology can't be read
+ */
+unsigned int cpu_node(int cpu);
+
+/** Thread placement policies */
+enum class BindPolicy
+{
+    Compact, /**< Fill the CPUs of a node before moving to the next one, to keep the threads close to their memory */
+    Scatter, /**< Distribute the threads round-robin over the nodes, to use the memory bandwidth of all of them */
+};
+/** Create a function binding the threads of a scheduler to CPUs according to a NUMA placement policy
+ *
+ * @note To be used with @ref IScheduler::set_num_threads_with_affinity
+ *
+ * @param[in] policy Placement policy
+ * @param[in] node   (Optional) Restrict the threads to the CPUs of this node. -1 to use all the nodes.
+ *
+ * @return The binding function
+ */
+IScheduler::BindFunc make_bind_func(BindPolicy policy, int node = -1);
+} // namespace numa
+
+/** Allocator placing the memory on a given NUMA node
+ *
+ * Pages are bound to the node at allocation time instead of being placed on the node of the thread touching them
+ * first. Memory is allocated in whole pages, so this allocator is meant for large buffers such as memory pools and
+ * weights.
+ *
+ * @note On systems without NUMA support, this behaves as a page-aligned allocator.
+ */
+class NumaAllocator final : public IAllocator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] node       Node to place the memory on. -1 interleaves the pages over all the nodes.
+     * @param[in] huge_pages (Optional) Back the buffers of at least 2 MiB with transparent huge pages when available
+     */
+    explicit NumaAllocator(int node = -1, bool huge_pages = false);
+    /** Default destructor */
+    ~NumaAllocator();
+    /** Prevent instances of this class from being copied */
+    NumaAllocator(const NumaAllocator &) = delete;
+    /** Prevent instances of this class from being copied */
+    NumaAllocator &operator=(const NumaAllocator &) = delete;
+    /** Node the memory is placed on
+     *
+     * @return The node, -1 if the memory is interleaved
+     */
+    int node() const;
+    /** Whether the large buffers are backed by transparent huge pages
+     *
+     * @return True if huge pages are requested
+     */
+    bool huge_pages() const;
+
+    // Inherited methods overridden:
+    void                          *allocate(size_t size, size_t alignment) override;
+    void                           free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    int                                _node;
+    bool                               _huge_pages;
+    std::mutex                         _mtx{};
+    std::unordered_map<void *, size_t> _sizes{};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NUMAALLOCATOR_H
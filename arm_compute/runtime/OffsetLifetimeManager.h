@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -64,6 +64,7 @@ public:
     const info_type &info() const;
 
     // Inherited methods overridden:
+    size_t                       pool_size() const override;
     std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
     MappingType                  mapping_type() const override;
 
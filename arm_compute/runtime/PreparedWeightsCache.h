@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_PREPAREDWEIGHTSCACHE_H
+#define ACL_ARM_COMPUTE_RUNTIME_PREPAREDWEIGHTSCACHE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Cache of the weights prepared by the operators, persisted to disk
+ *
+ * Operators whose prepare() transforms constant weights (e.g. the pretranspose of the assembly GEMMs or the Winograd
+ * weights transform) store the result in a file of the cache directory, keyed by a hash of the original weights, the
+ * operator configuration and the ISA of the CPU. On later runs the file is memory-mapped instead of re-running the
+ * transform, so preparing becomes almost free and the page cache shares the prepared weights between processes.
+ *
+ * The cache is disabled by default. It can be enabled without changing the application by setting
+ * ARM_COMPUTE_PREPARED_WEIGHTS_CACHE to the path of the cache directory.
+ *
+ * @note Memory mapping is not available on Windows and bare metal targets, where the cache stays disabled.
+ */
+class PreparedWeightsCache
+{
+public:
+    /** Cache statistics */
+    struct Stats
+    {
+        unsigned int hits{0};   /**< Number of prepared weights mapped from the cache */
+        unsigned int misses{0}; /**< Number of lookups which didn't find the prepared weights */
+        unsigned int stores{0}; /**< Number of prepared weights written to the cache */
+        unsigned int shares{0}; /**< Number of prepared weights shared with another operator of the process */
+    };
+
+    /** Access the cache singleton
+     *
+     * @return The cache
+     */
+    static PreparedWeightsCache &get();
+    /** Prevent instances of this class from being copied */
+    PreparedWeightsCache(const PreparedWeightsCache &) = delete;
+    /** Prevent instances of this class from being copied */
+    PreparedWeightsCache &operator=(const PreparedWeightsCache &) = delete;
+
+    /** Set the directory the prepared weights are stored to
+     *
+     * @note The directory must exist. Operators already prepared are not affected.
+     *
+     * @param[in] directory Path of the cache directory. An empty path disables the cache
+     */
+    void set_directory(const std::string &directory);
+    /** Get the directory the prepared weights are stored to
+     *
+     * @return Path of the cache directory, empty if the cache is disabled
+     */
+    std::string directory() const;
+    /** Return whether the cache is enabled
+     *
+     * @return True if a cache directory is set
+     */
+    bool is_enabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+    /** Enable the sharing of the prepared weights between the operators of the process
+     *
+     * Operators configured while the sharing is enabled keep their prepared weights in a buffer shared with the other
+     * operators preparing the same weights with the same configuration, e.g. the functions a graph configures for each
+     * of its batch sizes. Sharing doesn't need a cache directory.
+     *
+     * @param[in] enable True to enable the sharing
+     */
+    void set_sharing(bool enable);
+    /** Return whether the prepared weights are shared between the operators of the process
+     *
+     * @return True if the sharing is enabled
+     */
+    bool is_sharing_enabled() const
+    {
+        return _sharing.load(std::memory_order_relaxed);
+    }
+    /** Get the statistics of the cache
+     *
+     * @return Number of hits, misses and stores since the last call to @ref set_directory
+     */
+    Stats stats() const;
+
+    /** Hash the content of a tensor
+     *
+     * @note Padding is not part of the hash.
+     *
+     * @param[in] tensor Tensor to hash, must be allocated
+     *
+     * @return 64-bit hash of the elements of the tensor
+     */
+    static uint64_t hash(const ITensor &tensor);
+    /** Build the key of prepared weights
+     *
+     * The ISA of the CPU is part of the key, so a cache directory can be shared between different machines.
+     *
+     * @param[in] op_name      Name of the operator which prepares the weights
+     * @param[in] weights_hash Hash of the original weights, see @ref hash
+     * @param[in] config       Configuration of the operator the prepared weights depend on (kernel name, weight format,
+     *                         shapes, quantization...)
+     *
+     * @return The key
+     */
+    static std::string make_key(const std::string &op_name, uint64_t weights_hash, const std::string &config);
+
+    /** Map prepared weights from the cache
+     *
+     * @param[in] key  Key of the prepared weights
+     * @param[in] size Size in bytes of the prepared weights
+     *
+     * @return Read-only pointer to the mapped weights, which are unmapped when the last copy of the pointer is
+     *         released. nullptr if the cache is disabled or doesn't contain the weights
+     */
+    std::shared_ptr<const uint8_t> load(const std::string &key, size_t size);
+    /** Store prepared weights to the cache
+     *
+     * The file is written under a temporary name and then renamed, so concurrent processes never map a partial file.
+     *
+     * @param[in] key  Key of the prepared weights
+     * @param[in] data Prepared weights
+     * @param[in] size Size in bytes of the prepared weights
+     *
+     * @return True if the weights have been written
+     */
+    bool store(const std::string &key, const uint8_t *data, size_t size);
+
+    /** Find prepared weights shared by another operator of the process
+     *
+     * @param[in] key  Key of the prepared weights
+     * @param[in] size Size in bytes of the prepared weights
+     *
+     * @return Read-only pointer to the shared weights, nullptr if no operator in use shares them
+     */
+    std::shared_ptr<const uint8_t> find_shared(const std::string &key, size_t size);
+    /** Share prepared weights with the other operators of the process
+     *
+     * The weights are copied to a buffer owned by the operators using it, which is released with the last of them.
+     *
+     * @param[in] key  Key of the prepared weights
+     * @param[in] data Prepared weights
+     * @param[in] size Size in bytes of the prepared weights
+     *
+     * @return Read-only pointer to the shared weights. If another operator shared the weights in the meantime, its
+     *         buffer is returned instead
+     */
+    std::shared_ptr<const uint8_t> share(const std::string &key, const uint8_t *data, size_t size);
+
+private:
+    /** Prepared weights shared between the operators of the process */
+    struct SharedWeights
+    {
+        size_t                       size{0};
+        std::weak_ptr<const uint8_t> data{};
+    };
+
+    PreparedWeightsCache();
+
+    std::atomic<bool>                    _enabled{false};
+    std::atomic<bool>                    _sharing{false};
+    mutable std::mutex                   _mtx{};
+    std::string                          _directory{};
+    Stats                                _stats{};
+    std::map<std::string, SharedWeights> _shared{};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_PREPAREDWEIGHTSCACHE_H
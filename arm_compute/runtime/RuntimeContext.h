@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 #include "arm_compute/runtime/IRuntimeContext.h"
 
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -40,6 +41,16 @@ class RuntimeContext : public IRuntimeContext
 public:
     /** Default Constructor */
     RuntimeContext();
+    /** Constructor
+     *
+     * Creates a scheduler owned by the context whose threads are bound to the given CPUs, so that several contexts
+     * can execute concurrently on disjoint sets of cores.
+     *
+     * @note Only the worker threads are bound: the thread calling run() keeps its affinity.
+     *
+     * @param[in] cpu_ids CPUs to bind the threads of the scheduler to. See @ref SchedulerFactory::create
+     */
+    explicit RuntimeContext(const std::vector<int> &cpu_ids);
     /** Destructor */
     ~RuntimeContext() = default;
     /** Prevent instances of this class from being copied (As this class contains pointers) */
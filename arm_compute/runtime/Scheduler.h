@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -76,6 +76,18 @@ public:
      * @return true if the given scheduler type is supported. False otherwise.
      */
     static bool is_available(Type t);
+    /** Override the scheduler returned by @ref get() on the calling thread only
+     *
+     * @note The caller keeps the ownership of the scheduler, which must outlive the override.
+     *
+     * @param[in] scheduler Scheduler to use on the calling thread. nullptr restores the active scheduler.
+     */
+    static void set_thread_override(IScheduler *scheduler);
+    /** Returns the scheduler overriding the active scheduler on the calling thread
+     *
+     * @return The overriding scheduler, nullptr if there is none
+     */
+    static IScheduler *get_thread_override();
 
 private:
     static Type _scheduler_type;
@@ -85,6 +97,9 @@ private:
     static std::shared_ptr<IScheduler> thread_local _custom_scheduler;
 #endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
     static std::map<Type, std::unique_ptr<IScheduler>> _schedulers;
+#ifndef BARE_METAL
+    static thread_local IScheduler *_thread_override;
+#endif // BARE_METAL
 
     Scheduler();
 };
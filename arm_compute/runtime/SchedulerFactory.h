@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025 Arm Limited.
+ * Copyright (c) 2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 #include "arm_compute/runtime/IScheduler.h"
 
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -54,6 +55,24 @@ public:
      * @return Scheduler
      */
     static std::unique_ptr<IScheduler> create(Type type = _default_type);
+    /** Create a scheduler whose threads are bound to a set of CPUs
+     *
+     * This allows several schedulers to run concurrently in the same process on disjoint sets of cores.
+     *
+     * @note The scheduler pins one worker thread to each CPU of the set. The thread calling the scheduler is not
+     *       pinned: it belongs to the application, so its affinity is never modified. It executes one workload as
+     *       well, so a kernel is split in cpu_ids.size() + 1 workloads and the caller may run on a CPU outside the
+     *       set. Callers needing strict isolation should pin their own thread before scheduling.
+     * @note Binding is only supported by the C++11 scheduler. A single thread scheduler ignores the CPU set.
+     *
+     * @warning An error is raised, in release builds too, if @p cpu_ids is empty or @p type is @ref Type::OMP.
+     *
+     * @param[in] cpu_ids CPUs to bind the threads to. Must not be empty.
+     * @param[in] type    Type of scheduler to create
+     *
+     * @return Scheduler
+     */
+    static std::unique_ptr<IScheduler> create(const std::vector<int> &cpu_ids, Type type = _default_type);
 
 private:
     static const Type _default_type;
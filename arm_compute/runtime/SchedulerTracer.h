@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_SCHEDULERTRACER_H
+#define ACL_ARM_COMPUTE_RUNTIME_SCHEDULERTRACER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+class IScheduler;
+
+/** Low-overhead tracer of the kernels executed by the schedulers
+ *
+ * When enabled, every kernel run through a scheduler is recorded with its name, the shape of its window and the
+ * start and stop time of each of its workloads on each thread. The records can be exported as a Chrome trace,
+ * which can be opened in chrome://tracing or Perfetto, to find load imbalance and thread-starved kernels.
+ *
+ * Tracing can also be enabled without changing the application by setting ARM_COMPUTE_SCHEDULER_TRACE to the path
+ * of the file the Chrome trace is written to at exit.
+ *
+ * @note When disabled, the cost of the tracer is a relaxed atomic load per scheduled kernel.
+ * @note The records are kept in a ring buffer: once it is full, the oldest records are overwritten by the new ones.
+ *       The capacity can be set through ARM_COMPUTE_SCHEDULER_TRACE_CAPACITY.
+ */
+class SchedulerTracer
+{
+public:
+    /** Execution of a workload on a thread */
+    struct WorkloadRecord
+    {
+        unsigned int thread_id{0}; /**< Id of the thread which ran the workload */
+        int64_t      start_ns{0};  /**< Start time in ns */
+        int64_t      end_ns{0};    /**< Stop time in ns */
+    };
+    /** Execution of a kernel */
+    struct KernelRecord
+    {
+        const IScheduler           *scheduler{nullptr}; /**< Scheduler which ran the kernel */
+        std::string                 name{};             /**< Name of the kernel, or tag of the workloads */
+        std::string                 window{};           /**< Number of iterations of each dimension of the window */
+        unsigned int                num_threads{1};     /**< Number of threads the workloads were distributed to */
+        int64_t                     start_ns{0};        /**< Start time in ns */
+        int64_t                     end_ns{0};          /**< Stop time in ns */
+        std::vector<WorkloadRecord> workloads{};        /**< Workloads the kernel was split into */
+    };
+
+    /** Access the tracer singleton
+     *
+     * @return The tracer
+     */
+    static SchedulerTracer &get();
+    /** Prevent instances of this class from being copied */
+    SchedulerTracer(const SchedulerTracer &) = delete;
+    /** Prevent instances of this class from being copied */
+    SchedulerTracer &operator=(const SchedulerTracer &) = delete;
+    /** Destructor: write the trace to the file set through ARM_COMPUTE_SCHEDULER_TRACE, if any */
+    ~SchedulerTracer();
+
+    /** Enable or disable the recording of the kernels
+     *
+     * @param[in] enable True to start recording, false to stop
+     */
+    void set_enabled(bool enable);
+    /** Return whether the kernels are being recorded
+     *
+     * @return True if the tracer is enabled
+     */
+    bool is_enabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+    /** Discard all the records */
+    void clear();
+    /** Set the maximum number of records kept, the most recent records are kept if there are already more
+     *
+     * @param[in] capacity Maximum number of records. Must be greater than 0
+     */
+    void set_capacity(size_t capacity);
+    /** Get the maximum number of records kept
+     *
+     * @return The capacity of the ring buffer of records
+     */
+    size_t capacity() const;
+    /** Get the number of records overwritten because the ring buffer was full since the last @ref clear
+     *
+     * @return The number of dropped records
+     */
+    size_t num_dropped() const;
+    /** Get a copy of the records collected so far
+     *
+     * @return The kernel records in completion order
+     */
+    std::vector<KernelRecord> records() const;
+    /** Add the record of a kernel execution
+     *
+     * @note Called by the schedulers, the record is dropped if the tracer is disabled
+     *
+     * @param[in] record Record to add
+     */
+    void add_record(KernelRecord &&record);
+    /** Write the records as a Chrome trace in JSON format
+     *
+     * Each scheduler is a process and each of its threads a track. Kernels are shown on a dedicated track and carry the
+     * busy and idle time of the threads during their execution.
+     *
+     * @param[out] os Stream to write to
+     */
+    void write_chrome_trace(std::ostream &os) const;
+    /** Write the records as a Chrome trace to a file
+     *
+     * @param[in] filename Path of the file to write
+     *
+     * @return True if the file has been written
+     */
+    bool save_chrome_trace(const std::string &filename) const;
+
+    /** Current time of the clock used by the records
+     *
+     * @return Time in ns
+     */
+    static int64_t now_ns();
+
+private:
+    SchedulerTracer();
+
+    /** Copy the records in completion order, the mutex must be held */
+    std::vector<KernelRecord> ordered_records() const;
+
+    std::atomic<bool>         _enabled{false};
+    mutable std::mutex        _mtx{};
+    std::vector<KernelRecord> _records{};  /**< Ring buffer of records */
+    size_t                    _capacity;   /**< Maximum number of records */
+    size_t                    _next{0};    /**< Position of the oldest record once the ring buffer is full */
+    size_t                    _dropped{0}; /**< Number of records overwritten */
+    std::string               _trace_file{};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_SCHEDULERTRACER_H
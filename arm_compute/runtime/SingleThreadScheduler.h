@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,8 @@ class SingleThreadScheduler final : public IScheduler
 public:
     /** Constructor. */
     SingleThreadScheduler() = default;
+    /** Destructor: wait for the asynchronous kernels to complete */
+    ~SingleThreadScheduler();
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
      * @param[in] num_threads This is ignored for this scheduler as the number of threads is always one.
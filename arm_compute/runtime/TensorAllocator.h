@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2019, 2024-2025 Arm Limited.
+ * Copyright (c) 2016-2019, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
  * @publicapi
  */
 
+#include "arm_compute/runtime/IAllocator.h"
 #include "arm_compute/runtime/ITensorAllocator.h"
 #include "arm_compute/runtime/Memory.h"
 #include "arm_compute/runtime/MemoryGroup.h"
@@ -116,6 +117,19 @@ public:
      * @param[in] associated_memory_group Memory group to associate the tensor with
      */
     void set_associated_memory_group(IMemoryGroup *associated_memory_group);
+    /** Set the allocator used on the calling thread to allocate the tensors which aren't memory managed
+     *
+     * This allows placing persistent memory such as weights, and their transformed versions created when functions
+     * are prepared, with a specific allocator (e.g. @ref NumaAllocator).
+     *
+     * @param[in] allocator Allocator to use. nullptr restores the default allocation.
+     */
+    static void set_thread_allocator(IAllocator *allocator);
+    /** Return the allocator used on the calling thread to allocate the tensors which aren't memory managed
+     *
+     * @return The allocator, nullptr if the default allocation is used
+     */
+    static IAllocator *thread_allocator();
 
 protected:
     /** No-op for CPU memory
@@ -131,6 +145,9 @@ private:
     IMemoryManageable *_owner;                   /**< Memory manageable object that owns the allocator */
     IMemoryGroup      *_associated_memory_group; /**< Registered memory manager */
     Memory             _memory;                  /**< CPU memory */
+#ifndef BARE_METAL
+    static thread_local IAllocator *_thread_allocator; /**< Allocator of the calling thread */
+#endif // BARE_METAL
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_TENSORALLOCATOR_H
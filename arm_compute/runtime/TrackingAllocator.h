@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_TRACKINGALLOCATOR_H
+#define ACL_ARM_COMPUTE_RUNTIME_TRACKINGALLOCATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+namespace arm_compute
+{
+/** Allocator forwarding to another allocator and tracking the bytes held by the memory it returned
+ *
+ * Each allocation is accounted to the tag which is current when it is made, until it is freed, so that the memory held
+ * by the different users of the allocator can be told apart. Set as the allocator of a thread with
+ * @ref TensorAllocator::set_thread_allocator, it tracks the tensors allocated outside of memory managers while functions
+ * are configured and prepared, e.g. their reshaped weights.
+ */
+class TrackingAllocator final : public IAllocator
+{
+public:
+    /** Tag of the allocations which aren't accounted to a user */
+    static constexpr size_t no_tag = std::numeric_limits<size_t>::max();
+
+    /** Constructor
+     *
+     * @param[in] allocator (Optional) Allocator to forward the allocations to. If nullptr, memory is allocated like
+     *                      the tensors of a thread without allocator are.
+     */
+    explicit TrackingAllocator(IAllocator *allocator = nullptr);
+    /** Destructor
+     *
+     * @note The memory regions made by the allocator can outlive it.
+     */
+    ~TrackingAllocator();
+    /** Prevent instances of this class from being copied */
+    TrackingAllocator(const TrackingAllocator &) = delete;
+    /** Prevent instances of this class from being copied */
+    TrackingAllocator &operator=(const TrackingAllocator &) = delete;
+
+    /** Set the tag to account the next allocations to
+     *
+     * @param[in] tag Tag of the next allocations, @ref no_tag to not account them to a user
+     */
+    void set_tag(size_t tag);
+    /** Bytes held by the memory allocated with a given tag and not freed yet
+     *
+     * @param[in] tag Tag of the allocations
+     *
+     * @return The number of bytes held
+     */
+    size_t bytes_held(size_t tag) const;
+    /** Bytes held by all the memory allocated and not freed yet, whatever its tag
+     *
+     * @return The number of bytes held
+     */
+    size_t bytes_held() const;
+
+    // Inherited methods overridden:
+    void                          *allocate(size_t size, size_t alignment) override;
+    void                           free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    struct Counters;
+
+    IAllocator               *_allocator;
+    // Shared with the memory regions, which can outlive the allocator
+    std::shared_ptr<Counters> _counters;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_TRACKINGALLOCATOR_H
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_WORKSPACEARENA_H
+#define ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_WORKSPACEARENA_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace experimental
+{
+/** Single memory arena holding the workspaces of a sequence of operators
+ *
+ * The operators of @ref arm_compute::experimental::op need their auxiliary tensors (see IOperator::workspace()) to be
+ * passed in the tensor packs of prepare() and run(). This class plans these tensors for a sequence of operators which
+ * are prepared and run one at a time, and backs them with a single allocation:
+ * - Persistent tensors get their own region, as they hold the prepared weights until the arena is destroyed.
+ * - Temporary and Prepare tensors are only used while an operator runs or prepares. They are placed in a region
+ *   shared by all the operators, which is as large as the biggest needs of a single operator. The Prepare tensors of
+ *   an operator don't overlap its Temporary tensors, since operators can prepare themselves on their first run.
+ *
+ * Usage:
+ * @code{.cpp}
+ * WorkspaceArena arena;
+ * const unsigned int gemm_id = arena.add_operator(gemm.workspace());
+ * const unsigned int conv_id = arena.add_operator(conv.workspace());
+ * arena.allocate();
+ * arena.add_workspace(gemm_id, gemm_run_pack, gemm_prep_pack);
+ * arena.add_workspace(conv_id, conv_run_pack, conv_prep_pack);
+ * @endcode
+ *
+ * @note The operators sharing an arena must not run concurrently.
+ */
+class WorkspaceArena
+{
+public:
+    /** Default constructor */
+    WorkspaceArena();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    WorkspaceArena(const WorkspaceArena &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    WorkspaceArena &operator=(const WorkspaceArena &) = delete;
+    /** Default move constructor */
+    WorkspaceArena(WorkspaceArena &&) = default;
+    /** Default move assignment operator */
+    WorkspaceArena &operator=(WorkspaceArena &&) = default;
+    /** Default destructor */
+    ~WorkspaceArena();
+    /** Append an operator to the sequence sharing the arena
+     *
+     * @note Must be called before @ref allocate
+     *
+     * @param[in] mem_reqs Workspace requirements of the operator
+     *
+     * @return Identifier of the operator in the arena
+     */
+    unsigned int add_operator(const MemoryRequirements &mem_reqs);
+    /** Plan the workspace tensors of the operators and allocate the arena
+     *
+     * @param[in] allocator (Optional) Allocator backing the arena. If nullptr, @ref Allocator is used
+     */
+    void allocate(IAllocator *allocator = nullptr);
+    /** Add the workspace tensors of an operator to its tensor packs
+     *
+     * All the tensors are added to @p run_pack, the Persistent and Prepare ones are added to @p prep_pack as well.
+     *
+     * @note Must be called after @ref allocate
+     *
+     * @param[in]     id        Identifier of the operator returned by @ref add_operator
+     * @param[in,out] run_pack  Tensor pack passed to run()
+     * @param[in,out] prep_pack Tensor pack passed to prepare()
+     */
+    void add_workspace(unsigned int id, ITensorPack &run_pack, ITensorPack &prep_pack);
+    /** Size in bytes of the arena
+     *
+     * @return Size of the persistent and shared regions
+     */
+    size_t size() const;
+    /** Size in bytes of the region holding the Persistent tensors
+     *
+     * @return Size of the persistent region
+     */
+    size_t persistent_size() const;
+    /** Sum of the sizes of the workspace tensors, which is what allocating each of them separately would use
+     *
+     * @return Size in bytes
+     */
+    size_t unshared_size() const;
+
+private:
+    struct Slot
+    {
+        MemoryInfo              info{};
+        size_t                  offset{0};
+        std::unique_ptr<Tensor> tensor{nullptr};
+    };
+
+    std::vector<std::vector<Slot>> _operators;
+    std::unique_ptr<IMemoryRegion> _region;
+    size_t                         _persistent_size;
+    size_t                         _shared_size;
+    size_t                         _alignment;
+};
+} // namespace experimental
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_WORKSPACEARENA_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021 Arm Limited.
+ * Copyright (c) 2019-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -215,8 +215,21 @@ public:
         config.use_synthetic_type = arm_compute::is_data_type_quantized(common_params.data_type);
         config.synthetic_type     = common_params.data_type;
 
+        config.use_interval_memory_planner = common_params.memory_planner;
+        config.record_memory_footprint     = common_params.memory_footprint;
+
         graph.finalize(common_params.target, config);
 
+        // Report the memory saved by the memory planner
+        if (common_params.memory_planner)
+        {
+            print_memory_planner_report(std::cout, graph.context());
+        }
+        if (common_params.memory_footprint)
+        {
+            print_memory_footprint(std::cout, graph.graph(), graph.context());
+        }
+
         return true;
     }
     void do_run() override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited.
+ * Copyright (c) 2020-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -78,11 +78,24 @@ public:
         config.tuner_file  = common_params.tuner_file;
         config.mlgo_file   = common_params.mlgo_file;
 
+        config.use_interval_memory_planner = common_params.memory_planner;
+        config.record_memory_footprint     = common_params.memory_footprint;
+
         context.set_config(config);
 
         auto pass_manager = create_default_pass_manager(common_params.target, config);
         manager.finalize_graph(model.graph(), context, pass_manager, common_params.target);
 
+        // Report the memory saved by the memory planner
+        if (common_params.memory_planner)
+        {
+            arm_compute::graph_utils::print_memory_planner_report(std::cout, context);
+        }
+        if (common_params.memory_footprint)
+        {
+            arm_compute::graph_utils::print_memory_footprint(std::cout, model.graph(), context);
+        }
+
         return true;
     }
 
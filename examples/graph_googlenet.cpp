@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -162,14 +162,28 @@ public:
 
         // Finalize graph
         GraphConfig config;
-        config.num_threads = common_params.threads;
-        config.use_tuner   = common_params.enable_tuner;
-        config.tuner_mode  = common_params.tuner_mode;
-        config.tuner_file  = common_params.tuner_file;
-        config.mlgo_file   = common_params.mlgo_file;
+        config.num_threads             = common_params.threads;
+        config.use_tuner               = common_params.enable_tuner;
+        config.tuner_mode              = common_params.tuner_mode;
+        config.tuner_file              = common_params.tuner_file;
+        config.mlgo_file               = common_params.mlgo_file;
+        config.max_concurrent_branches = common_params.branches;
+
+        config.use_interval_memory_planner = common_params.memory_planner;
+        config.record_memory_footprint     = common_params.memory_footprint;
 
         graph.finalize(common_params.target, config);
 
+        // Report the memory saved by the memory planner
+        if (common_params.memory_planner)
+        {
+            print_memory_planner_report(std::cout, graph.context());
+        }
+        if (common_params.memory_footprint)
+        {
+            print_memory_footprint(std::cout, graph.graph(), graph.context());
+        }
+
         return true;
     }
     void do_run() override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -225,8 +225,21 @@ public:
         config.tuner_file  = common_params.tuner_file;
         config.mlgo_file   = common_params.mlgo_file;
 
+        config.use_interval_memory_planner = common_params.memory_planner;
+        config.record_memory_footprint     = common_params.memory_footprint;
+
         graph.finalize(common_params.target, config);
 
+        // Report the memory saved by the memory planner
+        if (common_params.memory_planner)
+        {
+            print_memory_planner_report(std::cout, graph.context());
+        }
+        if (common_params.memory_footprint)
+        {
+            print_memory_footprint(std::cout, graph.graph(), graph.context());
+        }
+
         return true;
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,8 @@
 #include "src/common/utils/Macros.h"
 #include "src/common/utils/Validate.h"
 
+#include <vector>
+
 namespace
 {
 /** Check if queue options are valid
@@ -40,6 +42,29 @@ bool is_mode_valid(const AclQueueOptions *options)
     ARM_COMPUTE_ASSERT_NOT_NULLPTR(options);
     return arm_compute::utils::is_in(options->mode, {AclTuningModeNone, AclRapid, AclNormal, AclExhaustive});
 }
+
+/** Check if the CPU set of the queue options is valid
+ *
+ * @param[in] options Queue options
+ *
+ * @return true in case of success else false
+ */
+bool is_cpu_set_valid(const AclQueueCpuSetOptions *options)
+{
+    ARM_COMPUTE_ASSERT_NOT_NULLPTR(options);
+    if (options->cpu_ids == nullptr || options->num_cpu_ids <= 0)
+    {
+        return false;
+    }
+    for (int32_t i = 0; i < options->num_cpu_ids; ++i)
+    {
+        if (options->cpu_ids[i] < 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
 } // namespace
 
 extern "C" AclStatus AclCreateQueue(AclQueue *external_queue, AclContext external_ctx, const AclQueueOptions *options)
@@ -69,6 +94,42 @@ extern "C" AclStatus AclCreateQueue(AclQueue *external_queue, AclContext externa
     return AclSuccess;
 }
 
+extern "C" AclStatus
+AclCreateQueueOnCpuSet(AclQueue *external_queue, AclContext external_ctx, const AclQueueCpuSetOptions *options)
+{
+    using namespace arm_compute;
+
+    auto ctx = get_internal(external_ctx);
+
+    StatusCode status = detail::validate_internal_context(ctx);
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+
+    if (ctx->type() != Target::Cpu)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Queues can only be bound to CPU cores on a CPU context");
+        return AclUnsupportedTarget;
+    }
+
+    if (options == nullptr || !is_mode_valid(&options->opts) || !is_cpu_set_valid(options))
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Queue options are invalid");
+        return AclInvalidArgument;
+    }
+
+    const std::vector<int32_t> cpu_ids(options->cpu_ids, options->cpu_ids + options->num_cpu_ids);
+
+    auto queue = ctx->create_cpu_set_queue(&options->opts, cpu_ids);
+    if (queue == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Couldn't allocate internal resources");
+        return AclOutOfMemory;
+    }
+
+    *external_queue = queue;
+
+    return AclSuccess;
+}
+
 extern "C" AclStatus AclQueueFinish(AclQueue external_queue)
 {
     using namespace arm_compute;
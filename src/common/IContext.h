@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021,2023 Arm Limited.
+ * Copyright (c) 2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,12 +24,15 @@
 #ifndef SRC_COMMON_ICONTEXT_H
 #define SRC_COMMON_ICONTEXT_H
 
+#include "arm_compute/core/Error.h"
+
 #include "src/common/Types.h"
 #include "src/common/utils/Log.h"
 #include "src/common/utils/Object.h"
 
 #include <atomic>
 #include <tuple>
+#include <vector>
 
 struct AclContext_
 {
@@ -112,6 +115,18 @@ public:
                                                                   const AclTensorDescriptor     &dst,
                                                                   const AclActivationDescriptor &act,
                                                                   bool                           is_validate)          = 0;
+    /** Create a queue object bound to a set of CPU cores
+     *
+     * @param[in] options Queue options to be used
+     * @param[in] cpu_ids CPU cores the queue is bound to
+     *
+     * @return A pointer to the created queue object, nullptr if the context doesn't support binding queues to cores
+     */
+    virtual IQueue *create_cpu_set_queue(const AclQueueOptions *options, const std::vector<int32_t> &cpu_ids)
+    {
+        ARM_COMPUTE_UNUSED(options, cpu_ids);
+        return nullptr;
+    }
 
 private:
     Target                   _target;   /**< Target type of context */
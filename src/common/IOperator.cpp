@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,9 +54,7 @@ StatusCode IOperator::run(ITensorPack &tensors)
 
 StatusCode IOperator::run(IQueue &queue, ITensorPack &tensors)
 {
-    ARM_COMPUTE_UNUSED(queue);
-    _op->run(tensors);
-    return StatusCode::Success;
+    return queue.run(*_op, tensors);
 }
 
 StatusCode IOperator::prepare(ITensorPack &tensors)
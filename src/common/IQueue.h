@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,9 @@
 #ifndef SRC_COMMON_IQUEUE_H_
 #define SRC_COMMON_IQUEUE_H_
 
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/runtime/IOperator.h"
+
 #include "src/common/IContext.h"
 
 struct AclQueue_
@@ -64,6 +67,18 @@ public:
     {
         return this->header.type == detail::ObjectType::Queue;
     };
+    /** Run an operator on the queue
+     *
+     * @param[in] op      Operator to run
+     * @param[in] tensors Vector that contains the tensors to operate on
+     *
+     * @return Status code
+     */
+    virtual StatusCode run(experimental::IOperator &op, ITensorPack &tensors)
+    {
+        op.run(tensors);
+        return StatusCode::Success;
+    }
     virtual StatusCode finish() = 0;
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include "support/StringSupport.h"
 #include "support/ToolchainSupport.h"
 
+#include <cctype>
 #include <map>
 #include <sstream>
 
@@ -344,6 +345,158 @@ uint64_t get_sve_feature_reg()
     return svefr0;
 }
 #endif /* defined(BARE_METAL) && defined(__aarch64__) */
+
+#if !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__)
+/** Read the first line of a sysfs file
+ *
+ * @param[in]  path Path of the file
+ * @param[out] line First line of the file
+ *
+ * @return True if the file could be read
+ */
+bool read_sysfs_line(const std::string &path, std::string &line)
+{
+    std::ifstream file(path, std::ios::in);
+    return file.is_open() && bool(getline(file, line));
+}
+
+/** Parse a cache size of the sysfs cache description, e.g. "64K"
+ *
+ * @param[in] str Size to parse
+ *
+ * @return The size in bytes, 0 if it can't be parsed
+ */
+uint32_t parse_cache_size(const std::string &str)
+{
+    if (str.empty() || !std::isdigit(static_cast<unsigned char>(str[0])))
+    {
+        return 0;
+    }
+    size_t         pos  = 0;
+    const uint32_t size = support::cpp11::stoul(str, &pos);
+    if (pos < str.size() && (str[pos] == 'K' || str[pos] == 'k'))
+    {
+        return size * 1024;
+    }
+    if (pos < str.size() && (str[pos] == 'M' || str[pos] == 'm'))
+    {
+        return size * 1024 * 1024;
+    }
+    return size;
+}
+
+/** Count the CPUs of a sysfs CPU list, e.g. "0-3,8"
+ *
+ * @param[in] list CPU list to parse
+ *
+ * @return The number of CPUs in the list, at least 1
+ */
+uint32_t count_cpu_list(const std::string &list)
+{
+    uint32_t          num_cpus = 0;
+    std::stringstream ss(list);
+    std::string       range;
+    while (getline(ss, range, ','))
+    {
+        if (range.empty() || !std::isdigit(static_cast<unsigned char>(range[0])))
+        {
+            continue;
+        }
+        const size_t   dash  = range.find('-');
+        const uint32_t first = support::cpp11::stoul(range.substr(0, dash));
+        const uint32_t last  = dash == std::string::npos ? first : support::cpp11::stoul(range.substr(dash + 1));
+        num_cpus += last >= first ? last - first + 1 : 1;
+    }
+    return std::max(num_cpus, 1U);
+}
+
+/** Read the data and unified caches of the CPUs from sysfs
+ *
+ * The L1 and L2 sizes are the smallest of all the CPUs, so that blocks sized from them fit in the caches of every core
+ * of heterogeneous systems. The L2 size is divided between the CPUs sharing it. The L3 is the largest cache beyond L2.
+ *
+ * @param[in] max_num_cpus Maximum number of possible CPUs
+ *
+ * @return The sizes of the caches, 0 for the ones which aren't described
+ */
+CpuCacheInfo caches_from_sysfs(uint32_t max_num_cpus)
+{
+    const auto min_size = [](uint32_t current, uint32_t size) { return current == 0 ? size : std::min(current, size); };
+
+    CpuCacheInfo caches{};
+    for (uint32_t cpu = 0; cpu < max_num_cpus; ++cpu)
+    {
+        for (unsigned int index = 0;; ++index)
+        {
+            std::stringstream str;
+            str << "/sys/devices/system/cpu/cpu" << cpu << "/cache/index" << index << "/";
+            const std::string dir = str.str();
+
+            std::string level;
+            std::string type;
+            std::string size_str;
+            std::string shared_cpus;
+            if (!read_sysfs_line(dir + "level", level) || !read_sysfs_line(dir + "type", type))
+            {
+                break;
+            }
+            const uint32_t size = read_sysfs_line(dir + "size", size_str) ? parse_cache_size(size_str) : 0;
+            if (type == "Instruction" || size == 0 || level.empty() ||
+                !std::isdigit(static_cast<unsigned char>(level[0])))
+            {
+                continue;
+            }
+            const uint32_t num_cpus =
+                read_sysfs_line(dir + "shared_cpu_list", shared_cpus) ? count_cpu_list(shared_cpus) : 1;
+
+            switch (support::cpp11::stoi(level))
+            {
+                case 1:
+                    caches.l1d_size = min_size(caches.l1d_size, size);
+                    break;
+                case 2:
+                    caches.l2_size = min_size(caches.l2_size, size / num_cpus);
+                    break;
+                default:
+                    if (size > caches.l3_size)
+                    {
+                        caches.l3_size     = size;
+                        caches.l3_num_cpus = num_cpus;
+                    }
+                    break;
+            }
+        }
+    }
+    return caches;
+}
+#endif /* !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__) */
+
+/** Detect the sizes of the data caches
+ *
+ * @note The cache ID registers can't be read from user space, so the sizes are read from the description of the
+ *       caches provided by the operating system.
+ *
+ * @param[in] num_cpus Number of CPUs
+ *
+ * @return The sizes of the caches, 0 for the ones which can't be detected
+ */
+CpuCacheInfo detect_caches(uint32_t num_cpus)
+{
+#if defined(__aarch64__) && defined(__APPLE__)
+    ARM_COMPUTE_UNUSED(num_cpus);
+    CpuCacheInfo caches{};
+    const int l2_size     = get_hw_capability("hw.perflevel0.l2cachesize");
+    const int l2_num_cpus = get_hw_capability("hw.perflevel0.cpusperl2");
+    caches.l1d_size       = get_hw_capability("hw.perflevel0.l1dcachesize");
+    caches.l2_size        = l2_size / std::max(l2_num_cpus, 1);
+    return caches;
+#elif !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__)
+    return caches_from_sysfs(num_cpus);
+#else  /* defined(__aarch64__) && defined(__APPLE__) */
+    ARM_COMPUTE_UNUSED(num_cpus);
+    return CpuCacheInfo{};
+#endif /* defined(__aarch64__) && defined(__APPLE__) */
+}
 } // namespace
 
 CpuInfo::CpuInfo(CpuIsaInfo isa, std::vector<CpuModel> cpus) : _isa(std::move(isa)), _cpus(std::move(cpus))
@@ -351,6 +504,13 @@ CpuInfo::CpuInfo(CpuIsaInfo isa, std::vector<CpuModel> cpus) : _isa(std::move(is
 }
 
 CpuInfo CpuInfo::build()
+{
+    CpuInfo info = build_isa_and_models();
+    info._caches = detect_caches(info.num_cpus());
+    return info;
+}
+
+CpuInfo CpuInfo::build_isa_and_models()
 {
 #if !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) && \
     (defined(__arm__) || defined(__aarch64__))
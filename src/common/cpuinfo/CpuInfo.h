@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2021-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,15 @@ namespace arm_compute
 {
 namespace cpuinfo
 {
+/** Sizes of the data caches seen by the cores, 0 when unknown */
+struct CpuCacheInfo
+{
+    uint32_t l1d_size{0};    /**< Size in bytes of the L1 data cache */
+    uint32_t l2_size{0};     /**< Size in bytes of the L2 cache available to each core */
+    uint32_t l3_size{0};     /**< Size in bytes of the cache beyond L2 (L3 or system level cache) */
+    uint32_t l3_num_cpus{0}; /**< Number of CPUs sharing the cache beyond L2 */
+};
+
 /** Aggregate class that contains CPU related information
  *
  * Contains information about the numbers of the CPUs, the model of each CPU,
@@ -120,6 +129,10 @@ public:
     {
         return _cpus;
     }
+    const CpuCacheInfo &caches() const
+    {
+        return _caches;
+    }
 
     CpuModel cpu_model(uint32_t cpuid) const;
     CpuModel cpu_model() const;
@@ -127,8 +140,15 @@ public:
     uint32_t not_little_num_cpus() const;
 
 private:
+    /** Build the ISA and CPU models information from system related information
+     *
+     * @return CpuInfo A CpuInfo structure without the caches information
+     */
+    static CpuInfo build_isa_and_models();
+
     CpuIsaInfo            _isa{};
     std::vector<CpuModel> _cpus{};
+    CpuCacheInfo          _caches{};
 };
 
 /** Some systems have both big and small cores, this fuction computes the minimum number of cores
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -77,6 +77,37 @@ bool model_supports_dot(CpuModel model)
     }
 }
 
+float model_capacity(CpuModel model)
+{
+    // Sustained Neon throughput per core at typical mobile/server frequencies
+    switch (model)
+    {
+        case CpuModel::A35:
+            return 0.3f;
+        case CpuModel::A53:
+            return 0.35f;
+        case CpuModel::A55r0:
+        case CpuModel::A55r1:
+            return 0.4f;
+        case CpuModel::A510:
+            return 0.5f;
+        case CpuModel::A73:
+            return 0.7f;
+        case CpuModel::X1:
+            return 1.4f;
+        case CpuModel::V1:
+        case CpuModel::A64FX:
+            return 1.6f;
+        case CpuModel::A76:
+        case CpuModel::N1:
+        case CpuModel::GENERIC:
+        case CpuModel::GENERIC_FP16:
+        case CpuModel::GENERIC_FP16_DOT:
+        default:
+            return 1.0f;
+    }
+}
+
 CpuModel midr_to_model(uint32_t midr)
 {
     CpuModel model = CpuModel::GENERIC;
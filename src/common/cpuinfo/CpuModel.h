@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,6 +66,16 @@ bool model_supports_fp16(CpuModel model);
  * @param[in] model Model to check for allowlisted capabilities
  */
 bool model_supports_dot(CpuModel model);
+
+/** Calibrated throughput of a model relative to a Cortex-A76 core
+ *
+ * @note This is used to balance the work between cores of different types on heterogeneous systems.
+ *
+ * @param[in] model Model to get the capacity of
+ *
+ * @return The relative capacity of the model
+ */
+float model_capacity(CpuModel model);
 } // namespace cpuinfo
 } // namespace arm_compute
 #endif /* SRC_COMMON_CPUINFO_CPUMODEL_H */
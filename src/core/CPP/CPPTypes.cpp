@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,8 @@ struct CPUInfo::Impl
     cpuinfo::CpuInfo info{};
     unsigned int     L1_cache_size = 32768;
     unsigned int     L2_cache_size = 262144;
+    unsigned int     L3_cache_size = 0;
+    unsigned int     L3_num_cpus   = 0;
 };
 
 CPUInfo &CPUInfo::get()
@@ -48,6 +50,19 @@ CPUInfo &CPUInfo::get()
 CPUInfo::CPUInfo() : _impl(std::make_unique<Impl>())
 {
     _impl->info = cpuinfo::CpuInfo::build();
+
+    // Keep the defaults for the caches which can't be detected
+    const cpuinfo::CpuCacheInfo &caches = _impl->info.caches();
+    if (caches.l1d_size != 0)
+    {
+        _impl->L1_cache_size = caches.l1d_size;
+    }
+    if (caches.l2_size != 0)
+    {
+        _impl->L2_cache_size = caches.l2_size;
+    }
+    _impl->L3_cache_size = caches.l3_size;
+    _impl->L3_num_cpus   = caches.l3_num_cpus;
 }
 
 CPUInfo::~CPUInfo() = default;
@@ -142,6 +157,27 @@ unsigned int CPUInfo::get_L2_cache_size() const
     return _impl->L2_cache_size;
 }
 
+unsigned int CPUInfo::get_L3_cache_size() const
+{
+    return _impl->L3_cache_size;
+}
+
+unsigned int CPUInfo::get_L3_cache_shared_cpus() const
+{
+    return _impl->L3_num_cpus;
+}
+
+void CPUInfo::set_cache_sizes(unsigned int L1_size,
+                              unsigned int L2_size,
+                              unsigned int L3_size,
+                              unsigned int L3_num_cpus)
+{
+    _impl->L1_cache_size = L1_size;
+    _impl->L2_cache_size = L2_size;
+    _impl->L3_cache_size = L3_size;
+    _impl->L3_num_cpus   = L3_num_cpus;
+}
+
 uint64_t CPUInfo::get_sme2_vector_length_in_bytes() const
 {
 #ifdef ARM_COMPUTE_ENABLE_SME2
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -454,6 +454,7 @@ class GemmInterleaved : public GemmCommon<Tlo, Tro, Tr> {
     /* Blocking info */
     unsigned int _k_block=0;
     unsigned int _x_block=0;
+    unsigned int _m_block=0;
     unsigned int _Mround=0;
 
     /* Working space, pretransposed buffer, buffer manager */
@@ -801,6 +802,49 @@ class GemmInterleaved : public GemmCommon<Tlo, Tro, Tr> {
         return x_block;
     }
 
+    // Number of rows processed through all the K and X blocks before moving on to the next rows, or 0 to process all
+    // the rows of a thread together.
+    static unsigned int get_m_block_size(const GemmArgs &args) {
+        // No M blocking in 2D mode, which already processes one strip of rows at a time, or for SME.
+        if (is_thread_columns(args) || is_sme<strategy>::value) {
+            return 0;
+        }
+
+        if (args._cfg && args._cfg->m_block_size) {
+            return roundup(args._cfg->m_block_size, strategy::out_height());
+        }
+
+        const unsigned int L3_size = args._ci->get_L3_cache_size();
+
+        if (L3_size == 0) {
+            return 0;
+        }
+
+        // m_block: Work out how many rows (of length k_block) will fit in the share of the L3 of each thread.
+        // Only use half of that share, to allow for the B blocks and results streaming through the cache.
+        const unsigned int num_sharing = std::max(std::min(static_cast<unsigned int>(args._maxthreads), args._ci->get_L3_cache_shared_cpus()), 1u);
+        const unsigned int L3_share    = (L3_size / 2) / num_sharing;
+
+        unsigned int k_depth = get_k_block_size(args);
+
+        if (std::is_same<OutputStage, Requantize32>::value) {
+            k_depth += sizeof(int32_t) / sizeof(Tloi);
+        }
+
+        unsigned int m_block = L3_share / (sizeof(Tloi) * k_depth);
+
+        // Needs to be a multiple of the kernel output height.
+        m_block = (m_block / strategy::out_height()) * strategy::out_height();
+
+        // Blocking M means reading B once per M block rather than reading A once per X block, which only pays off if
+        // the M block is larger than the X block.  There's also nothing to gain if all the rows fit anyway.
+        if (m_block <= get_x_block_size(args) || m_block >= roundup(args._Msize, strategy::out_height()) * args._nbatches) {
+            return 0;
+        }
+
+        return m_block;
+    }
+
 public:
     GemmInterleaved(GemmInterleaved &) = delete;
     GemmInterleaved & operator= (GemmInterleaved &) = delete;
@@ -812,7 +856,8 @@ public:
                       _rounded_Ksize(roundup(_Ksize, strategy::k_unroll())),
                       _nbatches(args._nbatches), _nmulti(args._nmulti), _thread_columns(is_thread_columns(args)),
                       _act(args._act), _accumulate(args._accumulate), _maxthreads(args._maxthreads), _nthreads(args._maxthreads),
-                      _k_block(get_k_block_size(args)), _x_block(get_x_block_size(args)), _Mround(roundup(args._Msize, strategy::out_height())),
+                      _k_block(get_k_block_size(args)), _x_block(get_x_block_size(args)),
+                      _m_block(get_m_block_size(args)), _Mround(roundup(args._Msize, strategy::out_height())),
                       _os(os) { }
 
     /* Constructor without OutputStage */
@@ -822,7 +867,8 @@ public:
                       _rounded_Ksize(roundup(_Ksize, strategy::k_unroll())),
                       _nbatches(args._nbatches), _nmulti(args._nmulti), _thread_columns(is_thread_columns(args)),
                       _act(args._act), _accumulate(args._accumulate), _maxthreads(args._maxthreads), _nthreads(args._maxthreads),
-                      _k_block(get_k_block_size(args)), _x_block(get_x_block_size(args)), _Mround(roundup(args._Msize, strategy::out_height())),
+                      _k_block(get_k_block_size(args)), _x_block(get_x_block_size(args)),
+                      _m_block(get_m_block_size(args)), _Mround(roundup(args._Msize, strategy::out_height())),
                       _os() { }
 
     // Interface implementation - Compulsory functions
@@ -975,12 +1021,6 @@ public:
                 }
             }
         } else {
-            blockwalker current(*this);
-
-            /* Compute the M values to operate on */
-            unsigned int m_0   = (start - (batch_0 * window_per_batch)) * strategy::out_height();
-            unsigned int m_max = (end - (batch_end * window_per_batch)) * strategy::out_height();
-
             // Private buffers.  Treat working_space as an array of C buffers
             // (one per thread) first, followed by the (window-divided) A
             // buffer.
@@ -988,140 +1028,158 @@ public:
             Tloi * const a_panel = reinterpret_cast<Tloi *>(working_space_bytes + (_maxthreads * get_c_working_size()));
             Tri * const c_panel = reinterpret_cast<Tri *>(working_space_bytes + (threadid * get_c_working_size()));
 
-            const Troi *b_panel;
-            b_panel = _B_transposed;
+            // Process the rows in M blocks, each of which goes through all the K and X blocks, so that the A panel of
+            // the block stays in the L3 while it is reused for every X block.  Without M blocking this is a single
+            // block covering the whole range.
+            const unsigned int m_block_window = (_m_block > 0) ? (_m_block / strategy::out_height()) : (end - start);
+
+            for (unsigned int block_start=start; block_start<end; block_start+=m_block_window) {
+                const unsigned int block_end = std::min<unsigned int>(block_start + m_block_window, end);
+
+                batch_0   = block_start / window_per_batch;
+                batch_end = block_end   / window_per_batch;
+
+                blockwalker current(*this);
+
+                /* Compute the M values to operate on */
+                unsigned int m_0   = (block_start - (batch_0 * window_per_batch)) * strategy::out_height();
+                unsigned int m_max = (block_end - (batch_end * window_per_batch)) * strategy::out_height();
+
+                const Troi *b_panel;
+                b_panel = _B_transposed;
 
-            // newkblock() is always true on the first iteration, so these will be set properly on the first loop.
+                // newkblock() is always true on the first iteration, so these will be set properly on the first loop.
 
-            // kern_k tracks the accumulation depth for the CURRENT K block a_panel_stride similarly tracks the total
-            // stride of the A panel (i.e.  with 4 added for cases with embedded row sums)
+                // kern_k tracks the accumulation depth for the CURRENT K block a_panel_stride similarly tracks the total
+                // stride of the A panel (i.e.  with 4 added for cases with embedded row sums)
 
-            // These are distinct from k_block and get_total_k_depth() which are based on the target K block size, and
-            // used for addressing inside a_panel.
+                // These are distinct from k_block and get_total_k_depth() which are based on the target K block size, and
+                // used for addressing inside a_panel.
 
-            // In cases where K blocking is in use and the blocks are not all the same size, the (smaller) final block
-            // won't use all the memory allocated.
-            unsigned int kern_k = 0;
-            unsigned int a_panel_stride = 0;
+                // In cases where K blocking is in use and the blocks are not all the same size, the (smaller) final block
+                // won't use all the memory allocated.
+                unsigned int kern_k = 0;
+                unsigned int a_panel_stride = 0;
 
-            for (;!current.done();current.advance()) {
-                if (current.newkblock()) {
+                for (;!current.done();current.advance()) {
+                    if (current.newkblock()) {
 #ifdef CYCLE_PROFILING
-                    auto p=prof.ScopedProfiler(PROFILE_PREPA, (end - start) * strategy::out_height() * (current.kmax()-current.k0()) * sizeof(Tloi));
+                        auto p=prof.ScopedProfiler(PROFILE_PREPA, (block_end - block_start) * strategy::out_height() * (current.kmax()-current.k0()) * sizeof(Tloi));
 #endif
-                    // See comment above on transform_type<> class: this extracts either 'transforms' or
-                    // 'transforms_quantized' as appropriate.
-                    typename transform_type<strategy, MergeStep && std::is_same<OutputStage, Requantize32>::value>::type transforms;
+                        // See comment above on transform_type<> class: this extracts either 'transforms' or
+                        // 'transforms_quantized' as appropriate.
+                        typename transform_type<strategy, MergeStep && std::is_same<OutputStage, Requantize32>::value>::type transforms;
 
-                    for (unsigned int batch = batch_0; batch <= batch_end; batch++) {
-                        unsigned int first_m = (batch == batch_0)   ? m_0   : 0;
-                        unsigned int last_m  = (batch == batch_end) ? m_max : _Msize;
+                        for (unsigned int batch = batch_0; batch <= batch_end; batch++) {
+                            unsigned int first_m = (batch == batch_0)   ? m_0   : 0;
+                            unsigned int last_m  = (batch == batch_end) ? m_max : _Msize;
 
-                        if (first_m >= last_m)
-                            continue;
+                            if (first_m >= last_m)
+                                continue;
 
-                        if (_indirect_buf != nullptr) {
-                            transforms.PrepareA_indirect(a_panel + ((batch * _Mround + first_m) * get_total_k_depth()),
-                                                      _indirect_buf + (current.multi() * _nbatches * _Ksections) + (batch * _Ksections), _Ksize,
-                                                      _rounded_Ksize, first_m, last_m, current.k0(), current.kmax(), row_sum_multiplier());
-                        } else if (_convolver) {
-                            transforms.PrepareA_convolution(a_panel + ((batch * _Mround + first_m) * get_total_k_depth()),
-                                                      g_arrays._Aptr + (batch * g_arrays._A_batch_stride) + (current.multi() * g_arrays._A_multi_stride),
-                                                      g_arrays._lda, *_convolver, _rounded_Ksize, first_m, last_m, current.k0(), current.kmax(), row_sum_multiplier());
-                        } else {
-                            transforms.PrepareA(a_panel + ((batch * _Mround + first_m) * get_total_k_depth()),
-                                                      g_arrays._Aptr + (batch * g_arrays._A_batch_stride) + (current.multi() * g_arrays._A_multi_stride),
-                                                      g_arrays._lda, first_m, last_m, current.k0(), std::min(_Ksize, current.kmax()), row_sum_multiplier());
+                            if (_indirect_buf != nullptr) {
+                                transforms.PrepareA_indirect(a_panel + ((batch * _Mround + first_m) * get_total_k_depth()),
+                                                          _indirect_buf + (current.multi() * _nbatches * _Ksections) + (batch * _Ksections), _Ksize,
+                                                          _rounded_Ksize, first_m, last_m, current.k0(), current.kmax(), row_sum_multiplier());
+                            } else if (_convolver) {
+                                transforms.PrepareA_convolution(a_panel + ((batch * _Mround + first_m) * get_total_k_depth()),
+                                                          g_arrays._Aptr + (batch * g_arrays._A_batch_stride) + (current.multi() * g_arrays._A_multi_stride),
+                                                          g_arrays._lda, *_convolver, _rounded_Ksize, first_m, last_m, current.k0(), current.kmax(), row_sum_multiplier());
+                            } else {
+                                transforms.PrepareA(a_panel + ((batch * _Mround + first_m) * get_total_k_depth()),
+                                                          g_arrays._Aptr + (batch * g_arrays._A_batch_stride) + (current.multi() * g_arrays._A_multi_stride),
+                                                          g_arrays._lda, first_m, last_m, current.k0(), std::min(_Ksize, current.kmax()), row_sum_multiplier());
+                            }
                         }
-                    }
 
-                    // Figure out how many "K" the kernel will actually process.
-                    kern_k = roundup(current.kmax() - current.k0(), strategy::k_unroll());
+                        // Figure out how many "K" the kernel will actually process.
+                        kern_k = roundup(current.kmax() - current.k0(), strategy::k_unroll());
 
-                    // Requantizing GEMMs have the row sums built in to the
-                    // transposed data, so the stride between rows is 4 bytes
-                    // larger than the (rounded) K value.
+                        // Requantizing GEMMs have the row sums built in to the
+                        // transposed data, so the stride between rows is 4 bytes
+                        // larger than the (rounded) K value.
 
-                    if(std::is_same<OutputStage, Requantize32>::value) {
-                        a_panel_stride = kern_k + (sizeof(int32_t) / sizeof(Tloi));
-                    } else {
-                        a_panel_stride = kern_k;
+                        if(std::is_same<OutputStage, Requantize32>::value) {
+                            a_panel_stride = kern_k + (sizeof(int32_t) / sizeof(Tloi));
+                        } else {
+                            a_panel_stride = kern_k;
+                        }
                     }
-                }
-
-                // For FixedFormat cases, figure out the B pointer.  The loop below moves through batches and vertically through the output so this will be the same throughout.
-                if (FixedFormat) {
-                    b_panel = reinterpret_cast<const Troi *>(g_arrays._Bptr) + (current.multi() * g_arrays._B_multi_stride) +
-                                                                           ((current.x0() / get_stripe_width<strategy, FixedFormat>::get()) * g_arrays._ldb) +
-                                                                           (current.k0() * get_stripe_width<strategy, FixedFormat>::get());
-                }
 
-                /* Do the actual work. */
-                for (unsigned int batch = batch_0; batch <= batch_end; batch++) {
-                    unsigned int first_m = (batch == batch_0)   ? m_0   : 0;
-                    unsigned int last_m  = (batch == batch_end) ? m_max : _Msize;
+                    // For FixedFormat cases, figure out the B pointer.  The loop below moves through batches and vertically through the output so this will be the same throughout.
+                    if (FixedFormat) {
+                        b_panel = reinterpret_cast<const Troi *>(g_arrays._Bptr) + (current.multi() * g_arrays._B_multi_stride) +
+                                                                               ((current.x0() / get_stripe_width<strategy, FixedFormat>::get()) * g_arrays._ldb) +
+                                                                               (current.k0() * get_stripe_width<strategy, FixedFormat>::get());
+                    }
 
-                    const Tloi *a_ptr = a_panel + (batch * _Mround + first_m) * get_total_k_depth();
+                    /* Do the actual work. */
+                    for (unsigned int batch = batch_0; batch <= batch_end; batch++) {
+                        unsigned int first_m = (batch == batch_0)   ? m_0   : 0;
+                        unsigned int last_m  = (batch == batch_end) ? m_max : _Msize;
 
-                    if (first_m >= last_m)
-                        continue;
+                        const Tloi *a_ptr = a_panel + (batch * _Mround + first_m) * get_total_k_depth();
 
-                    // For the merge case we need to do this out_height() rows
-                    // at a time, as that is the size of our intermediate
-                    // buffer.  If we are not doing that, we can do all the
-                    // relevant rows in one go.
-                    unsigned int m_step = MergeStep ? strategy::out_height() : (last_m - first_m);
+                        if (first_m >= last_m)
+                            continue;
 
-                    // But in the case where we have an accumulation buffer, we can't do that after all, unless
-                    // there is no N blocking.
-                    if (accumulation_buffer && ((current.x0() != 0) || (current.xmax() < _Nsize))) {
-                        m_step = strategy::out_height();
-                    }
+                        // For the merge case we need to do this out_height() rows
+                        // at a time, as that is the size of our intermediate
+                        // buffer.  If we are not doing that, we can do all the
+                        // relevant rows in one go.
+                        unsigned int m_step = MergeStep ? strategy::out_height() : (last_m - first_m);
 
-                    for (unsigned int y=first_m; y<last_m; y+=m_step) {
-                        unsigned int ymax = std::min(_Msize, y + m_step);
+                        // But in the case where we have an accumulation buffer, we can't do that after all, unless
+                        // there is no N blocking.
+                        if (accumulation_buffer && ((current.x0() != 0) || (current.xmax() < _Nsize))) {
+                            m_step = strategy::out_height();
+                        }
 
-                        const bool first_pass = (current.k0() == 0);
-                        const bool last_pass  = (current.kmax() == _Ktotal);
+                        for (unsigned int y=first_m; y<last_m; y+=m_step) {
+                            unsigned int ymax = std::min(_Msize, y + m_step);
 
-                        // Bias is passed for the first pass only, except for dequantizefloat nomerge cases where it's the last pass.
-                        const bool bias_pass = (std::is_same<OutputStage, DequantizeFloat>::value && !MergeStep) ? last_pass : first_pass;
+                            const bool first_pass = (current.k0() == 0);
+                            const bool last_pass  = (current.kmax() == _Ktotal);
 
-                        // Pointer to appropriate part of result array.
-                        Tr *result_ptr = g_arrays._Cptr + (batch * g_arrays._C_batch_stride) + (current.multi() * g_arrays._C_multi_stride);
+                            // Bias is passed for the first pass only, except for dequantizefloat nomerge cases where it's the last pass.
+                            const bool bias_pass = (std::is_same<OutputStage, DequantizeFloat>::value && !MergeStep) ? last_pass : first_pass;
 
-                        // If we are using an accumulation buffer, we don't pass the result buffer to ask the kernel
-                        // to write things into the accumulation buffer instead, except on the last pass.
-                        if (accumulation_buffer && !last_pass) {
-                            result_ptr = nullptr;
-                        }
+                            // Pointer to appropriate part of result array.
+                            Tr *result_ptr = g_arrays._Cptr + (batch * g_arrays._C_batch_stride) + (current.multi() * g_arrays._C_multi_stride);
 
-                        // Perform the kernel and merge step, either separately or together as required.
-                        kernel_and_merge<MergeStep, FixedFormat, OutputStage>::run(
-                        #ifdef CYCLE_PROFILING
-                            prof,
-                        #endif
-                            // Strategy and panel pointers
-                            strat, a_ptr, b_panel, g_arrays._ldb, c_panel,
-                            // Result buffer pointers
-                            result_ptr, g_arrays._ldc,
-                            // K size, and M/N ranges
-                            kern_k, y, ymax, current.x0(), current.xmax(),
-                            // Only do bias on the first pass
-                            ((bias_pass && g_arrays._bias) ? g_arrays._bias + (current.multi() * g_arrays._bias_multi_stride) : nullptr),
-                            // Only do activation on the last pass, and accumulation on any non-first pass.
-                            (last_pass ? _act : Activation()), (!first_pass || _accumulate),
-                            // Pass in quantization parameters for requantizing kernels (others will ignore)
-                            _os, col_bias + (current.multi() * _Nsize),
-                            // Accumulation buffer
-                            get_accumulation_buffer(accumulation_buffer, y, current.x0(), batch, current.multi()) );
+                            // If we are using an accumulation buffer, we don't pass the result buffer to ask the kernel
+                            // to write things into the accumulation buffer instead, except on the last pass.
+                            if (accumulation_buffer && !last_pass) {
+                                result_ptr = nullptr;
+                            }
 
-                        a_ptr += (strategy::out_height() * a_panel_stride);
+                            // Perform the kernel and merge step, either separately or together as required.
+                            kernel_and_merge<MergeStep, FixedFormat, OutputStage>::run(
+                            #ifdef CYCLE_PROFILING
+                                prof,
+                            #endif
+                                // Strategy and panel pointers
+                                strat, a_ptr, b_panel, g_arrays._ldb, c_panel,
+                                // Result buffer pointers
+                                result_ptr, g_arrays._ldc,
+                                // K size, and M/N ranges
+                                kern_k, y, ymax, current.x0(), current.xmax(),
+                                // Only do bias on the first pass
+                                ((bias_pass && g_arrays._bias) ? g_arrays._bias + (current.multi() * g_arrays._bias_multi_stride) : nullptr),
+                                // Only do activation on the last pass, and accumulation on any non-first pass.
+                                (last_pass ? _act : Activation()), (!first_pass || _accumulate),
+                                // Pass in quantization parameters for requantizing kernels (others will ignore)
+                                _os, col_bias + (current.multi() * _Nsize),
+                                // Accumulation buffer
+                                get_accumulation_buffer(accumulation_buffer, y, current.x0(), batch, current.multi()) );
+
+                            a_ptr += (strategy::out_height() * a_panel_stride);
+                        }
                     }
-                }
 
-                if (FixedFormat == false) {
-                    b_panel += (roundup(current.xmax() - current.x0(), strategy::out_width()) * kern_k);
+                    if (FixedFormat == false) {
+                        b_panel += (roundup(current.xmax() - current.x0(), strategy::out_width()) * kern_k);
+                    }
                 }
             }
         }
@@ -1366,6 +1424,7 @@ public:
         c.method = GemmMethod::GEMM_INTERLEAVED;
         c.inner_block_size = _k_block;
         c.outer_block_size = _x_block;
+        c.m_block_size = _m_block;
         c.filter = get_type_name<strategy>();
         c.weight_format = get_weight_format(get_kernel_weight_format<strategy, FixedFormat, Tro>::get(), sizeof(Tro));
 
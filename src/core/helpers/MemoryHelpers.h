@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,8 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -178,6 +180,20 @@ void reallocate_tensors(const experimental::MemoryRequirements &mem_reqs, Worksp
     }
 }
 
+/** Reallocate the tensors with lifetime marked as Temporary based on new memory requirements
+ *
+ * @note Used by functions with dynamic shapes that keep the tensors they prepared across shape changes.
+ */
+template <typename TensorType>
+void reallocate_temporaries(const experimental::MemoryRequirements &mem_reqs, WorkspaceData<TensorType> &workspace)
+{
+    experimental::MemoryRequirements temporaries{};
+    std::copy_if(mem_reqs.begin(), mem_reqs.end(), std::back_inserter(temporaries),
+                 [](const experimental::MemoryInfo &m)
+                 { return m.lifetime == experimental::MemoryLifetime::Temporary && m.size != 0; });
+    reallocate_tensors(temporaries, workspace);
+}
+
 /** Utility function to release tensors with lifetime marked as Prepare */
 template <typename TensorType>
 void release_temporaries(const experimental::MemoryRequirements &mem_reqs, WorkspaceData<TensorType> &workspace)
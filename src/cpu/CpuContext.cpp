@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -180,5 +180,10 @@ IQueue *CpuContext::create_queue(const AclQueueOptions *options)
 {
     return new CpuQueue(this, options);
 }
+
+IQueue *CpuContext::create_cpu_set_queue(const AclQueueOptions *options, const std::vector<int32_t> &cpu_ids)
+{
+    return new CpuQueue(this, options, cpu_ids);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -62,6 +62,8 @@ public:
     // Inherrited methods overridden
     ITensorV2                          *create_tensor(const AclTensorDescriptor &desc, bool allocate) override;
     IQueue                             *create_queue(const AclQueueOptions *options) override;
+    IQueue                             *create_cpu_set_queue(const AclQueueOptions      *options,
+                                                             const std::vector<int32_t> &cpu_ids) override;
     std::tuple<IOperator *, StatusCode> create_activation(const AclTensorDescriptor     &src,
                                                           const AclTensorDescriptor     &dst,
                                                           const AclActivationDescriptor &act,
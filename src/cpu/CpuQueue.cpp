@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,23 +24,45 @@
 #include "src/cpu/CpuQueue.h"
 
 #include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SchedulerFactory.h"
+
+#include "src/runtime/Utils.h"
 
 namespace arm_compute
 {
 namespace cpu
 {
-CpuQueue::CpuQueue(IContext *ctx, const AclQueueOptions *options) : IQueue(ctx)
+CpuQueue::CpuQueue(IContext *ctx, const AclQueueOptions *options, const std::vector<int32_t> &cpu_ids) : IQueue(ctx)
 {
     ARM_COMPUTE_UNUSED(options);
+    if (!cpu_ids.empty())
+    {
+        const std::vector<int> cores(cpu_ids.begin(), cpu_ids.end());
+#if ARM_COMPUTE_CPP_SCHEDULER
+        _scheduler = SchedulerFactory::create(cores, SchedulerFactory::Type::CPP);
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+        _scheduler = SchedulerFactory::create(cores, SchedulerFactory::Type::ST);
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+    }
 }
 
 arm_compute::IScheduler &CpuQueue::scheduler()
 {
-    return arm_compute::Scheduler::get();
+    return _scheduler != nullptr ? *_scheduler : arm_compute::Scheduler::get();
+}
+
+StatusCode CpuQueue::run(experimental::IOperator &op, ITensorPack &tensors)
+{
+    // Kernels are scheduled through the legacy scheduler: redirect it to the queue's scheduler on this thread
+    utils::ThreadSchedulerScope scope(_scheduler.get());
+    op.run(tensors);
+    return StatusCode::Success;
 }
 
 StatusCode CpuQueue::finish()
 {
+    // Wait for the kernels enqueued asynchronously to complete
+    scheduler().sync();
     return StatusCode::Success;
 }
 } // namespace cpu
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,9 @@
 
 #include "src/common/IQueue.h"
 
+#include <memory>
+#include <vector>
+
 namespace arm_compute
 {
 namespace cpu
@@ -40,16 +43,24 @@ public:
      *
      * @param[in] ctx     Context to be used
      * @param[in] options Command queue options
+     * @param[in] cpu_ids (Optional) CPU cores to bind the queue to. If empty, the queue uses the legacy scheduler
      */
-    CpuQueue(IContext *ctx, const AclQueueOptions *options);
-    /** Return legacy scheduler
+    CpuQueue(IContext *ctx, const AclQueueOptions *options, const std::vector<int32_t> &cpu_ids = {});
+    /** Return the scheduler of the queue
+     *
+     * @note This is the legacy scheduler unless the queue was bound to a set of CPUs, in which case the queue owns a
+     *       dedicated scheduler.
      *
      * @return arm_compute::IScheduler&
      */
     arm_compute::IScheduler &scheduler();
 
     // Inherited functions overridden
+    StatusCode run(experimental::IOperator &op, ITensorPack &tensors) override;
     StatusCode finish() override;
+
+private:
+    std::unique_ptr<arm_compute::IScheduler> _scheduler{nullptr};
 };
 } // namespace cpu
 } // namespace arm_compute
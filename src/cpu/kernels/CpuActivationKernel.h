@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -86,6 +86,15 @@ public:
         return _heuristics.scheduler_hint().split_dimension();
     }
 
+    /** Get the hints for the scheduler, including the split dimension and, if relevant, the cost of the workload.
+     *
+     * @return The scheduler hints.
+     */
+    const IScheduler::Hints &get_scheduler_hint() const
+    {
+        return _heuristics.scheduler_hint();
+    }
+
 private:
     ActivationLayerInfo                       _act_info{};
     std::string                               _name{};
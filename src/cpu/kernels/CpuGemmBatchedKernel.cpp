@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmBatchedKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/cpu/kernels/CpuGemmBatchedPackRhsKernel.h"
+#include "src/cpu/kernels/gemm_batched/list.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuGemmBatchedKernel::GemmBatchedKernel> available_kernels = {
+    {"neon_fp32_gemm_batched", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(neon_fp32_gemm_batched)},
+};
+
+/** Check that a view of @p rows rows of @p cols contiguous values is within the bounds of a tensor */
+bool is_view_in_bounds(const ITensorInfo &info, size_t offset, size_t rows, size_t cols, size_t row_stride)
+{
+    const size_t num_elements = info.total_size() / info.element_size();
+    return offset + (rows - 1) * row_stride + cols <= num_elements;
+}
+
+uint64_t problem_cost(const GEMMBatchedProblem &p)
+{
+    return static_cast<uint64_t>(p.m) * p.n * p.k;
+}
+} // namespace
+
+void CpuGemmBatchedKernel::configure(const ITensorInfo                     *a,
+                                     const ITensorInfo                     *packed_b,
+                                     const ITensorInfo                     *c,
+                                     ITensorInfo                           *d,
+                                     const std::vector<GEMMBatchedProblem> &problems,
+                                     const ActivationLayerInfo             &act_info)
+{
+    ARM_COMPUTE_UNUSED(a, packed_b, c);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, packed_b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmBatchedKernel::validate(a, packed_b, c, d, problems, act_info));
+
+    const auto *uk = CpuGemmBatchedKernel::get_implementation(
+        DataTypeISASelectorData{d->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuGemmBatchedKernel/").append(uk->name);
+    _act_info   = act_info;
+
+    // Run the most expensive problems first
+    const std::vector<size_t> packed_offsets = CpuGemmBatchedPackRhsKernel::compute_packed_offsets(problems);
+
+    std::vector<size_t> order(problems.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t i, size_t j) { return problem_cost(problems[i]) > problem_cost(problems[j]); });
+
+    _problems.clear();
+    _packed_offsets.clear();
+    _cost_prefix.assign(1, 0);
+    _order = order;
+    for (const size_t i : order)
+    {
+        _problems.push_back(problems[i]);
+        _packed_offsets.push_back(packed_offsets[i]);
+        _cost_prefix.push_back(_cost_prefix.back() + problem_cost(problems[i]));
+    }
+
+    // Configure kernel window: one iteration per problem
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, _problems.size(), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmBatchedKernel::validate(const ITensorInfo                     *a,
+                                      const ITensorInfo                     *packed_b,
+                                      const ITensorInfo                     *c,
+                                      const ITensorInfo                     *d,
+                                      const std::vector<GEMMBatchedProblem> &problems,
+                                      const ActivationLayerInfo             &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, packed_b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(packed_b, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(problems.empty(), "The batched GEMM must have at least one problem");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(
+        packed_b->dimension(0) != CpuGemmBatchedPackRhsKernel::compute_packed_size(problems),
+        "The packed B matrices do not match the problems");
+
+    const auto *uk = CpuGemmBatchedKernel::get_implementation(
+        DataTypeISASelectorData{d->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (act_info.enabled())
+    {
+        const ActivationLayerInfo::ActivationFunction act = act_info.activation();
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(act != ActivationLayerInfo::ActivationFunction::RELU &&
+                                            act != ActivationLayerInfo::ActivationFunction::BOUNDED_RELU &&
+                                            act != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU,
+                                        "Activation function not supported by the batched GEMM");
+    }
+
+    if (c != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(c, d);
+    }
+
+    for (const auto &p : problems)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(p.m == 0 || p.n == 0 || p.k == 0);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(p.lda < p.k || p.ldd < p.n, "The rows of a matrix must not overlap");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_view_in_bounds(*a, p.a_offset, p.m, p.k, p.lda),
+                                        "The view of A is out of the bounds of the tensor");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_view_in_bounds(*d, p.d_offset, p.m, p.n, p.ldd),
+                                        "The view of D is out of the bounds of the tensor");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(c != nullptr && !is_view_in_bounds(*c, p.bias_offset, 1, p.n, p.n),
+                                        "The view of the bias is out of the bounds of the tensor");
+    }
+
+    return Status{};
+}
+
+std::vector<Window> CpuGemmBatchedKernel::split_window_by_cost(size_t num_windows) const
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    num_windows          = std::max<size_t>(1, std::min(num_windows, _problems.size()));
+    const uint64_t total = _cost_prefix.back();
+
+    std::vector<Window> windows;
+    size_t              start = 0;
+    for (size_t t = 1; t <= num_windows; ++t)
+    {
+        // The window ends at the first problem starting beyond its share of the total cost
+        const auto   bound = std::lower_bound(_cost_prefix.begin(), _cost_prefix.end(), total * t / num_windows);
+        const size_t end   = (t < num_windows) ? bound - _cost_prefix.begin() : _problems.size();
+        if (end > start)
+        {
+            Window win = IKernel::window();
+            win.set(Window::DimX, Window::Dimension(start, end, 1));
+            windows.push_back(win);
+            start = end;
+        }
+    }
+    return windows;
+}
+
+Status CpuGemmBatchedKernel::validate_views(const ITensorInfo                     *a,
+                                            const ITensorInfo                     *packed_b,
+                                            const ITensorInfo                     *c,
+                                            const ITensorInfo                     *d,
+                                            const std::vector<GEMMBatchedProblem> &problems) const
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(problems.size() != _problems.size(),
+                                    "The number of problems must be the one given to configure()");
+    for (size_t i = 0; i < _problems.size(); ++i)
+    {
+        const GEMMBatchedProblem &p = problems[_order[i]];
+        const GEMMBatchedProblem &q = _problems[i];
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(p.m != q.m || p.n != q.n || p.k != q.k || p.b_offset != q.b_offset ||
+                                            p.b_stride_k != q.b_stride_k || p.b_stride_n != q.b_stride_n ||
+                                            p.bias_offset != q.bias_offset,
+                                        "Only the views of A and D can differ from the problems of configure()");
+    }
+    return CpuGemmBatchedKernel::validate(a, packed_b, c, d, problems, _act_info);
+}
+
+void CpuGemmBatchedKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    run_problems(tensors, window, nullptr);
+}
+
+void CpuGemmBatchedKernel::run_op_with_views(ITensorPack                           &tensors,
+                                             const Window                          &window,
+                                             const ThreadInfo                      &info,
+                                             const std::vector<GEMMBatchedProblem> &problems) const
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON(problems.size() != _problems.size());
+    run_problems(tensors, window, &problems);
+}
+
+void CpuGemmBatchedKernel::run_problems(ITensorPack                           &tensors,
+                                        const Window                          &window,
+                                        const std::vector<GEMMBatchedProblem> *views) const
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *a        = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *packed_b = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *c        = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *d        = tensors.get_tensor(TensorType::ACL_DST);
+
+    const size_t element_size = d->info()->element_size();
+
+    const uint8_t *a_base    = a->buffer() + a->info()->offset_first_element_in_bytes();
+    const uint8_t *b_base    = packed_b->buffer() + packed_b->info()->offset_first_element_in_bytes();
+    const uint8_t *bias_base = (c != nullptr) ? c->buffer() + c->info()->offset_first_element_in_bytes() : nullptr;
+    uint8_t       *d_base    = d->buffer() + d->info()->offset_first_element_in_bytes();
+
+    for (int i = window.x().start(); i < window.x().end(); ++i)
+    {
+        const GEMMBatchedProblem &p = (views != nullptr) ? (*views)[_order[i]] : _problems[i];
+
+        const uint8_t *bias = (bias_base != nullptr) ? bias_base + p.bias_offset * element_size : nullptr;
+        _run_method(a_base + p.a_offset * element_size, b_base + _packed_offsets[i], bias,
+                    d_base + p.d_offset * element_size, p, _act_info);
+    }
+}
+
+const char *CpuGemmBatchedKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuGemmBatchedKernel::GemmBatchedKernel> &CpuGemmBatchedKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
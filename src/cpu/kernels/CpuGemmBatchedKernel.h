@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMBATCHEDKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMBATCHEDKERNEL_H
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+#include "arm_compute/function_info/GEMMBatchedInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compute many independent F32 matrix products with B packed by @ref CpuGemmBatchedPackRhsKernel
+ *
+ * Each problem is computed as a whole by a single thread, in tiles of @ref block_rows rows by
+ * CpuGemmBatchedPackRhsKernel::block_cols columns, with the bias and the activation applied when the tile is stored.
+ *
+ * The window iterates over the problems in X, ordered from the most to the least expensive. As the problems can have
+ * different shapes, splitting the window evenly does not balance the threads: use @ref split_window_by_cost instead.
+ */
+class CpuGemmBatchedKernel : public ICpuKernel<CpuGemmBatchedKernel>
+{
+private:
+    using GemmBatchedKernelPtr = std::add_pointer<void(const uint8_t *,
+                                                       const uint8_t *,
+                                                       const uint8_t *,
+                                                       uint8_t *,
+                                                       const GEMMBatchedProblem &,
+                                                       const ActivationLayerInfo &)>::type;
+
+public:
+    /** Number of output rows computed together */
+    static constexpr unsigned int block_rows = 4;
+
+    struct GemmBatchedKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        GemmBatchedKernelPtr         ukernel;
+    };
+
+    CpuGemmBatchedKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmBatchedKernel);
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  a        Tensor info holding the A matrices. Data type supported: F32
+     * @param[in]  packed_b Packed B matrices, output of @ref CpuGemmBatchedPackRhsKernel. Data type supported: U8
+     * @param[in]  c        Tensor info holding the biases. Can be nullptr. Data type supported: same as @p a
+     * @param[out] d        Tensor info holding the D matrices. Data type supported: same as @p a
+     * @param[in]  problems Problems of the batched GEMM
+     * @param[in]  act_info Activation applied to the results. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported
+     */
+    void configure(const ITensorInfo                     *a,
+                   const ITensorInfo                     *packed_b,
+                   const ITensorInfo                     *c,
+                   ITensorInfo                           *d,
+                   const std::vector<GEMMBatchedProblem> &problems,
+                   const ActivationLayerInfo             &act_info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmBatchedKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                     *a,
+                           const ITensorInfo                     *packed_b,
+                           const ITensorInfo                     *c,
+                           const ITensorInfo                     *d,
+                           const std::vector<GEMMBatchedProblem> &problems,
+                           const ActivationLayerInfo             &act_info);
+
+    /** Split the window in windows of similar cost
+     *
+     * A single expensive problem can make a window more expensive than the others, which is mitigated by asking for
+     * more windows than threads: the most expensive problems are in the first windows, so they are picked first.
+     *
+     * @param[in] num_windows Maximum number of windows
+     *
+     * @return The windows, covering the window of the kernel
+     */
+    std::vector<Window> split_window_by_cost(size_t num_windows) const;
+    /** Check that problems only differ from the configured ones by their views of A and D
+     *
+     * The packed B matrices, the biases and the order of the problems are kept, so the shapes and the views of B and of
+     * the biases must be the ones given to configure().
+     *
+     * @param[in] a        Tensor info holding the A matrices
+     * @param[in] packed_b Packed B matrices, as given to configure()
+     * @param[in] c        Tensor info holding the biases. Can be nullptr
+     * @param[in] d        Tensor info holding the D matrices
+     * @param[in] problems Problems of the batched GEMM, in the order given to configure()
+     *
+     * @return a status
+     */
+    Status validate_views(const ITensorInfo                     *a,
+                          const ITensorInfo                     *packed_b,
+                          const ITensorInfo                     *c,
+                          const ITensorInfo                     *d,
+                          const std::vector<GEMMBatchedProblem> &problems) const;
+    /** Run the problems of a window with the views of A and D of @p problems instead of the configured ones
+     *
+     * @param[in] tensors  Same tensors as run_op()
+     * @param[in] window   Window of the problems to run
+     * @param[in] info     Info about the executing thread
+     * @param[in] problems Problems accepted by validate_views(), in the order given to configure()
+     */
+    void run_op_with_views(ITensorPack                           &tensors,
+                           const Window                          &window,
+                           const ThreadInfo                      &info,
+                           const std::vector<GEMMBatchedProblem> &problems) const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<GemmBatchedKernel> &get_available_kernels();
+
+private:
+    /** Run the problems of a window, with the views of @p views if not nullptr */
+    void run_problems(ITensorPack &tensors, const Window &window, const std::vector<GEMMBatchedProblem> *views) const;
+
+    std::vector<GEMMBatchedProblem> _problems{};       /**< Problems in the order they are run */
+    std::vector<size_t>             _order{};          /**< Index in configure() of each problem */
+    std::vector<size_t>             _packed_offsets{}; /**< Offset of the packed B matrix of each problem */
+    std::vector<uint64_t>           _cost_prefix{};    /**< Cost of the problems before each problem, and in total */
+    ActivationLayerInfo             _act_info{};
+    GemmBatchedKernelPtr            _run_method{nullptr};
+    std::string                     _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMBATCHEDKERNEL_H
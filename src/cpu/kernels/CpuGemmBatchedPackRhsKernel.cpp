@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmBatchedPackRhsKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+std::vector<size_t> CpuGemmBatchedPackRhsKernel::compute_packed_offsets(const std::vector<GEMMBatchedProblem> &problems)
+{
+    using RhsView = std::tuple<size_t, size_t, size_t, unsigned int, unsigned int>;
+
+    std::map<RhsView, size_t> packed_views;
+    std::vector<size_t>       offsets;
+    size_t                    size = 0;
+    for (const auto &p : problems)
+    {
+        const RhsView view(p.b_offset, p.b_stride_k, p.b_stride_n, p.k, p.n);
+        const auto    it = packed_views.find(view);
+        if (it != packed_views.end())
+        {
+            offsets.push_back(it->second);
+        }
+        else
+        {
+            packed_views.emplace(view, size);
+            offsets.push_back(size);
+            size += ceil_to_multiple<size_t>(p.n, block_cols) * p.k * sizeof(float);
+        }
+    }
+    return offsets;
+}
+
+size_t CpuGemmBatchedPackRhsKernel::compute_packed_size(const std::vector<GEMMBatchedProblem> &problems)
+{
+    const std::vector<size_t> offsets = compute_packed_offsets(problems);
+
+    size_t size = 0;
+    for (size_t i = 0; i < problems.size(); ++i)
+    {
+        const size_t packed_size = ceil_to_multiple<size_t>(problems[i].n, block_cols) * problems[i].k * sizeof(float);
+        size                     = std::max(size, offsets[i] + packed_size);
+    }
+    return size;
+}
+
+void CpuGemmBatchedPackRhsKernel::configure(const ITensorInfo                     *src,
+                                            ITensorInfo                           *dst,
+                                            const std::vector<GEMMBatchedProblem> &problems)
+{
+    ARM_COMPUTE_UNUSED(src);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    auto_init_if_empty(*dst, TensorInfo(TensorShape(compute_packed_size(problems)), 1, DataType::U8));
+
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmBatchedPackRhsKernel::validate(src, dst, problems));
+
+    // Only keep the first problem of each distinct view of B: the packed matrices are allocated in the order of their
+    // first problem, so a problem packs a new matrix if its offset is beyond the previous ones
+    const std::vector<size_t> offsets = compute_packed_offsets(problems);
+
+    _problems.clear();
+    _offsets.clear();
+    for (size_t i = 0; i < problems.size(); ++i)
+    {
+        if (_offsets.empty() || offsets[i] > _offsets.back())
+        {
+            _problems.push_back(problems[i]);
+            _offsets.push_back(offsets[i]);
+        }
+    }
+
+    // Configure kernel window: one iteration per packed matrix
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, _problems.size(), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmBatchedPackRhsKernel::validate(const ITensorInfo                     *src,
+                                             const ITensorInfo                     *dst,
+                                             const std::vector<GEMMBatchedProblem> &problems)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(problems.empty(), "The batched GEMM must have at least one problem");
+
+    const size_t src_elements = src->total_size() / src->element_size();
+    for (const auto &p : problems)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(p.m == 0 || p.n == 0 || p.k == 0);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(p.b_offset + (p.k - 1) * p.b_stride_k + (p.n - 1) * p.b_stride_n >=
+                                            src_elements,
+                                        "The view of B is out of the bounds of the tensor");
+    }
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(0) != compute_packed_size(problems));
+    }
+
+    return Status{};
+}
+
+void CpuGemmBatchedPackRhsKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    const float *src_base =
+        reinterpret_cast<const float *>(src->buffer() + src->info()->offset_first_element_in_bytes());
+    uint8_t *dst_base = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    for (int i = window.x().start(); i < window.x().end(); ++i)
+    {
+        const GEMMBatchedProblem &p   = _problems[i];
+        float                    *out = reinterpret_cast<float *>(dst_base + _offsets[i]);
+
+        for (size_t col0 = 0; col0 < p.n; col0 += block_cols)
+        {
+            const size_t cols = std::min<size_t>(block_cols, p.n - col0);
+            for (size_t kk = 0; kk < p.k; ++kk)
+            {
+                const float *in = src_base + p.b_offset + kk * p.b_stride_k + col0 * p.b_stride_n;
+                for (size_t c = 0; c < block_cols; ++c)
+                {
+                    out[c] = (c < cols) ? in[c * p.b_stride_n] : 0.f;
+                }
+                out += block_cols;
+            }
+        }
+    }
+}
+
+const char *CpuGemmBatchedPackRhsKernel::name() const
+{
+    return "CpuGemmBatchedPackRhsKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMBATCHEDPACKRHSKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMBATCHEDPACKRHSKERNEL_H
+
+#include "arm_compute/function_info/GEMMBatchedInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to pack the B matrices of a batched GEMM for @ref CpuGemmBatchedKernel
+ *
+ * The B matrix of each problem is read through the strides of its view and stored as panels of @ref block_cols
+ * columns: each panel holds the K rows of its columns one after the other, padded with zeros beyond N. The packed
+ * matrices are stored one after the other in a single buffer. Problems with the same view of B share the same packed
+ * matrix, which is only packed once.
+ *
+ * The window iterates over the distinct packed matrices in X.
+ */
+class CpuGemmBatchedPackRhsKernel : public ICpuKernel<CpuGemmBatchedPackRhsKernel>
+{
+public:
+    /** Number of columns of a packed panel */
+    static constexpr unsigned int block_cols = 8;
+
+    CpuGemmBatchedPackRhsKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmBatchedPackRhsKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src      Source tensor info holding the B matrices. Data type supported: F32
+     * @param[out] dst      Destination tensor info with the packed matrices. Shape supported: 1D. Data type supported: U8
+     * @param[in]  problems Problems of the batched GEMM
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, const std::vector<GEMMBatchedProblem> &problems);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmBatchedPackRhsKernel::configure()
+     *
+     * @return a status
+     */
+    static Status
+    validate(const ITensorInfo *src, const ITensorInfo *dst, const std::vector<GEMMBatchedProblem> &problems);
+    /** Offsets in bytes of the packed B matrix of each problem
+     *
+     * @param[in] problems Problems of the batched GEMM
+     *
+     * @return The offset of the packed matrix of each problem
+     */
+    static std::vector<size_t> compute_packed_offsets(const std::vector<GEMMBatchedProblem> &problems);
+    /** Size in bytes of the packed B matrices
+     *
+     * @param[in] problems Problems of the batched GEMM
+     *
+     * @return The size of the buffer holding all the packed matrices
+     */
+    static size_t compute_packed_size(const std::vector<GEMMBatchedProblem> &problems);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    std::vector<GEMMBatchedProblem> _problems{}; /**< One problem for each distinct view of B */
+    std::vector<size_t>             _offsets{};  /**< Offset of the packed matrix of each problem in _problems */
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMBATCHEDPACKRHSKERNEL_H
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmInt4Kernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/cpu/kernels/CpuGemmInt4PackRhsKernel.h"
+#include "src/cpu/kernels/gemm_int4/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuGemmInt4Kernel::GemmInt4Kernel> available_kernels = {
+    {"neon_fp32_gemm_int4_quantized_lhs",
+     [](const GemmInt4DataTypeISASelectorData &data) { return data.dt == DataType::F32 && data.quantize_lhs; },
+     REGISTER_FP32_NEON(neon_fp32_gemm_int4_quantized_lhs)},
+    {"neon_fp32_gemm_int4",
+     [](const GemmInt4DataTypeISASelectorData &data) { return data.dt == DataType::F32 && !data.quantize_lhs; },
+     REGISTER_FP32_NEON(neon_fp32_gemm_int4)},
+    {"neon_fp16_gemm_int4_quantized_lhs",
+     [](const GemmInt4DataTypeISASelectorData &data)
+     { return data.dt == DataType::F16 && data.isa.fp16 && data.quantize_lhs; },
+     REGISTER_FP16_NEON(neon_fp16_gemm_int4_quantized_lhs)},
+    {"neon_fp16_gemm_int4",
+     [](const GemmInt4DataTypeISASelectorData &data)
+     { return data.dt == DataType::F16 && data.isa.fp16 && !data.quantize_lhs; },
+     REGISTER_FP16_NEON(neon_fp16_gemm_int4)},
+};
+} // namespace
+
+void CpuGemmInt4Kernel::configure(const ITensorInfo *lhs,
+                                  const ITensorInfo *rhs,
+                                  const ITensorInfo *bias,
+                                  ITensorInfo       *dst,
+                                  unsigned int       group_size,
+                                  bool               quantize_lhs)
+{
+    ARM_COMPUTE_UNUSED(lhs, bias);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, rhs, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmInt4Kernel::validate(lhs, rhs, bias, dst, group_size, quantize_lhs));
+
+    const auto *uk = CpuGemmInt4Kernel::get_implementation(
+        GemmInt4DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa(), quantize_lhs});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuGemmInt4Kernel/").append(uk->name);
+    _group_size = group_size;
+
+    // Configure kernel window
+    const size_t m       = dst->dimension(1);
+    const size_t batches = dst->tensor_shape().total_size_upper(2);
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, rhs->dimension(1), 1));
+    win.set(Window::DimY, Window::Dimension(0, ceil_to_multiple(m, block_rows) / block_rows, 1));
+    win.set(Window::DimZ, Window::Dimension(0, batches, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmInt4Kernel::validate(const ITensorInfo *lhs,
+                                   const ITensorInfo *rhs,
+                                   const ITensorInfo *bias,
+                                   const ITensorInfo *dst,
+                                   unsigned int       group_size,
+                                   bool               quantize_lhs)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, rhs, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(rhs, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(group_size == 0 || group_size % 32 != 0,
+                                    "The group size must be a non-zero multiple of 32");
+    ARM_COMPUTE_RETURN_ERROR_ON(rhs->num_dimensions() > 2);
+
+    const size_t packed_group_size = CpuGemmInt4PackRhsKernel::packed_group_size(group_size);
+    ARM_COMPUTE_RETURN_ERROR_ON(rhs->dimension(0) % packed_group_size != 0);
+    const size_t num_groups = rhs->dimension(0) / packed_group_size;
+
+    const auto *uk = CpuGemmInt4Kernel::get_implementation(
+        GemmInt4DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa(), quantize_lhs});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (quantize_lhs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->dimension(0) != num_groups * (group_size + 2 * sizeof(float)),
+                                        "The quantized LHS must have as many groups as the weights");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(ceil_to_multiple(lhs->dimension(0), group_size) / group_size != num_groups,
+                                        "The LHS must have as many groups as the weights");
+    }
+
+    const size_t block_cols = CpuGemmInt4PackRhsKernel::block_cols;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs->dimension(1) != ceil_to_multiple(dst->dimension(0), block_cols) / block_cols,
+                                    "The packed weights must have one row per block of output columns");
+    ARM_COMPUTE_RETURN_ERROR_ON(lhs->dimension(1) != dst->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON(lhs->tensor_shape().total_size_upper(2) != dst->tensor_shape().total_size_upper(2));
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(bias, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != dst->dimension(0));
+    }
+
+    return Status{};
+}
+
+void CpuGemmInt4Kernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *lhs  = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *rhs  = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *bias = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *dst  = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(lhs, rhs, bias, dst, _group_size, window);
+}
+
+const char *CpuGemmInt4Kernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuGemmInt4Kernel::GemmInt4Kernel> &CpuGemmInt4Kernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
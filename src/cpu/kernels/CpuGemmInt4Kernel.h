@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMINT4KERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMINT4KERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to multiply a F32/F16 matrix by block-quantized signed 4-bit weights
+ *
+ * The weights are packed with @ref CpuGemmInt4PackRhsKernel and dequantized on the fly. If the LHS has been quantized
+ * with @ref CpuGemmInt4QuantizeLhsKernel, the products are accumulated with 8-bit integer multiplications and the
+ * scales are applied once per group.
+ *
+ * The window iterates over the blocks of output columns in X, the blocks of @ref block_rows rows in Y and the batches
+ * in Z.
+ */
+class CpuGemmInt4Kernel : public ICpuKernel<CpuGemmInt4Kernel>
+{
+private:
+    using GemmInt4KernelPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, const ITensor *, ITensor *, unsigned int, const Window &)>::type;
+
+public:
+    /** Number of output rows computed together */
+    static constexpr unsigned int block_rows = 4;
+
+    struct GemmInt4Kernel
+    {
+        const char                              *name;
+        const GemmInt4DataTypeISASelectorDataPtr is_selected;
+        GemmInt4KernelPtr                        ukernel;
+    };
+
+    CpuGemmInt4Kernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmInt4Kernel);
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  lhs          Left-hand side tensor info. Data types supported: F16/F32, or U8 if @p quantize_lhs is true
+     * @param[in]  rhs          Packed weights tensor info, output of @ref CpuGemmInt4PackRhsKernel. Data type supported: U8
+     * @param[in]  bias         Bias tensor info. Can be nullptr. Shape supported: 1D [N]. Data type supported: same as @p dst
+     * @param[out] dst          Destination tensor info. Data types supported: F16/F32
+     * @param[in]  group_size   Number of values per group of the weights
+     * @param[in]  quantize_lhs True if @p lhs has been quantized with @ref CpuGemmInt4QuantizeLhsKernel
+     */
+    void configure(const ITensorInfo *lhs,
+                   const ITensorInfo *rhs,
+                   const ITensorInfo *bias,
+                   ITensorInfo       *dst,
+                   unsigned int       group_size,
+                   bool               quantize_lhs);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmInt4Kernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *lhs,
+                           const ITensorInfo *rhs,
+                           const ITensorInfo *bias,
+                           const ITensorInfo *dst,
+                           unsigned int       group_size,
+                           bool               quantize_lhs);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<GemmInt4Kernel> &get_available_kernels();
+
+private:
+    GemmInt4KernelPtr _run_method{nullptr};
+    std::string       _name{};
+    unsigned int      _group_size{0};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMINT4KERNEL_H
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmInt4PackRhsKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+/** Read the 4-bit value at index @p idx of a group, sign-extended to 8 bits */
+inline int8_t get_int4(const uint8_t *values, unsigned int idx)
+{
+    const uint8_t byte = values[idx / 2];
+    const uint8_t bits = (idx % 2 == 0) ? (byte & 0x0F) : (byte >> 4);
+    return static_cast<int8_t>(bits << 4) >> 4;
+}
+} // namespace
+
+TensorShape CpuGemmInt4PackRhsKernel::compute_packed_shape(const ITensorInfo &src, const Int4WeightsInfo &int4_info)
+{
+    const size_t num_groups     = src.dimension(0) / int4_info.block_size();
+    const size_t num_col_blocks = ceil_to_multiple(src.dimension(1), block_cols) / block_cols;
+    return TensorShape(num_groups * packed_group_size(int4_info.group_size), num_col_blocks);
+}
+
+void CpuGemmInt4PackRhsKernel::configure(const ITensorInfo *src, ITensorInfo *dst, const Int4WeightsInfo &int4_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(compute_packed_shape(*src, int4_info)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmInt4PackRhsKernel::validate(src, dst, int4_info));
+
+    _int4_info = int4_info;
+
+    // Configure kernel window: one iteration per block of output columns
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, dst->dimension(1), 1));
+    ICpuKernel::configure(win);
+}
+
+Status
+CpuGemmInt4PackRhsKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, const Int4WeightsInfo &int4_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 2, "Batched 4-bit weights are not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(int4_info.group_size == 0 || int4_info.group_size % 32 != 0,
+                                    "The group size must be a non-zero multiple of 32");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(int4_info.scale_data_type != DataType::F32 &&
+                                        int4_info.scale_data_type != DataType::F16,
+                                    "The scales must be F32 or F16");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) % int4_info.block_size() != 0,
+                                    "The rows of the weights must be made of whole blocks");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), compute_packed_shape(*src, int4_info));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+    }
+
+    return Status{};
+}
+
+void CpuGemmInt4PackRhsKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    const unsigned int group_size  = _int4_info.group_size;
+    const size_t       block_size  = _int4_info.block_size();
+    const size_t       scale_size  = (_int4_info.scale_data_type == DataType::F16) ? sizeof(half) : sizeof(float);
+    const size_t       num_groups  = src->info()->dimension(0) / block_size;
+    const size_t       n           = src->info()->dimension(1);
+    const size_t       src_stride  = src->info()->strides_in_bytes()[1];
+    const size_t       dst_stride  = dst->info()->strides_in_bytes()[1];
+    const size_t       group_bytes = packed_group_size(group_size);
+    const size_t       value_bytes = block_cols * (group_size / 2);
+
+    const uint8_t *src_base = src->buffer() + src->info()->offset_first_element_in_bytes();
+    uint8_t       *dst_base = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    for (int cb = window.x().start(); cb < window.x().end(); ++cb)
+    {
+        uint8_t *dst_row = dst_base + cb * dst_stride;
+        std::memset(dst_row, 0, num_groups * group_bytes);
+
+        for (unsigned int c = 0; c < block_cols; ++c)
+        {
+            const size_t col = cb * block_cols + c;
+            if (col >= n)
+            {
+                break;
+            }
+
+            const uint8_t *src_row = src_base + col * src_stride;
+            for (size_t g = 0; g < num_groups; ++g)
+            {
+                const uint8_t *block = src_row + g * block_size;
+
+                float scale = 0.f;
+                if (_int4_info.scale_data_type == DataType::F16)
+                {
+                    half scale_f16;
+                    std::memcpy(&scale_f16, block, sizeof(half));
+                    scale = static_cast<float>(scale_f16);
+                }
+                else
+                {
+                    std::memcpy(&scale, block, sizeof(float));
+                }
+                const int8_t   zero_point = _int4_info.has_zero_points ? static_cast<int8_t>(block[scale_size]) : 0;
+                const uint8_t *values     = block + scale_size + (_int4_info.has_zero_points ? 1 : 0);
+
+                uint8_t *dst_values = dst_row + g * group_bytes + c * (group_size / 2);
+                for (unsigned int chunk = 0; chunk < group_size; chunk += 32)
+                {
+                    for (unsigned int i = 0; i < 16; ++i)
+                    {
+                        const uint8_t lo          = get_int4(values, chunk + i) & 0x0F;
+                        const uint8_t hi          = get_int4(values, chunk + i + 16) & 0x0F;
+                        dst_values[chunk / 2 + i] = lo | static_cast<uint8_t>(hi << 4);
+                    }
+                }
+
+                float *dst_scales          = reinterpret_cast<float *>(dst_row + g * group_bytes + value_bytes);
+                dst_scales[c]              = scale;
+                dst_scales[block_cols + c] = static_cast<float>(zero_point) * scale;
+            }
+        }
+    }
+}
+
+const char *CpuGemmInt4PackRhsKernel::name() const
+{
+    return "CpuGemmInt4PackRhsKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
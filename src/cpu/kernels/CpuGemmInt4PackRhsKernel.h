@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMINT4PACKRHSKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMINT4PACKRHSKERNEL_H
+
+#include "arm_compute/function_info/GEMMInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to pack block-quantized signed 4-bit weights for @ref CpuGemmInt4Kernel
+ *
+ * The source is described by @ref Int4WeightsInfo. The destination is made of one row per block of
+ * @ref block_cols output columns. Each row stores, for each group of the K dimension:
+ * -# block_cols x (group_size / 2) bytes of values. In each chunk of 32 values, byte i holds value i in the low nibble
+ *    and value i + 16 in the high nibble
+ * -# block_cols F32 scales
+ * -# block_cols F32 scaled zero points (zero_point * scale)
+ *
+ * Columns beyond N are padded with zeros.
+ */
+class CpuGemmInt4PackRhsKernel : public ICpuKernel<CpuGemmInt4PackRhsKernel>
+{
+public:
+    /** Number of output columns packed together */
+    static constexpr unsigned int block_cols = 4;
+
+    CpuGemmInt4PackRhsKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmInt4PackRhsKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src       Source tensor info with the block-quantized weights. Data type supported: U8
+     * @param[out] dst       Destination tensor info with the packed weights. Data type supported: same as @p src
+     * @param[in]  int4_info Descriptor of the block-quantized weights
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, const Int4WeightsInfo &int4_info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmInt4PackRhsKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const Int4WeightsInfo &int4_info);
+    /** Size in bytes of one group of a row of the packed weights
+     *
+     * @param[in] group_size Number of values per group
+     *
+     * @return The size in bytes
+     */
+    static size_t packed_group_size(unsigned int group_size)
+    {
+        return block_cols * (group_size / 2 + 2 * sizeof(float));
+    }
+    /** Shape of the packed weights
+     *
+     * @param[in] src       Source tensor info with the block-quantized weights
+     * @param[in] int4_info Descriptor of the block-quantized weights
+     *
+     * @return The shape of the packed weights
+     */
+    static TensorShape compute_packed_shape(const ITensorInfo &src, const Int4WeightsInfo &int4_info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    Int4WeightsInfo _int4_info{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMINT4PACKRHSKERNEL_H
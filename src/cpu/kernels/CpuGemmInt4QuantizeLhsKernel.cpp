@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmInt4QuantizeLhsKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+constexpr size_t group_footer_size = 2 * sizeof(float);
+
+template <typename T>
+void quantize_lhs(const ITensor *src, ITensor *dst, unsigned int group_size, const Window &window)
+{
+    const size_t k          = src->info()->dimension(0);
+    const size_t group_step = group_size + group_footer_size;
+    const size_t num_groups = dst->info()->dimension(0) / group_step;
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator src_it(src, win);
+    Iterator dst_it(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto src_ptr = reinterpret_cast<const T *>(src_it.ptr());
+
+            for (size_t g = 0; g < num_groups; ++g)
+            {
+                const size_t k0  = g * group_size;
+                const size_t len = std::min<size_t>(group_size, k - k0);
+
+                float amax = 0.f;
+                for (size_t i = 0; i < len; ++i)
+                {
+                    amax = std::max(amax, std::abs(static_cast<float>(src_ptr[k0 + i])));
+                }
+
+                const float scale     = amax / 127.f;
+                const float inv_scale = (amax > 0.f) ? 127.f / amax : 0.f;
+
+                uint8_t *group = dst_it.ptr() + g * group_step;
+                auto     q     = reinterpret_cast<int8_t *>(group);
+                int32_t  sum   = 0;
+                for (size_t i = 0; i < len; ++i)
+                {
+                    const long v = std::lround(static_cast<float>(src_ptr[k0 + i]) * inv_scale);
+                    q[i]         = static_cast<int8_t>(utility::clamp<long>(v, -127, 127));
+                    sum += q[i];
+                }
+                std::memset(q + len, 0, group_size - len);
+
+                const float footer[2] = {scale, scale * static_cast<float>(sum)};
+                std::memcpy(group + group_size, footer, group_footer_size);
+            }
+        },
+        src_it, dst_it);
+}
+} // namespace
+
+TensorShape CpuGemmInt4QuantizeLhsKernel::compute_quantized_shape(const ITensorInfo &src, unsigned int group_size)
+{
+    const size_t num_groups = ceil_to_multiple(src.dimension(0), group_size) / group_size;
+
+    TensorShape shape = src.tensor_shape();
+    shape.set(0, num_groups * (group_size + group_footer_size));
+    return shape;
+}
+
+void CpuGemmInt4QuantizeLhsKernel::configure(const ITensorInfo *src, ITensorInfo *dst, unsigned int group_size)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    auto_init_if_empty(*dst, TensorInfo(compute_quantized_shape(*src, group_size), 1, DataType::U8));
+
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmInt4QuantizeLhsKernel::validate(src, dst, group_size));
+
+    _group_size = group_size;
+
+    // Configure kernel window: the rows are quantized as a whole
+    Window win = calculate_max_window(*src, Steps(src->dimension(0)));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmInt4QuantizeLhsKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, unsigned int group_size)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src) is not needed here as this kernel doesn't use CPU FP16 instructions.
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(group_size == 0 || group_size % 32 != 0,
+                                    "The group size must be a non-zero multiple of 32");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(),
+                                                           compute_quantized_shape(*src, group_size));
+    }
+
+    return Status{};
+}
+
+void CpuGemmInt4QuantizeLhsKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    if (src->info()->data_type() == DataType::F16)
+    {
+        quantize_lhs<half>(src, dst, _group_size, window);
+    }
+    else
+    {
+        quantize_lhs<float>(src, dst, _group_size, window);
+    }
+}
+
+const char *CpuGemmInt4QuantizeLhsKernel::name() const
+{
+    return "CpuGemmInt4QuantizeLhsKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
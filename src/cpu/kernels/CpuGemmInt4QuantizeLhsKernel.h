@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMINT4QUANTIZELHSKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMINT4QUANTIZELHSKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to quantize the LHS of @ref CpuGemmInt4Kernel to signed 8-bit values
+ *
+ * Each row of the source is split in groups of group_size values, matching the groups of the 4-bit weights.
+ * Each group is quantized symmetrically with its own scale and stored as:
+ * -# group_size signed 8-bit values, padded with zeros past the end of the row
+ * -# The F32 scale of the group
+ * -# The F32 sum of the quantized values multiplied by the scale
+ */
+class CpuGemmInt4QuantizeLhsKernel : public ICpuKernel<CpuGemmInt4QuantizeLhsKernel>
+{
+public:
+    CpuGemmInt4QuantizeLhsKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmInt4QuantizeLhsKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src        Source tensor info. Data types supported: F16/F32
+     * @param[out] dst        Destination tensor info with the quantized groups. Data type supported: U8
+     * @param[in]  group_size Number of values per group. Must be a multiple of 32
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, unsigned int group_size);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmInt4QuantizeLhsKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, unsigned int group_size);
+    /** Shape of the quantized source
+     *
+     * @param[in] src        Source tensor info
+     * @param[in] group_size Number of values per group
+     *
+     * @return The shape of the quantized source
+     */
+    static TensorShape compute_quantized_shape(const ITensorInfo &src, unsigned int group_size);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    unsigned int _group_size{0};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMINT4QUANTIZELHSKERNEL_H
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to multiply a F32 matrix by sparse weights compressed with @ref CpuGemmSparsePackRhsKernel
+ *
+ * Only the values kept by the compression are loaded and multiplied: the zero blocks of block-sparse weights are
+ * skipped and 2:4 structured weights need half the multiplications of dense weights.
+ *
+ * The window iterates over the blocks of output columns in X, the blocks of @ref block_rows rows in Y and the batches
+ * in Z.
+ */
+class CpuGemmSparseKernel : public ICpuKernel<CpuGemmSparseKernel>
+{
+private:
+    using GemmSparseKernelPtr =
+        std::add_pointer<void(const ITensor *, const ITensor *, const ITensor *, ITensor *, const Window &)>::type;
+
+public:
+    /** Number of output rows computed together */
+    static constexpr unsigned int block_rows = 4;
+
+    struct GemmSparseKernel
+    {
+        const char                                *name;
+        const GemmSparseDataTypeISASelectorDataPtr is_selected;
+        GemmSparseKernelPtr                        ukernel;
+    };
+
+    CpuGemmSparseKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmSparseKernel);
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  lhs      Left-hand side tensor info. Shape supported: [K, M, batches]. Data type supported: F32
+     * @param[in]  rhs      Compressed weights tensor info, output of @ref CpuGemmSparsePackRhsKernel. Data type supported: U8
+     * @param[in]  bias     Bias tensor info. Can be nullptr. Shape supported: 1D [N]. Data type supported: same as @p lhs
+     * @param[out] dst      Destination tensor info. Shape supported: [N, M, batches]. Data type supported: same as @p lhs
+     * @param[in]  sparsity Sparsity pattern the weights have been compressed with
+     */
+    void configure(const ITensorInfo *lhs,
+                   const ITensorInfo *rhs,
+                   const ITensorInfo *bias,
+                   ITensorInfo       *dst,
+                   WeightsSparsity    sparsity);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmSparseKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *lhs,
+                           const ITensorInfo *rhs,
+                           const ITensorInfo *bias,
+                           const ITensorInfo *dst,
+                           WeightsSparsity    sparsity);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<GemmSparseKernel> &get_available_kernels();
+
+private:
+    GemmSparseKernelPtr _run_method{nullptr};
+    std::string         _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEKERNEL_H
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmSparsePackRhsKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+size_t CpuGemmSparsePackRhsKernel::packed_row_size(size_t k, WeightsSparsity sparsity)
+{
+    const size_t num_groups = ceil_to_multiple(k, block_k) / block_k;
+    switch (sparsity)
+    {
+        case WeightsSparsity::BLOCK_4X4:
+            return sizeof(int32_t) + num_groups * (sizeof(int32_t) + block_k * block_cols * sizeof(float));
+        case WeightsSparsity::STRUCTURED_2_4:
+            return num_groups * block_cols * (2 * sizeof(float) + 1);
+        default:
+            return 0;
+    }
+}
+
+TensorShape CpuGemmSparsePackRhsKernel::compute_packed_shape(const ITensorInfo &src, WeightsSparsity sparsity)
+{
+    const size_t num_col_blocks = ceil_to_multiple(src.dimension(0), block_cols) / block_cols;
+    return TensorShape(packed_row_size(src.dimension(1), sparsity), num_col_blocks);
+}
+
+void CpuGemmSparsePackRhsKernel::configure(const ITensorInfo *src, ITensorInfo *dst, WeightsSparsity sparsity)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    auto_init_if_empty(*dst, TensorInfo(compute_packed_shape(*src, sparsity), 1, DataType::U8));
+
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmSparsePackRhsKernel::validate(src, dst, sparsity));
+
+    _sparsity = sparsity;
+
+    // Configure kernel window: one iteration per block of output columns
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, dst->dimension(1), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmSparsePackRhsKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, WeightsSparsity sparsity)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 2, "Batched sparse weights are not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(sparsity != WeightsSparsity::BLOCK_4X4 &&
+                                        sparsity != WeightsSparsity::STRUCTURED_2_4,
+                                    "Unsupported sparsity pattern");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), compute_packed_shape(*src, sparsity));
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::U8);
+    }
+
+    return Status{};
+}
+
+Status CpuGemmSparsePackRhsKernel::validate_packed_values()
+{
+    const unsigned int num_invalid_groups = _num_invalid_groups.exchange(0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG_VAR(num_invalid_groups != 0,
+                                        "%u groups of 4 values along K of the weights have more than 2 non-zero "
+                                        "values, at most 2 are allowed by the 2:4 sparsity pattern",
+                                        num_invalid_groups);
+    return Status{};
+}
+
+void CpuGemmSparsePackRhsKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    const size_t n          = src->info()->dimension(0);
+    const size_t k          = src->info()->dimension(1);
+    const size_t num_groups = ceil_to_multiple(k, block_k) / block_k;
+    const size_t src_stride = src->info()->strides_in_bytes()[1];
+    const size_t dst_stride = dst->info()->strides_in_bytes()[1];
+    const size_t row_size   = packed_row_size(k, _sparsity);
+
+    const uint8_t *src_base = src->buffer() + src->info()->offset_first_element_in_bytes();
+    uint8_t       *dst_base = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    unsigned int num_invalid_groups = 0;
+    for (int cb = window.x().start(); cb < window.x().end(); ++cb)
+    {
+        uint8_t *dst_row = dst_base + cb * dst_stride;
+        std::memset(dst_row, 0, row_size);
+
+        const size_t col0 = cb * block_cols;
+        const size_t cols = std::min<size_t>(block_cols, n - col0);
+
+        // Read the values of a group, padded with zeros: block[i * block_cols + c] is the value i of column c
+        auto load_group = [&](size_t g, float *block)
+        {
+            for (unsigned int i = 0; i < block_k; ++i)
+            {
+                const size_t kk = g * block_k + i;
+                for (unsigned int c = 0; c < block_cols; ++c)
+                {
+                    block[i * block_cols + c] = 0.f;
+                    if (kk < k && c < cols)
+                    {
+                        std::memcpy(&block[i * block_cols + c], src_base + kk * src_stride + (col0 + c) * sizeof(float),
+                                    sizeof(float));
+                    }
+                }
+            }
+        };
+
+        if (_sparsity == WeightsSparsity::BLOCK_4X4)
+        {
+            int32_t *nnz     = reinterpret_cast<int32_t *>(dst_row);
+            int32_t *indices = nnz + 1;
+            float   *values  = reinterpret_cast<float *>(indices + num_groups);
+
+            *nnz = 0;
+            for (size_t g = 0; g < num_groups; ++g)
+            {
+                float *block = values + *nnz * block_k * block_cols;
+                load_group(g, block);
+
+                const bool is_zero = std::all_of(block, block + block_k * block_cols, [](float v) { return v == 0.f; });
+                if (!is_zero)
+                {
+                    indices[*nnz] = static_cast<int32_t>(g);
+                    ++(*nnz);
+                }
+            }
+        }
+        else
+        {
+            const size_t group_bytes = block_cols * (2 * sizeof(float) + 1);
+            for (size_t g = 0; g < num_groups; ++g)
+            {
+                float block[block_k * block_cols];
+                load_group(g, block);
+
+                float   *dst_values    = reinterpret_cast<float *>(dst_row + g * group_bytes);
+                uint8_t *dst_positions = dst_row + g * group_bytes + block_cols * 2 * sizeof(float);
+                for (unsigned int c = 0; c < block_cols; ++c)
+                {
+                    // Groups with more than 2 non-zero values are reported by validate_packed_values()
+                    unsigned int num_non_zeros = 0;
+                    for (unsigned int i = 0; i < block_k; ++i)
+                    {
+                        num_non_zeros += (block[i * block_cols + c] != 0.f) ? 1 : 0;
+                    }
+                    num_invalid_groups += (num_non_zeros > 2) ? 1 : 0;
+
+                    // Keep the 2 largest values, in the order of the K dimension
+                    unsigned int first = 0;
+                    for (unsigned int i = 1; i < block_k; ++i)
+                    {
+                        if (std::fabs(block[i * block_cols + c]) > std::fabs(block[first * block_cols + c]))
+                        {
+                            first = i;
+                        }
+                    }
+                    unsigned int second = (first == 0) ? 1 : 0;
+                    for (unsigned int i = second + 1; i < block_k; ++i)
+                    {
+                        if (i != first &&
+                            std::fabs(block[i * block_cols + c]) > std::fabs(block[second * block_cols + c]))
+                        {
+                            second = i;
+                        }
+                    }
+
+                    const unsigned int i0 = std::min(first, second);
+                    const unsigned int i1 = std::max(first, second);
+                    dst_values[2 * c]     = block[i0 * block_cols + c];
+                    dst_values[2 * c + 1] = block[i1 * block_cols + c];
+                    dst_positions[c]      = static_cast<uint8_t>(i0 | (i1 << 2));
+                }
+            }
+        }
+    }
+
+    if (num_invalid_groups != 0)
+    {
+        _num_invalid_groups.fetch_add(num_invalid_groups, std::memory_order_relaxed);
+    }
+}
+
+const char *CpuGemmSparsePackRhsKernel::name() const
+{
+    return "CpuGemmSparsePackRhsKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEPACKRHSKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEPACKRHSKERNEL_H
+
+#include "arm_compute/core/CoreTypes.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <atomic>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compress sparse weights for @ref CpuGemmSparseKernel
+ *
+ * The source is a dense matrix B of shape [N, K] with explicit zeros. The K dimension is split in groups of
+ * @ref block_k values and the destination is made of one row per block of @ref block_cols output columns:
+ * - WeightsSparsity::BLOCK_4X4: the number of non-zero blocks (int32), the index of the group of each non-zero block
+ *   (int32) and the block_k x block_cols F32 values of each non-zero block. The row is sized for fully dense weights
+ * - WeightsSparsity::STRUCTURED_2_4: for each group, the 2 values kept for each column (F32) followed by the positions
+ *   of these values in the group (one byte per column, first position in bits [0, 1] and second in bits [2, 3]). The
+ *   weights must have at most 2 non-zero values per group, see @ref validate_packed_values()
+ *
+ * Columns beyond N and values beyond K are padded with zeros.
+ */
+class CpuGemmSparsePackRhsKernel : public ICpuKernel<CpuGemmSparsePackRhsKernel>
+{
+public:
+    /** Number of output columns packed together */
+    static constexpr unsigned int block_cols = 4;
+    /** Number of values of the K dimension in a group */
+    static constexpr unsigned int block_k = 4;
+
+    CpuGemmSparsePackRhsKernel() = default;
+    /** Prevent instances of this class from being copied or moved, the threads packing the weights share its state */
+    CpuGemmSparsePackRhsKernel(const CpuGemmSparsePackRhsKernel &) = delete;
+    /** Prevent instances of this class from being copied or moved, the threads packing the weights share its state */
+    CpuGemmSparsePackRhsKernel &operator=(const CpuGemmSparsePackRhsKernel &) = delete;
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src      Source tensor info with the dense weights. Shape supported: [N, K]. Data type supported: F32
+     * @param[out] dst      Destination tensor info with the compressed weights. Data type supported: U8
+     * @param[in]  sparsity Sparsity pattern of the weights. WeightsSparsity::DENSE is not supported
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, WeightsSparsity sparsity);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmSparsePackRhsKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, WeightsSparsity sparsity);
+    /** Check that the weights packed since the last call followed the sparsity pattern
+     *
+     * Only WeightsSparsity::STRUCTURED_2_4 constrains the values: each group of @ref block_k values along K of each
+     * column must have at most 2 non-zero values. The kernel does not prune the weights: it counts the groups with more
+     * non-zero values while packing them, and the packed weights must not be used if this function returns an error.
+     *
+     * @note The count is reset by the call, so it must be called after each run of the kernel.
+     *
+     * @return a status
+     */
+    Status validate_packed_values();
+    /** Size in bytes of one row of the compressed weights
+     *
+     * @param[in] k        Number of values of the K dimension
+     * @param[in] sparsity Sparsity pattern of the weights
+     *
+     * @return The size in bytes
+     */
+    static size_t packed_row_size(size_t k, WeightsSparsity sparsity);
+    /** Shape of the compressed weights
+     *
+     * @param[in] src      Source tensor info with the dense weights
+     * @param[in] sparsity Sparsity pattern of the weights
+     *
+     * @return The shape of the compressed weights
+     */
+    static TensorShape compute_packed_shape(const ITensorInfo &src, WeightsSparsity sparsity);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    WeightsSparsity           _sparsity{WeightsSparsity::DENSE};
+    std::atomic<unsigned int> _num_invalid_groups{0};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEPACKRHSKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -115,6 +115,20 @@ struct SoftmaxKernelDataTypeISASelectorData
     uint64_t            sme2_vector_length;
 };
 
+struct GemmInt4DataTypeISASelectorData
+{
+    DataType            dt;
+    cpuinfo::CpuIsaInfo isa;
+    bool                quantize_lhs;
+};
+
+struct GemmSparseDataTypeISASelectorData
+{
+    DataType            dt;
+    cpuinfo::CpuIsaInfo isa;
+    WeightsSparsity     sparsity;
+};
+
 // Selector pointer types
 using DataTypeSelectorPtr               = std::add_pointer<bool(const DataTypeSelectorData &data)>::type;
 using DataTypeISASelectorPtr            = std::add_pointer<bool(const DataTypeISASelectorData &data)>::type;
@@ -132,6 +146,10 @@ using ScaleKernelDataTypeISASelectorDataPtr =
     std::add_pointer<bool(const ScaleKernelDataTypeISASelectorData &data)>::type;
 using SoftmaxKernelDataTypeISASelectorDataPtr =
     std::add_pointer<bool(const SoftmaxKernelDataTypeISASelectorData &data)>::type;
+using GemmInt4DataTypeISASelectorDataPtr =
+    std::add_pointer<bool(const GemmInt4DataTypeISASelectorData &data)>::type;
+using GemmSparseDataTypeISASelectorDataPtr =
+    std::add_pointer<bool(const GemmSparseDataTypeISASelectorData &data)>::type;
 } // namespace kernels
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Arm Limited.
+ * Copyright (c) 2022-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,8 +37,10 @@ void neon_q8_activation_lut(const ITensor *src, ITensor *dst, const ActivationLa
     ARM_COMPUTE_ERROR_ON( // LUT does not provide any performance benefit for ReLU as it's a single max() operation
         (src->info()->data_type() != DataType::QASYMM8 && src->info()->data_type() != DataType::QASYMM8_SIGNED) ||
         act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU);
-    const auto window_end_x  = window.x().end();
-    Window     win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    const auto window_start_x = window.x().start();
+    const auto window_end_x   = window.x().end();
+    const auto size           = window_end_x - window_start_x;
+    Window     win_collapsed  = window.collapse_if_possible(window, Window::DimZ);
     win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
     Iterator input(src, win_collapsed);
     Iterator output(dst, win_collapsed);
@@ -46,9 +48,9 @@ void neon_q8_activation_lut(const ITensor *src, ITensor *dst, const ActivationLa
         win_collapsed,
         [&](const Coordinates &)
         {
-            const auto input_ptr  = reinterpret_cast<const uint8_t *>(input.ptr());
-            auto       output_ptr = reinterpret_cast<uint8_t *>(output.ptr());
-            lut_u8_neon(act_info.lut().data(), 1u, window_end_x, &input_ptr, &output_ptr);
+            const auto input_ptr  = reinterpret_cast<const uint8_t *>(input.ptr()) + window_start_x;
+            auto       output_ptr = reinterpret_cast<uint8_t *>(output.ptr()) + window_start_x;
+            lut_u8_neon(act_info.lut().data(), 1u, size, &input_ptr, &output_ptr);
         },
         input, output);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -344,6 +344,15 @@ CpuActivationKernelHeuristics::CpuActivationKernelHeuristics(const ITensorInfo
     {
         _mws = calculate_mws(cpu_model, src->data_type(), activation_info.activation(), src->tensor_shape().x());
     }
+    else if (std::string(_kernel->name) != "sme2_fp32_logistic")
+    {
+        // The window could not be squashed: let the scheduler pick the split from the cost of the workload as the
+        // rows alone might be too few to keep all the threads busy
+        IScheduler::WorkloadCost cost{};
+        cost.macs  = src->tensor_shape().total_size();
+        cost.bytes = 2 * cost.macs * src->element_size();
+        _hint.set_cost(cost);
+    }
 }
 
 /** Return minimum workload size
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -109,6 +109,7 @@ struct GemmConfig
     std::string  filter           = "";
     unsigned int inner_block_size = 0;
     unsigned int outer_block_size = 0;
+    unsigned int m_block_size     = 0;
     WeightFormat weight_format    = WeightFormat::ANY;
 
     GemmConfig(GemmMethod method) : method(method)
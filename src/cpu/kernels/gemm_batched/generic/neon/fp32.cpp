@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+#include "arm_compute/function_info/GEMMBatchedInfo.h"
+
+#include "src/cpu/kernels/CpuGemmBatchedKernel.h"
+#include "src/cpu/kernels/CpuGemmBatchedPackRhsKernel.h"
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+constexpr size_t block_cols = kernels::CpuGemmBatchedPackRhsKernel::block_cols;
+constexpr size_t block_rows = kernels::CpuGemmBatchedKernel::block_rows;
+
+inline float32x4_t mla(float32x4_t acc, float32x4_t a, float b)
+{
+#ifdef __aarch64__
+    return vfmaq_n_f32(acc, a, b);
+#else  // __aarch64__
+    return vmlaq_n_f32(acc, a, b);
+#endif // __aarch64__
+}
+
+/** Multiply R rows of A by a panel of block_cols columns of the packed B
+ *
+ * acc[r][0] and acc[r][1] hold the first and the last 4 columns of the row r.
+ */
+template <size_t R>
+inline void compute_tile(const float *const *a, const float *panel, size_t k, float32x4_t (*acc)[2])
+{
+    for (size_t r = 0; r < R; ++r)
+    {
+        acc[r][0] = vdupq_n_f32(0.f);
+        acc[r][1] = vdupq_n_f32(0.f);
+    }
+
+    for (size_t kk = 0; kk < k; ++kk)
+    {
+        const float32x4_t b0 = vld1q_f32(panel);
+        const float32x4_t b1 = vld1q_f32(panel + 4);
+        panel += block_cols;
+
+        for (size_t r = 0; r < R; ++r)
+        {
+            acc[r][0] = mla(acc[r][0], b0, a[r][kk]);
+            acc[r][1] = mla(acc[r][1], b1, a[r][kk]);
+        }
+    }
+}
+
+inline float32x4_t activate(float32x4_t v, const ActivationLayerInfo &act_info, float32x4_t a, float32x4_t b)
+{
+    switch (act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::RELU:
+            return vmaxq_f32(v, vdupq_n_f32(0.f));
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+            return vminq_f32(vmaxq_f32(v, vdupq_n_f32(0.f)), a);
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+            return vminq_f32(vmaxq_f32(v, b), a);
+        default:
+            return v;
+    }
+}
+} // namespace
+
+void neon_fp32_gemm_batched(const uint8_t             *lhs,
+                            const uint8_t             *rhs,
+                            const uint8_t             *bias,
+                            uint8_t                   *dst,
+                            const GEMMBatchedProblem  &problem,
+                            const ActivationLayerInfo &act_info)
+{
+    const size_t m = problem.m;
+    const size_t n = problem.n;
+    const size_t k = problem.k;
+
+    const float *a_base    = reinterpret_cast<const float *>(lhs);
+    const float *b_base    = reinterpret_cast<const float *>(rhs);
+    const float *bias_base = reinterpret_cast<const float *>(bias);
+    float       *d_base    = reinterpret_cast<float *>(dst);
+
+    const ActivationLayerInfo act = act_info.enabled() ? act_info : ActivationLayerInfo();
+    const float32x4_t         va  = vdupq_n_f32(act.a());
+    const float32x4_t         vb  = vdupq_n_f32(act.b());
+
+    for (size_t row0 = 0; row0 < m; row0 += block_rows)
+    {
+        const size_t rows = std::min<size_t>(block_rows, m - row0);
+
+        // The rows beyond M point to the last row and are not stored
+        const float *a[block_rows];
+        for (size_t r = 0; r < block_rows; ++r)
+        {
+            a[r] = a_base + (row0 + std::min(r, rows - 1)) * problem.lda;
+        }
+
+        for (size_t col0 = 0; col0 < n; col0 += block_cols)
+        {
+            const size_t cols  = std::min<size_t>(block_cols, n - col0);
+            const float *panel = b_base + col0 * k;
+
+            float32x4_t acc[block_rows][2];
+            switch (rows)
+            {
+                case 1:
+                    compute_tile<1>(a, panel, k, acc);
+                    break;
+                case 2:
+                    compute_tile<2>(a, panel, k, acc);
+                    break;
+                case 3:
+                    compute_tile<3>(a, panel, k, acc);
+                    break;
+                default:
+                    compute_tile<block_rows>(a, panel, k, acc);
+                    break;
+            }
+
+            float32x4_t bias0 = vdupq_n_f32(0.f);
+            float32x4_t bias1 = vdupq_n_f32(0.f);
+            if (bias_base != nullptr)
+            {
+                float values[block_cols] = {};
+                std::copy(bias_base + col0, bias_base + col0 + cols, values);
+                bias0 = vld1q_f32(values);
+                bias1 = vld1q_f32(values + 4);
+            }
+
+            for (size_t r = 0; r < rows; ++r)
+            {
+                const float32x4_t out0 = activate(vaddq_f32(acc[r][0], bias0), act, va, vb);
+                const float32x4_t out1 = activate(vaddq_f32(acc[r][1], bias1), act, va, vb);
+
+                float *d = d_base + (row0 + r) * problem.ldd + col0;
+                if (cols == block_cols)
+                {
+                    vst1q_f32(d, out0);
+                    vst1q_f32(d + 4, out1);
+                }
+                else
+                {
+                    float values[block_cols];
+                    vst1q_f32(values, out0);
+                    vst1q_f32(values + 4, out1);
+                    std::copy(values, values + cols, d);
+                }
+            }
+        }
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
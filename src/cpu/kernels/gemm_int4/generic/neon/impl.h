@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GEMM_INT4_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_GEMM_INT4_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/CpuGemmInt4Kernel.h"
+#include "src/cpu/kernels/CpuGemmInt4PackRhsKernel.h"
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace gemm_int4
+{
+constexpr size_t block_cols = kernels::CpuGemmInt4PackRhsKernel::block_cols;
+constexpr size_t block_rows = kernels::CpuGemmInt4Kernel::block_rows;
+
+inline float32x4_t load_f32(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void store_f32(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t load_f32(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store_f32(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline float32x4_t mla(float32x4_t acc, float32x4_t a, float32x4_t b)
+{
+#ifdef __aarch64__
+    return vfmaq_f32(acc, a, b);
+#else  // __aarch64__
+    return vmlaq_f32(acc, a, b);
+#endif // __aarch64__
+}
+
+/** Sum the lanes of each vector: lane i of the result is the sum of the lanes of v[i] */
+inline float32x4_t reduce_add(const float32x4_t *v)
+{
+    const float32x2_t s0 = vpadd_f32(vget_low_f32(v[0]), vget_high_f32(v[0]));
+    const float32x2_t s1 = vpadd_f32(vget_low_f32(v[1]), vget_high_f32(v[1]));
+    const float32x2_t s2 = vpadd_f32(vget_low_f32(v[2]), vget_high_f32(v[2]));
+    const float32x2_t s3 = vpadd_f32(vget_low_f32(v[3]), vget_high_f32(v[3]));
+    return vcombine_f32(vpadd_f32(s0, s1), vpadd_f32(s2, s3));
+}
+
+inline int32x4_t reduce_add(const int32x4_t *v)
+{
+    const int32x2_t s0 = vpadd_s32(vget_low_s32(v[0]), vget_high_s32(v[0]));
+    const int32x2_t s1 = vpadd_s32(vget_low_s32(v[1]), vget_high_s32(v[1]));
+    const int32x2_t s2 = vpadd_s32(vget_low_s32(v[2]), vget_high_s32(v[2]));
+    const int32x2_t s3 = vpadd_s32(vget_low_s32(v[3]), vget_high_s32(v[3]));
+    return vcombine_s32(vpadd_s32(s0, s1), vpadd_s32(s2, s3));
+}
+
+/** Split 16 packed bytes in the 16 values of the low nibbles and the 16 values of the high nibbles */
+inline void unpack_int4(const uint8_t *ptr, int8x16_t &lo, int8x16_t &hi)
+{
+    const int8x16_t packed = vreinterpretq_s8_u8(vld1q_u8(ptr));
+    lo                     = vshrq_n_s8(vshlq_n_s8(packed, 4), 4);
+    hi                     = vshrq_n_s8(packed, 4);
+}
+
+inline void convert_s8_f32(int8x16_t v, float32x4_t *out)
+{
+    const int16x8_t lo = vmovl_s8(vget_low_s8(v));
+    const int16x8_t hi = vmovl_s8(vget_high_s8(v));
+    out[0]             = vcvtq_f32_s32(vmovl_s16(vget_low_s16(lo)));
+    out[1]             = vcvtq_f32_s32(vmovl_s16(vget_high_s16(lo)));
+    out[2]             = vcvtq_f32_s32(vmovl_s16(vget_low_s16(hi)));
+    out[3]             = vcvtq_f32_s32(vmovl_s16(vget_high_s16(hi)));
+}
+
+/** Get the value at index @p idx of a column of a packed group */
+inline int8_t get_packed_int4(const uint8_t *values, size_t idx)
+{
+    const uint8_t byte = values[(idx / 32) * 16 + idx % 16];
+    return (idx % 32 < 16) ? static_cast<int8_t>(byte << 4) >> 4 : static_cast<int8_t>(byte) >> 4;
+}
+
+/** Multiply R rows of a F32/F16 LHS by a block of packed weights, dequantizing the weights on the fly */
+template <typename T, size_t R>
+inline void
+compute_block(const uint8_t *const *lhs, const uint8_t *rhs, size_t k, unsigned int group_size, float32x4_t *res)
+{
+    const size_t group_bytes = kernels::CpuGemmInt4PackRhsKernel::packed_group_size(group_size);
+    const size_t col_bytes   = group_size / 2;
+
+    const T *a[R];
+    for (size_t r = 0; r < R; ++r)
+    {
+        a[r] = reinterpret_cast<const T *>(lhs[r]);
+    }
+
+    float32x4_t acc[R][block_cols];
+    float       tail[R][block_cols] = {};
+    for (size_t r = 0; r < R; ++r)
+    {
+        for (size_t c = 0; c < block_cols; ++c)
+        {
+            acc[r][c] = vdupq_n_f32(0.f);
+        }
+    }
+
+    for (size_t k0 = 0; k0 < k; k0 += group_size)
+    {
+        const uint8_t *group  = rhs + (k0 / group_size) * group_bytes;
+        const float   *scales = reinterpret_cast<const float *>(group + block_cols * col_bytes);
+        const float   *zeros  = scales + block_cols;
+        const size_t   len    = std::min<size_t>(group_size, k - k0);
+        const size_t   len32  = len - len % 32;
+
+        for (size_t c = 0; c < block_cols; ++c)
+        {
+            const uint8_t    *values = group + c * col_bytes;
+            const float32x4_t vscale = vdupq_n_f32(scales[c]);
+            const float32x4_t vzero  = vdupq_n_f32(zeros[c]);
+
+            for (size_t i = 0; i < len32; i += 32)
+            {
+                int8x16_t lo;
+                int8x16_t hi;
+                unpack_int4(values + i / 2, lo, hi);
+
+                float32x4_t w[8];
+                convert_s8_f32(lo, w);
+                convert_s8_f32(hi, w + 4);
+                for (size_t j = 0; j < 8; ++j)
+                {
+                    w[j] = vsubq_f32(vmulq_f32(w[j], vscale), vzero);
+                }
+
+                for (size_t r = 0; r < R; ++r)
+                {
+                    const T *a_ptr = a[r] + k0 + i;
+                    for (size_t j = 0; j < 8; ++j)
+                    {
+                        acc[r][c] = mla(acc[r][c], load_f32(a_ptr + 4 * j), w[j]);
+                    }
+                }
+            }
+
+            // Left-over values of a partial group
+            for (size_t i = len32; i < len; ++i)
+            {
+                const float w = static_cast<float>(get_packed_int4(values, i)) * scales[c] - zeros[c];
+                for (size_t r = 0; r < R; ++r)
+                {
+                    tail[r][c] += static_cast<float>(a[r][k0 + i]) * w;
+                }
+            }
+        }
+    }
+
+    for (size_t r = 0; r < R; ++r)
+    {
+        res[r] = vaddq_f32(reduce_add(acc[r]), vld1q_f32(tail[r]));
+    }
+}
+
+/** Multiply R rows of a LHS quantized to signed 8-bit values by a block of packed weights */
+template <size_t R>
+inline void compute_block_quantized_lhs(
+    const uint8_t *const *lhs, const uint8_t *rhs, size_t num_groups, unsigned int group_size, float32x4_t *res)
+{
+    const size_t group_bytes     = kernels::CpuGemmInt4PackRhsKernel::packed_group_size(group_size);
+    const size_t col_bytes       = group_size / 2;
+    const size_t lhs_group_bytes = group_size + 2 * sizeof(float);
+
+    for (size_t r = 0; r < R; ++r)
+    {
+        res[r] = vdupq_n_f32(0.f);
+    }
+
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+        const uint8_t *group = rhs + g * group_bytes;
+
+        int32x4_t acc[R][block_cols];
+        for (size_t r = 0; r < R; ++r)
+        {
+            for (size_t c = 0; c < block_cols; ++c)
+            {
+                acc[r][c] = vdupq_n_s32(0);
+            }
+        }
+
+        for (size_t i = 0; i < group_size; i += 32)
+        {
+            int8x16_t lo[block_cols];
+            int8x16_t hi[block_cols];
+            for (size_t c = 0; c < block_cols; ++c)
+            {
+                unpack_int4(group + c * col_bytes + i / 2, lo[c], hi[c]);
+            }
+
+            for (size_t r = 0; r < R; ++r)
+            {
+                const int8_t   *a_ptr = reinterpret_cast<const int8_t *>(lhs[r] + g * lhs_group_bytes + i);
+                const int8x16_t a0    = vld1q_s8(a_ptr);
+                const int8x16_t a1    = vld1q_s8(a_ptr + 16);
+                for (size_t c = 0; c < block_cols; ++c)
+                {
+                    // The products of 8-bit and 4-bit values can be accumulated in pairs in 16 bits without overflow
+                    int16x8_t p0 = vmull_s8(vget_low_s8(a0), vget_low_s8(lo[c]));
+                    int16x8_t p1 = vmull_s8(vget_low_s8(a1), vget_low_s8(hi[c]));
+                    p0           = vmlal_s8(p0, vget_high_s8(a0), vget_high_s8(lo[c]));
+                    p1           = vmlal_s8(p1, vget_high_s8(a1), vget_high_s8(hi[c]));
+                    acc[r][c]    = vpadalq_s16(acc[r][c], p0);
+                    acc[r][c]    = vpadalq_s16(acc[r][c], p1);
+                }
+            }
+        }
+
+        // Apply the scales of the group: res += dot * lhs_scale * scale - lhs_scale * sum(lhs) * zero_point * scale
+        const float      *scales = reinterpret_cast<const float *>(group + block_cols * col_bytes);
+        const float32x4_t vscale = vld1q_f32(scales);
+        const float32x4_t vzero  = vld1q_f32(scales + block_cols);
+        for (size_t r = 0; r < R; ++r)
+        {
+            float footer[2];
+            std::memcpy(footer, lhs[r] + g * lhs_group_bytes + group_size, sizeof(footer));
+
+            const float32x4_t dot = vcvtq_f32_s32(reduce_add(acc[r]));
+            res[r]                = mla(res[r], dot, vmulq_n_f32(vscale, footer[0]));
+            res[r]                = vsubq_f32(res[r], vmulq_n_f32(vzero, footer[1]));
+        }
+    }
+}
+
+template <typename T, bool QuantizedLhs, size_t R>
+inline void compute_rows(const uint8_t *const *lhs,
+                         const uint8_t        *rhs,
+                         size_t                k,
+                         size_t                num_groups,
+                         unsigned int          group_size,
+                         float32x4_t          *res)
+{
+    if (QuantizedLhs)
+    {
+        compute_block_quantized_lhs<R>(lhs, rhs, num_groups, group_size, res);
+    }
+    else
+    {
+        compute_block<T, R>(lhs, rhs, k, group_size, res);
+    }
+}
+
+template <typename T, bool QuantizedLhs>
+void gemm_int4(const ITensor *lhs,
+               const ITensor *rhs,
+               const ITensor *bias,
+               ITensor       *dst,
+               unsigned int   group_size,
+               const Window  &window)
+{
+    const size_t k           = lhs->info()->dimension(0);
+    const size_t m           = dst->info()->dimension(1);
+    const size_t n           = dst->info()->dimension(0);
+    const size_t group_bytes = kernels::CpuGemmInt4PackRhsKernel::packed_group_size(group_size);
+    const size_t num_groups  = rhs->info()->dimension(0) / group_bytes;
+
+    const Strides &lhs_strides = lhs->info()->strides_in_bytes();
+    const Strides &dst_strides = dst->info()->strides_in_bytes();
+    const size_t   rhs_stride  = rhs->info()->strides_in_bytes()[1];
+
+    const uint8_t *lhs_base = lhs->buffer() + lhs->info()->offset_first_element_in_bytes();
+    const uint8_t *rhs_base = rhs->buffer() + rhs->info()->offset_first_element_in_bytes();
+    uint8_t       *dst_base = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    const T *bias_ptr = nullptr;
+    if (bias != nullptr)
+    {
+        bias_ptr = reinterpret_cast<const T *>(bias->buffer() + bias->info()->offset_first_element_in_bytes());
+    }
+
+    for (int b = window.z().start(); b < window.z().end(); ++b)
+    {
+        for (int rb = window.y().start(); rb < window.y().end(); ++rb)
+        {
+            const size_t row0 = rb * block_rows;
+            const size_t rows = std::min<size_t>(block_rows, m - row0);
+
+            const uint8_t *a[block_rows];
+            for (size_t r = 0; r < block_rows; ++r)
+            {
+                a[r] = lhs_base + b * lhs_strides[2] + (row0 + std::min(r, rows - 1)) * lhs_strides[1];
+            }
+
+            for (int cb = window.x().start(); cb < window.x().end(); ++cb)
+            {
+                const uint8_t *rhs_ptr = rhs_base + cb * rhs_stride;
+
+                float32x4_t res[block_rows];
+                switch (rows)
+                {
+                    case 1:
+                        compute_rows<T, QuantizedLhs, 1>(a, rhs_ptr, k, num_groups, group_size, res);
+                        break;
+                    case 2:
+                        compute_rows<T, QuantizedLhs, 2>(a, rhs_ptr, k, num_groups, group_size, res);
+                        break;
+                    case 3:
+                        compute_rows<T, QuantizedLhs, 3>(a, rhs_ptr, k, num_groups, group_size, res);
+                        break;
+                    default:
+                        compute_rows<T, QuantizedLhs, block_rows>(a, rhs_ptr, k, num_groups, group_size, res);
+                        break;
+                }
+
+                const size_t col0 = cb * block_cols;
+                const size_t cols = std::min<size_t>(block_cols, n - col0);
+                for (size_t r = 0; r < rows; ++r)
+                {
+                    uint8_t *dst_row = dst_base + b * dst_strides[2] + (row0 + r) * dst_strides[1];
+                    T       *dst_ptr = reinterpret_cast<T *>(dst_row) + col0;
+                    if (cols == block_cols)
+                    {
+                        float32x4_t out = res[r];
+                        if (bias_ptr != nullptr)
+                        {
+                            out = vaddq_f32(out, load_f32(bias_ptr + col0));
+                        }
+                        store_f32(dst_ptr, out);
+                    }
+                    else
+                    {
+                        float out[block_cols];
+                        vst1q_f32(out, res[r]);
+                        for (size_t c = 0; c < cols; ++c)
+                        {
+                            const float bias_value =
+                                (bias_ptr != nullptr) ? static_cast<float>(bias_ptr[col0 + c]) : 0.f;
+                            dst_ptr[c] = static_cast<T>(out[c] + bias_value);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+} // namespace gemm_int4
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GEMM_INT4_GENERIC_NEON_IMPL_H
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GEMM_SPARSE_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_GEMM_SPARSE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/CpuGemmSparseKernel.h"
+#include "src/cpu/kernels/CpuGemmSparsePackRhsKernel.h"
+
+#include <arm_neon.h>
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace gemm_sparse
+{
+constexpr size_t block_cols = kernels::CpuGemmSparsePackRhsKernel::block_cols;
+constexpr size_t block_k    = kernels::CpuGemmSparsePackRhsKernel::block_k;
+constexpr size_t block_rows = kernels::CpuGemmSparseKernel::block_rows;
+
+inline float32x4_t mla(float32x4_t acc, float32x4_t a, float b)
+{
+#ifdef __aarch64__
+    return vfmaq_n_f32(acc, a, b);
+#else  // __aarch64__
+    return vmlaq_n_f32(acc, a, b);
+#endif // __aarch64__
+}
+
+/** Load a group of values of a LHS row, padded with zeros beyond K */
+inline float32x4_t load_group(const float *ptr, size_t len)
+{
+    if (len >= block_k)
+    {
+        return vld1q_f32(ptr);
+    }
+    float values[block_k] = {};
+    std::copy(ptr, ptr + len, values);
+    return vld1q_f32(values);
+}
+
+/** Transpose a 4x4 block of values held in 4 vectors */
+inline void transpose_4x4(float32x4_t *v)
+{
+    const float32x4x2_t t01 = vtrnq_f32(v[0], v[1]);
+    const float32x4x2_t t23 = vtrnq_f32(v[2], v[3]);
+    v[0]                    = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    v[1]                    = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    v[2]                    = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    v[3]                    = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+
+/** Multiply 4 rows of the LHS by a block of 2:4 structured weights
+ *
+ * The groups of the 4 rows are transposed so that each kept value of a column is multiplied with the 4 rows at once:
+ * each group needs 2 multiplications per column instead of 4.
+ */
+inline void compute_block_2_4(const float *const *a, const uint8_t *rhs, size_t k, float32x4_t *res)
+{
+    const size_t group_bytes = block_cols * (2 * sizeof(float) + 1);
+    const size_t num_groups  = ceil_to_multiple(k, block_k) / block_k;
+
+    // Lane r of acc[c] accumulates the row r of the column c
+    float32x4_t acc[block_cols];
+    for (size_t c = 0; c < block_cols; ++c)
+    {
+        acc[c] = vdupq_n_f32(0.f);
+    }
+
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+        const size_t k0  = g * block_k;
+        const size_t len = std::min<size_t>(block_k, k - k0);
+
+        // Lane r of lhs[i] holds the value i of the group of row r
+        float32x4_t lhs[block_rows];
+        for (size_t r = 0; r < block_rows; ++r)
+        {
+            lhs[r] = load_group(a[r] + k0, len);
+        }
+        transpose_4x4(lhs);
+
+        const float   *w   = reinterpret_cast<const float *>(rhs + g * group_bytes);
+        const uint8_t *pos = rhs + g * group_bytes + block_cols * 2 * sizeof(float);
+        for (size_t c = 0; c < block_cols; ++c)
+        {
+            acc[c] = mla(acc[c], lhs[pos[c] & 0x3], w[2 * c]);
+            acc[c] = mla(acc[c], lhs[pos[c] >> 2], w[2 * c + 1]);
+        }
+    }
+
+    transpose_4x4(acc);
+    for (size_t r = 0; r < block_rows; ++r)
+    {
+        res[r] = acc[r];
+    }
+}
+
+/** Multiply R rows of the LHS by a block of block-sparse weights, skipping the zero blocks */
+template <size_t R>
+inline void compute_block_sparse(const float *const *a, const uint8_t *rhs, size_t k, float32x4_t *res)
+{
+    const size_t   num_groups = ceil_to_multiple(k, block_k) / block_k;
+    const int32_t *nnz        = reinterpret_cast<const int32_t *>(rhs);
+    const int32_t *indices    = nnz + 1;
+    const float   *values     = reinterpret_cast<const float *>(indices + num_groups);
+
+    float32x4_t acc[R];
+    for (size_t r = 0; r < R; ++r)
+    {
+        acc[r] = vdupq_n_f32(0.f);
+    }
+
+    for (int32_t j = 0; j < *nnz; ++j)
+    {
+        const size_t k0 = indices[j] * block_k;
+        const float *w  = values + j * block_k * block_cols;
+        if (k0 + block_k <= k)
+        {
+            float32x4_t wv[block_k];
+            for (size_t i = 0; i < block_k; ++i)
+            {
+                wv[i] = vld1q_f32(w + i * block_cols);
+            }
+            for (size_t r = 0; r < R; ++r)
+            {
+                for (size_t i = 0; i < block_k; ++i)
+                {
+                    acc[r] = mla(acc[r], wv[i], a[r][k0 + i]);
+                }
+            }
+        }
+        else
+        {
+            // Partial group at the end of the K dimension
+            for (size_t i = 0; i < k - k0; ++i)
+            {
+                const float32x4_t wv = vld1q_f32(w + i * block_cols);
+                for (size_t r = 0; r < R; ++r)
+                {
+                    acc[r] = mla(acc[r], wv, a[r][k0 + i]);
+                }
+            }
+        }
+    }
+
+    for (size_t r = 0; r < R; ++r)
+    {
+        res[r] = acc[r];
+    }
+}
+
+template <WeightsSparsity Sparsity, size_t R>
+inline void compute_rows(const float *const *a, const uint8_t *rhs, size_t k, float32x4_t *res)
+{
+    if (Sparsity == WeightsSparsity::STRUCTURED_2_4)
+    {
+        // All the rows are computed at once, the rows beyond M are duplicates of the last row
+        compute_block_2_4(a, rhs, k, res);
+    }
+    else
+    {
+        compute_block_sparse<R>(a, rhs, k, res);
+    }
+}
+
+template <WeightsSparsity Sparsity>
+void gemm_sparse(const ITensor *lhs, const ITensor *rhs, const ITensor *bias, ITensor *dst, const Window &window)
+{
+    const size_t k = lhs->info()->dimension(0);
+    const size_t m = dst->info()->dimension(1);
+    const size_t n = dst->info()->dimension(0);
+
+    const Strides &lhs_strides = lhs->info()->strides_in_bytes();
+    const Strides &dst_strides = dst->info()->strides_in_bytes();
+    const size_t   rhs_stride  = rhs->info()->strides_in_bytes()[1];
+
+    const uint8_t *lhs_base = lhs->buffer() + lhs->info()->offset_first_element_in_bytes();
+    const uint8_t *rhs_base = rhs->buffer() + rhs->info()->offset_first_element_in_bytes();
+    uint8_t       *dst_base = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    const float *bias_ptr = nullptr;
+    if (bias != nullptr)
+    {
+        bias_ptr = reinterpret_cast<const float *>(bias->buffer() + bias->info()->offset_first_element_in_bytes());
+    }
+
+    for (int b = window.z().start(); b < window.z().end(); ++b)
+    {
+        for (int rb = window.y().start(); rb < window.y().end(); ++rb)
+        {
+            const size_t row0 = rb * block_rows;
+            const size_t rows = std::min<size_t>(block_rows, m - row0);
+
+            const float *a[block_rows];
+            for (size_t r = 0; r < block_rows; ++r)
+            {
+                a[r] = reinterpret_cast<const float *>(lhs_base + b * lhs_strides[2] +
+                                                       (row0 + std::min(r, rows - 1)) * lhs_strides[1]);
+            }
+
+            for (int cb = window.x().start(); cb < window.x().end(); ++cb)
+            {
+                const uint8_t *rhs_ptr = rhs_base + cb * rhs_stride;
+
+                float32x4_t res[block_rows];
+                switch (rows)
+                {
+                    case 1:
+                        compute_rows<Sparsity, 1>(a, rhs_ptr, k, res);
+                        break;
+                    case 2:
+                        compute_rows<Sparsity, 2>(a, rhs_ptr, k, res);
+                        break;
+                    case 3:
+                        compute_rows<Sparsity, 3>(a, rhs_ptr, k, res);
+                        break;
+                    default:
+                        compute_rows<Sparsity, block_rows>(a, rhs_ptr, k, res);
+                        break;
+                }
+
+                const size_t col0 = cb * block_cols;
+                const size_t cols = std::min<size_t>(block_cols, n - col0);
+                for (size_t r = 0; r < rows; ++r)
+                {
+                    uint8_t *dst_row = dst_base + b * dst_strides[2] + (row0 + r) * dst_strides[1];
+                    float   *dst_ptr = reinterpret_cast<float *>(dst_row) + col0;
+                    if (cols == block_cols)
+                    {
+                        float32x4_t out = res[r];
+                        if (bias_ptr != nullptr)
+                        {
+                            out = vaddq_f32(out, vld1q_f32(bias_ptr + col0));
+                        }
+                        vst1q_f32(dst_ptr, out);
+                    }
+                    else
+                    {
+                        float out[block_cols];
+                        vst1q_f32(out, res[r]);
+                        for (size_t c = 0; c < cols; ++c)
+                        {
+                            dst_ptr[c] = out[c] + ((bias_ptr != nullptr) ? bias_ptr[col0 + c] : 0.f);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+} // namespace gemm_sparse
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GEMM_SPARSE_GENERIC_NEON_IMPL_H
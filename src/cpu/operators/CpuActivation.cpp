@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,8 +52,8 @@ CpuActivation::validate(const ITensorInfo *input, const ITensorInfo *output, con
 void CpuActivation::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
-    auto split_dimension = static_cast<kernels::CpuActivationKernel *>(_kernel.get())->get_split_dimension_hint();
-    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+    const auto &hints = static_cast<kernels::CpuActivationKernel *>(_kernel.get())->get_scheduler_hint();
+    NEScheduler::get().schedule_op(_kernel.get(), hints, _kernel->window(), tensors);
 }
 
 std::tuple<IOperator *, StatusCode> CpuContext::create_activation(const AclTensorDescriptor     &src,
@@ -31,6 +31,7 @@
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuGemmConv2d.h"
 #include "src/cpu/operators/CpuGemmDirectConv2d.h"
+#include "src/cpu/operators/CpuGroupedConv2d.h"
 #include "src/cpu/operators/CpuWinogradConv2d.h"
 
 namespace arm_compute
@@ -56,13 +57,23 @@ void CpuConv2d::configure(ITensorInfo               *input,
 {
     // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups);
     ARM_COMPUTE_ERROR_THROW_ON(CpuConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation,
                                                    act_info, enable_fast_math, num_groups));
 
     ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
                            enable_fast_math, num_groups);
 
+    if (num_groups != 1)
+    {
+        // Grouped convolutions run all their groups as a single batched GEMM
+        auto f = std::make_unique<CpuGroupedConv2d>();
+        f->configure(input, weights, biases, output,
+                     Conv2dInfo(conv_info, dilation, act_info, enable_fast_math, num_groups, weights_info));
+        _function = std::move(f);
+        _aux_mem  = _function->workspace();
+        return;
+    }
+
     const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
     switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
                                               enable_fast_math))
@@ -114,7 +125,12 @@ Status CpuConv2d::validate(const ITensorInfo         *input,
                            bool                       enable_fast_math,
                            unsigned int               num_groups)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on Neon");
+    if (num_groups != 1)
+    {
+        return CpuGroupedConv2d::validate(
+            input, weights, biases, output,
+            Conv2dInfo(conv_info, dilation, act_info, enable_fast_math, num_groups, weights_info));
+    }
 
     const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
     switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
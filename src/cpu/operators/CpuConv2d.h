@@ -38,6 +38,7 @@ namespace cpu
  * -# @ref CpuGemm     (executed only in case GEMM is required for the operation)
  * -# @ref CpuWinogradConv2d (executed only in case Winograd is required for the operation)
  * -# @ref CpuDirectConv2d   (executed only in case Direct Convolution is required for the operation)
+ * -# @ref CpuGroupedConv2d  (executed only in case of a grouped convolution)
  *
  *
  * The function selects one of the algorithms mentioned above based on:
@@ -106,7 +107,7 @@ public:
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
-     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported with F32 NHWC 1x1 convolutions without stride nor padding
      */
     void configure(ITensorInfo               *src,
                    ITensorInfo               *weights,
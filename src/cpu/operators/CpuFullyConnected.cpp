@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, 2025 Arm Limited.
+ * Copyright (c) 2021-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -89,7 +89,9 @@ Status validate_mm(const ITensorInfo         *src,
                    const ITensorInfo         *dst,
                    const ActivationLayerInfo &act,
                    bool                       enable_fast_math,
-                   WeightFormat               weight_format)
+                   WeightFormat               weight_format,
+                   const Int4WeightsInfo     &int4_weights_info,
+                   WeightsSparsity            weights_sparsity)
 {
     if (is_data_type_quantized_asymmetric(src->data_type()))
     {
@@ -120,6 +122,8 @@ Status validate_mm(const ITensorInfo         *src,
         gemm_info.set_fixed_format(weight_format != WeightFormat::UNSPECIFIED);
         gemm_info.set_fast_math(enable_fast_math);
         gemm_info.set_activation_info(act);
+        gemm_info.set_int4_weights_info(int4_weights_info);
+        gemm_info.set_weights_sparsity(weights_sparsity);
         ARM_COMPUTE_RETURN_ON_ERROR(CpuGemm::validate(src, weights, biases, dst, 1.f, 1.0f, gemm_info));
     }
 
@@ -138,6 +142,7 @@ CpuFullyConnected::CpuFullyConnected()
       _reshaped_weights(),
       _trans_weights(),
       _trans_weights_idx(AuxTensorIdx::Count),
+      _src_shape(),
       _aux_mem(Count),
       _needs_weights_conversion(false),
       _needs_weights_reshape(false),
@@ -147,7 +152,10 @@ CpuFullyConnected::CpuFullyConnected()
       _enable_fast_math(false),
       _fixed_format(false),
       _weight_format(arm_compute::WeightFormat::UNSPECIFIED),
-      _dynamic_weights(false)
+      _int4_weights_info(),
+      _weights_sparsity(WeightsSparsity::DENSE),
+      _dynamic_weights(false),
+      _is_dynamic(false)
 {
 }
 
@@ -192,6 +200,8 @@ void CpuFullyConnected::configure_mm(const ITensorInfo         *src,
         gemm_info.set_fast_math(_enable_fast_math);
         gemm_info.set_fixed_format(_fixed_format);
         gemm_info.set_weight_format(_weight_format);
+        gemm_info.set_int4_weights_info(_int4_weights_info);
+        gemm_info.set_weights_sparsity(_weights_sparsity);
         _mm_gemm = std::make_unique<CpuGemm>();
         _mm_gemm->configure(src, weights, biases, dst, 1.f, 1.0f, gemm_info);
     }
@@ -203,7 +213,8 @@ void CpuFullyConnected::configure_conv_fc(const ITensorInfo         *src,
                                           ITensorInfo               *dst,
                                           const ActivationLayerInfo &act)
 {
-    ARM_COMPUTE_ERROR_ON((weights->dimension(1) != (src->dimension(0) * src->dimension(1) * src->dimension(2))));
+    ARM_COMPUTE_ERROR_ON(!_int4_weights_info.enabled() &&
+                         (weights->dimension(1) != (src->dimension(0) * src->dimension(1) * src->dimension(2))));
 
     // If the fully connected layer is called after a convolution layer, the src tensor must be linearized
 
@@ -223,7 +234,7 @@ void CpuFullyConnected::configure_fc_fc(const ITensorInfo         *src,
                                         ITensorInfo               *dst,
                                         const ActivationLayerInfo &act)
 {
-    ARM_COMPUTE_ERROR_ON(src->dimension(0) != weights->dimension(1));
+    ARM_COMPUTE_ERROR_ON(!_int4_weights_info.enabled() && src->dimension(0) != weights->dimension(1));
 
     // Configure matrix multiply kernel
     configure_mm(src, weights, biases, dst, act);
@@ -242,9 +253,11 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
         CpuFullyConnected::validate(src, weights, biases != nullptr ? biases : nullptr, dst, fc_info, weights_info));
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, fc_info);
 
+    // Block-quantized 4-bit weights are already stored with K contiguous per output and are packed by the GEMM
     _needs_weights_conversion = false;
     _needs_weights_reshape    = fc_info.transpose_weights ? !fc_info.are_weights_reshaped : false;
     _needs_weights_reshape    = _needs_weights_reshape && !fc_info.retain_internal_weights;
+    _needs_weights_reshape    = _needs_weights_reshape && !fc_info.int4_weights_info.enabled();
     _is_fc_after_conv         = true;
     _is_quantized_asymmetric  = is_data_type_quantized_asymmetric(src->data_type());
     _is_prepared              = false;
@@ -252,7 +265,11 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     _enable_fast_math         = fc_info.enable_fast_math;
     _fixed_format             = weights_info.weight_format() != WeightFormat::UNSPECIFIED;
     _weight_format            = weights_info.weight_format();
+    _int4_weights_info        = fc_info.int4_weights_info;
+    _weights_sparsity         = weights_info.weights_sparsity();
     _dynamic_weights          = !weights->are_values_constant() && _needs_weights_reshape;
+    _is_dynamic               = src->is_dynamic() || dst->is_dynamic();
+    _src_shape                = src->tensor_shape();
 
     // With the Fully Connected layer we can have 4 different cases:
     //  1) Convolution layer -> Fully Connected layer without batches
@@ -288,7 +305,7 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     }
 
     // Convert weights if needed
-    if (_is_fc_after_conv && (src->data_layout() != fc_info.weights_trained_layout))
+    if (_is_fc_after_conv && (src->data_layout() != fc_info.weights_trained_layout) && !_int4_weights_info.enabled())
     {
         // Convert weights
         _convert_weights = std::make_unique<CpuConvertFullyConnectedWeights>();
@@ -383,6 +400,8 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
 {
     ARM_COMPUTE_UNUSED(fc_info.retain_internal_weights);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->is_dynamic() || (biases != nullptr && biases->is_dynamic()),
+                                    "Dynamic shapes are only supported for src and dst");
 
     if (is_fixed_format(weights_info.weight_format()))
     {
@@ -395,7 +414,16 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
                                                              DataType::F16, DataType::F32);
     }
 
-    if (is_fixed_format_fast_math(weights_info.weight_format()))
+    const Int4WeightsInfo &int4_weights_info = fc_info.int4_weights_info;
+    if (int4_weights_info.enabled())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.weight_format() != WeightFormat::UNSPECIFIED,
+                                        "Fixed format weights are not supported with 4-bit weights");
+    }
+    else if (is_fixed_format_fast_math(weights_info.weight_format()))
     {
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(src, DataType::F32);
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(weights, DataType::BFLOAT16);
@@ -414,6 +442,7 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
         fc_info.activation_info.activation() != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU);
 
     bool weights_reshaped = fc_info.transpose_weights ? fc_info.are_weights_reshaped : true;
+    weights_reshaped      = weights_reshaped || int4_weights_info.enabled();
     bool is_fc_after_conv = true;
 
     const ITensorInfo &flatten_src =
@@ -469,6 +498,9 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
 
     if (is_fc_after_conv && (src->data_layout() != fc_info.weights_trained_layout))
     {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(int4_weights_info.enabled(),
+                                        "4-bit weights must be provided in the layout of the input");
+
         // Validate convert weights kernel
         ARM_COMPUTE_RETURN_ON_ERROR(CpuConvertFullyConnectedWeights::validate(
             weights_to_use, &converted_weights, src->tensor_shape(), fc_info.weights_trained_layout));
@@ -479,6 +511,7 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
     {
         // Fully Connected layer after a Convolution Layer without batches
         ARM_COMPUTE_RETURN_ERROR_ON(
+            !int4_weights_info.enabled() &&
             (weights_to_use->dimension(1) != (src->dimension(0) * src->dimension(1) * src->dimension(2))));
 
         // Validate flatten kernel
@@ -488,11 +521,12 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
     else
     {
         // Fully Connected layer after a Fully Connected Layer without batches
-        ARM_COMPUTE_RETURN_ERROR_ON(src->dimension(0) != weights_to_use->dimension(1));
+        ARM_COMPUTE_RETURN_ERROR_ON(!int4_weights_info.enabled() && src->dimension(0) != weights_to_use->dimension(1));
     }
     // Validate matrix multiply kernel
     ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(src_to_use, weights_to_use, biases, dst, fc_info.activation_info,
-                                            fc_info.enable_fast_math, weights_info.weight_format()));
+                                            fc_info.enable_fast_math, weights_info.weight_format(),
+                                            int4_weights_info, weights_info.weights_sparsity()));
 
     return Status{};
 }
@@ -501,6 +535,9 @@ void CpuFullyConnected::run(ITensorPack &tensors)
 {
     prepare(tensors);
 
+    ARM_COMPUTE_ERROR_ON_MSG(_is_dynamic && tensors.get_const_tensor(ACL_SRC_0)->info()->tensor_shape() != _src_shape,
+                             "workspace_dynamic() must be called when the shapes change");
+
 #ifdef ARM_COMPUTE_ASSERTS_ENABLED
     ++_asrt_run_count;
     ARM_COMPUTE_ERROR_ON(_dynamic_weights && _asrt_prepare_count != _asrt_run_count);
@@ -596,5 +633,45 @@ experimental::MemoryRequirements CpuFullyConnected::workspace() const
 {
     return _aux_mem;
 }
+
+const experimental::MemoryRequirements &CpuFullyConnected::workspace_dynamic(const ITensorPack &tensors) const
+{
+    ARM_COMPUTE_ERROR_ON(!_is_dynamic);
+    const ITensor *src = tensors.get_const_tensor(ACL_SRC_0);
+    const ITensor *dst = tensors.get_const_tensor(ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    if (src->info()->tensor_shape() != _src_shape)
+    {
+        // Only the src dependent state is updated, the weights stay prepared
+        const ITensorInfo *src_to_use = src->info();
+        if (_is_fc_after_conv)
+        {
+            _flattened_src.set_tensor_shape(compute_flatten_shape(src->info()));
+            _flatten->configure(src->info(), &_flattened_src);
+            src_to_use = &_flattened_src;
+        }
+
+        if (_is_quantized_asymmetric)
+        {
+            _mm_gemmlowp->update_shapes(src_to_use, dst->info());
+        }
+        else
+        {
+            _mm_gemm->update_shapes(src_to_use, dst->info());
+        }
+
+        const auto gemm_mem_req = (_is_quantized_asymmetric) ? _mm_gemmlowp->workspace() : _mm_gemm->workspace();
+        for (unsigned int i = 0; i < gemm_mem_req.size(); ++i)
+        {
+            _aux_mem[i] = gemm_mem_req[i];
+        }
+        _aux_mem[FlattenedSrc] =
+            MemoryInfo(offset_int_vec(FlattenedSrc), MemoryLifetime::Temporary, _flattened_src.total_size());
+        _src_shape = src->info()->tensor_shape();
+    }
+
+    return _aux_mem;
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,12 +72,20 @@ public:
      * |F32            |F32                |F32    |F32            |
      * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
+     * |F16            |U8                 |F16    |F16            |
+     * |F32            |U8                 |F32    |F32            |
+     *
+     * @note U8 weights are only accepted as block-quantized 4-bit weights described by
+     *       @ref FullyConnectedLayerInfo::int4_weights_info. They are never transposed and hold one row of
+     *       @ref Int4WeightsInfo::row_size() bytes per output.
+     * @note F32 weights can be sparse, see @ref WeightsInfo::weights_sparsity(). They are provided dense with
+     *       explicit zeros and compressed when the function is prepared.
      *
      * @param[in]  src          Source tensor info. Data type supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      * @param[in]  weights      Weights tensor info. The weights must be 2 dimensional.
      *                          If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                          If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
-     *                          Data type supported: Same as @p src.
+     *                          Data type supported: Same as @p src, U8 for block-quantized 4-bit weights.
      * @param[in]  biases       Bias tensor info. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
      * @param[out] dst          Destination tensor info. Its shape should be equal to the output of a matrix multiplication between:
      *                          - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
@@ -120,9 +128,10 @@ public:
                                WeightsInfo                weights_info);
 
     //Inherited methods override
-    void                             run(ITensorPack &tensors) override;
-    void                             prepare(ITensorPack &tensors) override;
-    experimental::MemoryRequirements workspace() const override;
+    void                                    run(ITensorPack &tensors) override;
+    void                                    prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements        workspace() const override;
+    const experimental::MemoryRequirements &workspace_dynamic(const ITensorPack &tensors) const override;
 
 private:
     void configure_fc_fc(const ITensorInfo         *src,
@@ -166,13 +175,15 @@ private:
     std::unique_ptr<CpuGemm>                         _mm_gemm;
     std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>   _mm_gemmlowp;
 
-    TensorInfo   _flattened_src;
-    TensorInfo   _converted_weights;
-    TensorInfo   _reshaped_weights;
-    TensorInfo   _trans_weights;
-    AuxTensorIdx _trans_weights_idx;
+    // The shape dependent members are updated by workspace_dynamic() when the shapes are dynamic
+    mutable TensorInfo  _flattened_src;
+    TensorInfo          _converted_weights;
+    TensorInfo          _reshaped_weights;
+    TensorInfo          _trans_weights;
+    AuxTensorIdx        _trans_weights_idx;
+    mutable TensorShape _src_shape;
 
-    experimental::MemoryRequirements _aux_mem;
+    mutable experimental::MemoryRequirements _aux_mem;
 
     bool                      _needs_weights_conversion;
     bool                      _needs_weights_reshape;
@@ -182,7 +193,10 @@ private:
     bool                      _enable_fast_math;
     bool                      _fixed_format;
     arm_compute::WeightFormat _weight_format;
+    Int4WeightsInfo           _int4_weights_info;
+    WeightsSparsity           _weights_sparsity;
     bool                      _dynamic_weights;
+    bool                      _is_dynamic;
 
 #ifdef ARM_COMPUTE_ASSERTS_ENABLED
     int _asrt_run_count{};
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/ConsumeWeights.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
@@ -73,6 +74,36 @@ void CpuGemm::configure(const ITensorInfo *a,
     ARM_COMPUTE_ERROR_THROW_ON(CpuGemm::validate(a, b, c, d, alpha, beta, gemm_info));
     ARM_COMPUTE_LOG_PARAMS(a, b, c, d, alpha, beta, gemm_info);
 
+    _is_prepared = false;
+
+    if (gemm_info.int4_weights_info().enabled())
+    {
+        // The bias is added by the 4-bit weights kernel
+        _int4_gemm = std::make_unique<cpu::CpuGemmInt4>();
+        _int4_gemm->configure(a, b, (beta == 1.f) ? c : nullptr, d, gemm_info);
+
+        const auto int4_mem_req = _int4_gemm->workspace();
+        for (unsigned int slot = 0; slot < int4_mem_req.size(); ++slot)
+        {
+            _aux_mem[slot] = int4_mem_req[slot];
+        }
+        return;
+    }
+
+    if (gemm_info.weights_sparsity() != WeightsSparsity::DENSE)
+    {
+        // The bias is added by the sparse weights kernel
+        _sparse_gemm = std::make_unique<cpu::CpuGemmSparse>();
+        _sparse_gemm->configure(a, b, (beta == 1.f) ? c : nullptr, d, gemm_info);
+
+        const auto sparse_mem_req = _sparse_gemm->workspace();
+        for (unsigned int slot = 0; slot < sparse_mem_req.size(); ++slot)
+        {
+            _aux_mem[slot] = sparse_mem_req[slot];
+        }
+        return;
+    }
+
     const cpu::AsmGemmInfo asm_info  = init_assembly_metadata(gemm_info);
     const bool             is_c_bias = beta == 1 && c != nullptr;
     const bool             run_optimised =
@@ -82,7 +113,6 @@ void CpuGemm::configure(const ITensorInfo *a,
           b->tensor_shape().z() > 1); // Disable batch matmul as optimized GeMM handles batching differently.
 
     // Check if we need to reshape the matrix B only on the first run
-    _is_prepared                      = false;
     _reshape_b_only_on_first_run      = b->are_values_constant();
     _run_vector_matrix_multiplication = a->dimension(1) < 2;
     _run_alpha_scale                  = alpha != 1.f;
@@ -204,10 +234,28 @@ void CpuGemm::configure(const ITensorInfo *a,
     }
 
     // Configure activation
+    _activation_info = gemm_info.activation_info();
     if (_run_activation)
     {
         _activation_func = std::make_unique<cpu::CpuActivation>();
-        _activation_func->configure(d, nullptr, gemm_info.activation_info());
+        _activation_func->configure(d, nullptr, _activation_info);
+    }
+}
+
+void CpuGemm::update_shapes(const ITensorInfo *a, const ITensorInfo *d)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_asm_glue == nullptr, "Dynamic shapes are only supported by the assembly kernel");
+    _asm_glue->update_shapes(a, d);
+
+    const auto asm_mem_req = _asm_glue->workspace();
+    for (unsigned int slot = 0; slot < asm_mem_req.size(); ++slot)
+    {
+        _aux_mem[slot] = asm_mem_req[slot];
+    }
+
+    if (_run_activation)
+    {
+        _activation_func->configure(d, nullptr, _activation_info);
     }
 }
 
@@ -230,6 +278,23 @@ Status CpuGemm::validate(const ITensorInfo *a,
             "Accumulation is not supported when beta is different from 0 with a non-null bias matrix c");
     }
 
+    if (gemm_info.int4_weights_info().enabled())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(alpha != 1.f, "4-bit weights are not supported when alpha is different from 1");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(c != nullptr && beta != 0.f && beta != 1.f,
+                                        "4-bit weights only support a bias matrix c with beta equal to 1");
+        return CpuGemmInt4::validate(a, b, (beta == 1.f) ? c : nullptr, d, gemm_info);
+    }
+
+    if (gemm_info.weights_sparsity() != WeightsSparsity::DENSE)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(alpha != 1.f,
+                                        "Sparse weights are not supported when alpha is different from 1");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(c != nullptr && beta != 0.f && beta != 1.f,
+                                        "Sparse weights only support a bias matrix c with beta equal to 1");
+        return CpuGemmSparse::validate(a, b, (beta == 1.f) ? c : nullptr, d, gemm_info);
+    }
+
     const bool is_c_bias    = beta == 1 && c != nullptr;
     const bool run_addition = c != nullptr && beta != 0 && beta != 1;
     // Check if we should use the pretransposed_b or original b
@@ -334,6 +399,12 @@ Status CpuGemm::validate(const ITensorInfo *a,
         !(!b->are_values_constant() &&
           b->tensor_shape().z() > 1); // Disable batch matmul as optimized GeMM handles batching differently.
 
+    if (a->is_dynamic() || d->is_dynamic())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!run_optimised || alpha != 1.f || run_addition,
+                                        "Dynamic shapes are only supported by the assembly kernel without scaling");
+    }
+
     if (!run_optimised)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.reinterpret_input_as_3d(),
@@ -415,6 +486,18 @@ void CpuGemm::run(ITensorPack &tensors)
 {
     prepare(tensors);
 
+    if (_int4_gemm)
+    {
+        _int4_gemm->run(tensors);
+        return;
+    }
+
+    if (_sparse_gemm)
+    {
+        _sparse_gemm->run(tensors);
+        return;
+    }
+
     auto a = tensors.get_const_tensor(ACL_SRC_0);
     auto b = tensors.get_const_tensor(ACL_SRC_1);
     auto c = tensors.get_const_tensor(ACL_SRC_2);
@@ -507,7 +590,15 @@ void CpuGemm::prepare(ITensorPack &tensors)
 {
     if (!_is_prepared)
     {
-        if (_asm_glue && _asm_glue->is_configured())
+        if (_int4_gemm)
+        {
+            _int4_gemm->prepare(tensors);
+        }
+        else if (_sparse_gemm)
+        {
+            _sparse_gemm->prepare(tensors);
+        }
+        else if (_asm_glue && _asm_glue->is_configured())
         {
             _asm_glue->prepare(tensors);
         }
@@ -537,6 +628,12 @@ void CpuGemm::prepare(ITensorPack &tensors)
                 NEScheduler::get().schedule_op(_transpose1xW_b_kernel.get(), Window::DimY,
                                                _transpose1xW_b_kernel->window(), transpose_pack);
             }
+
+            // run() only reads the reshaped weights
+            if (consume_weights() && (_pretranspose_b_func || _run_interleave_transpose))
+            {
+                b->mark_as_unused();
+            }
         }
         _is_prepared = true;
     }
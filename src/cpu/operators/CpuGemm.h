@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,8 @@
 #include "src/cpu/kernels/CpuGemmTranspose1xWKernel.h"
 #include "src/cpu/operators/CpuActivation.h"
 #include "src/cpu/operators/CpuAdd.h"
+#include "src/cpu/operators/CpuGemmInt4.h"
+#include "src/cpu/operators/CpuGemmSparse.h"
 #include "src/cpu/operators/CpuTranspose.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
@@ -54,7 +56,11 @@ namespace cpu
  *  -# @ref cpu::kernels::CpuGemmInterleave4x4Kernel (if the output tensor is a matrix)
  *  -# @ref cpu::kernels::CpuGemmTranspose1xWKernel (if the output tensor is a matrix)
  *  -# @ref cpu::kernels::CpuGemmMatrixMultiplyKernel
- * In both cases:
+ * If matrix B is made of block-quantized 4-bit weights (see @ref GEMMInfo::int4_weights_info()):
+ *  -# @ref cpu::CpuGemmInt4
+ * If matrix B is sparse (see @ref GEMMInfo::weights_sparsity()):
+ *  -# @ref cpu::CpuGemmSparse
+ * In all cases:
  *  -# @ref cpu::kernels::CpuGemmMatrixAdditionKernel (if c != nullptr and beta != 0.0 and is not reshaped once)
  * Else:
  *  -# @ref cpu::CpuAdd (if c != nullptr and is reshaped once and not optimized assembly in place)
@@ -79,14 +85,18 @@ public:
      * |F32          |F32         |F32       |F32            |
      * |F16          |F16         |F16       |F16            |
      * |BFLOAT16     |BFLOAT16    |BFLOAT16  |FP32           |
+     * |F32          |U8          |F32       |F32            |
+     * |F16          |U8          |F16       |F16            |
      *
      * @note GEMM: General Matrix Multiply - [alpha * A * B + beta * C].
      * @note GEMM: The tensors a, b, c, d must have the same data type. You should not mix data types when calling this function.
+     * @note GEMM: If @ref GEMMInfo::int4_weights_info() is enabled, b is a U8 tensor of block-quantized 4-bit weights, alpha must be 1 and c can only be a bias with beta equal to 1.
+     * @note GEMM: If @ref GEMMInfo::weights_sparsity() is not WeightsSparsity::DENSE, only F32 is supported, b is a dense 2D matrix with explicit zeros, alpha must be 1 and c can only be a bias with beta equal to 1.
      *
      * @note Batched GEMM only supports broadcasting cases where RHS rank < LHS rank but not the other way around
      *
      * @param[in]  a         First input tensor info (Matrix A or Vector A). Data type supported: BFLOAT16/F16/F32
-     * @param[in]  b         Second input tensor info (Matrix B). Data type supported: same as @p a
+     * @param[in]  b         Second input tensor info (Matrix B). Data type supported: same as @p a, or U8 for block-quantized 4-bit weights
      * @param[in]  c         Third input tensor info (Matrix C). It can be a nullptr if just the multiplication between @p a and @p b is needed. Data type supported: same as @p a
      * @param[out] d         Output tensor info. Data type supported: same as @p a
      * @param[in]  alpha     Weight of the matrix product
@@ -142,6 +152,15 @@ public:
      */
     bool isVarWeightsKernel() const;
 
+    /** Update the shapes of an operator configured with dynamic shapes
+     *
+     * Only supported when the assembly kernel is used. The prepared weights are kept.
+     *
+     * @param[in] a Info of the first input tensor (Matrix A) with the new shape
+     * @param[in] d Info of the output tensor with the new shape
+     */
+    void update_shapes(const ITensorInfo *a, const ITensorInfo *d);
+
 private:
     enum AuxTensorIdx
     {
@@ -162,12 +181,16 @@ private:
     std::unique_ptr<CpuActivation>                        _alpha_scale_func{nullptr};
     std::unique_ptr<CpuAdd>                               _add_bias{nullptr};
     std::unique_ptr<CpuActivation>                        _activation_func{nullptr};
+    std::unique_ptr<CpuGemmInt4>                          _int4_gemm{nullptr};
+    std::unique_ptr<CpuGemmSparse>                        _sparse_gemm{nullptr};
 
     TensorInfo _tmp_a{};
     TensorInfo _pretransposed_b{};
     TensorInfo _tmp_b{};
     TensorInfo _tmp_d{};
 
+    ActivationLayerInfo _activation_info{};
+
     bool _run_vector_matrix_multiplication{false};
     bool _run_interleave_transpose{
         true}; /**< If we run CpuGemmInterleave4x4Kernel on lhs and CpuGemmTranspose1xWKernel on rhs */
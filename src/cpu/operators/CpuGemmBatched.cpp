@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGemmBatched.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/ConsumeWeights.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+/** Number of groups of problems per thread, so that the threads can balance the cost of the largest problems */
+constexpr size_t windows_per_thread = 4;
+} // namespace
+
+void CpuGemmBatched::configure(const ITensorInfo                     *a,
+                               const ITensorInfo                     *b,
+                               const ITensorInfo                     *c,
+                               ITensorInfo                           *d,
+                               const std::vector<GEMMBatchedProblem> &problems,
+                               const GEMMInfo                        &gemm_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmBatched::validate(a, b, c, d, problems, gemm_info));
+    ARM_COMPUTE_LOG_PARAMS(a, b, c, d, problems.size(), gemm_info);
+
+    _is_prepared                 = false;
+    _reshape_b_only_on_first_run = b->are_values_constant();
+    _act_info                    = gemm_info.activation_info();
+
+    // Configure the packing of the B matrices
+    _pack_rhs_kernel = std::make_unique<kernels::CpuGemmBatchedPackRhsKernel>();
+    _pack_rhs_kernel->configure(b, &_packed_rhs, problems);
+    _aux_mem[PackedRHS] =
+        MemoryInfo(offset_int_vec(PackedRHS),
+                   _reshape_b_only_on_first_run ? MemoryLifetime::Persistent : MemoryLifetime::Temporary,
+                   _packed_rhs.total_size());
+
+    // Configure the matrix multiplications
+    _mm_kernel = std::make_unique<kernels::CpuGemmBatchedKernel>();
+    _mm_kernel->configure(a, &_packed_rhs, c, d, problems, _act_info);
+}
+
+Status CpuGemmBatched::validate(const ITensorInfo                     *a,
+                                const ITensorInfo                     *b,
+                                const ITensorInfo                     *c,
+                                const ITensorInfo                     *d,
+                                const std::vector<GEMMBatchedProblem> &problems,
+                                const GEMMInfo                        &gemm_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(d->total_size() == 0, "The output of a batched GEMM must be initialized");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->is_dynamic() || b->is_dynamic() || d->is_dynamic(),
+                                    "Dynamic shapes are not supported by the batched GEMM");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_a_reshaped() || gemm_info.is_b_reshaped(),
+                                    "Reshaped matrices are not supported by the batched GEMM");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.reinterpret_input_as_3d() || gemm_info.depth_output_gemm3d() != 0,
+                                    "3D reinterpretation is not supported by the batched GEMM");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.pretranspose_B() || gemm_info.fixed_format(),
+                                    "The layout of the packed B matrices is fixed by the batched GEMM");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.accumulate(), "Accumulation is not supported by the batched GEMM");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.int4_weights_info().enabled() ||
+                                        gemm_info.weights_sparsity() != WeightsSparsity::DENSE,
+                                    "Compressed weights are not supported by the batched GEMM");
+
+    TensorInfo packed_rhs(TensorShape(kernels::CpuGemmBatchedPackRhsKernel::compute_packed_size(problems)), 1,
+                          DataType::U8);
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmBatchedPackRhsKernel::validate(b, &packed_rhs, problems));
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        kernels::CpuGemmBatchedKernel::validate(a, &packed_rhs, c, d, problems, gemm_info.activation_info()));
+
+    return Status{};
+}
+
+void CpuGemmBatched::run(ITensorPack &tensors)
+{
+    run_problems(tensors, nullptr);
+}
+
+void CpuGemmBatched::run_with_views(ITensorPack &tensors, const std::vector<GEMMBatchedProblem> &problems)
+{
+    const ITensor *a = tensors.get_const_tensor(ACL_SRC_0);
+    const ITensor *c = tensors.get_const_tensor(ACL_SRC_2);
+    const ITensor *d = tensors.get_const_tensor(ACL_DST);
+    ARM_COMPUTE_ERROR_THROW_ON(_mm_kernel->validate_views(a->info(), &_packed_rhs,
+                                                          (c != nullptr) ? c->info() : nullptr, d->info(), problems));
+    ARM_COMPUTE_UNUSED(a, c, d);
+
+    run_problems(tensors, &problems);
+}
+
+void CpuGemmBatched::run_problems(ITensorPack &tensors, const std::vector<GEMMBatchedProblem> *views)
+{
+    prepare(tensors);
+
+    auto a = tensors.get_const_tensor(ACL_SRC_0);
+    auto b = tensors.get_const_tensor(ACL_SRC_1);
+    auto c = tensors.get_const_tensor(ACL_SRC_2);
+    auto d = tensors.get_tensor(ACL_DST);
+
+    CpuAuxTensorHandler packed_rhs(offset_int_vec(PackedRHS), _packed_rhs, tensors, true);
+
+    if (!_reshape_b_only_on_first_run)
+    {
+        ITensorPack pack_rhs_pack{{ACL_SRC, b}, {ACL_DST, packed_rhs.get()}};
+        NEScheduler::get().schedule_op(_pack_rhs_kernel.get(), Window::DimX, _pack_rhs_kernel->window(),
+                                       pack_rhs_pack);
+    }
+
+    // Each workload runs a group of whole problems: splitting the window evenly would not balance the threads when the
+    // problems have different shapes
+    ITensorPack               mm_pack{{ACL_SRC_0, a}, {ACL_SRC_1, packed_rhs.get()}, {ACL_SRC_2, c}, {ACL_DST, d}};
+    const std::vector<Window> windows =
+        _mm_kernel->split_window_by_cost(windows_per_thread * NEScheduler::get().num_threads());
+
+    std::vector<IScheduler::Workload> workloads(windows.size());
+    for (size_t t = 0; t < windows.size(); ++t)
+    {
+        workloads[t] = [this, t, views, &windows, &mm_pack](const ThreadInfo &info)
+        {
+            if (views != nullptr)
+            {
+                _mm_kernel->run_op_with_views(mm_pack, windows[t], info, *views);
+            }
+            else
+            {
+                _mm_kernel->run_op(mm_pack, windows[t], info);
+            }
+        };
+    }
+    NEScheduler::get().run_tagged_workloads(workloads, _mm_kernel->name());
+}
+
+void CpuGemmBatched::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        if (_reshape_b_only_on_first_run)
+        {
+            const ITensor      *b = tensors.get_const_tensor(ACL_SRC_1);
+            CpuAuxTensorHandler packed_rhs(offset_int_vec(PackedRHS), _packed_rhs, tensors);
+
+            ITensorPack pack_rhs_pack{{ACL_SRC, b}, {ACL_DST, packed_rhs.get()}};
+            NEScheduler::get().schedule_op(_pack_rhs_kernel.get(), Window::DimX, _pack_rhs_kernel->window(),
+                                           pack_rhs_pack);
+
+            // run() only reads the packed matrices
+            if (consume_weights())
+            {
+                b->mark_as_unused();
+            }
+        }
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuGemmBatched::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGEMMBATCHED_H
+#define ACL_SRC_CPU_OPERATORS_CPUGEMMBATCHED_H
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/GEMMBatchedInfo.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuGemmBatchedKernel.h"
+#include "src/cpu/kernels/CpuGemmBatchedPackRhsKernel.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to compute many small independent F32 matrix products. This function calls the following kernels:
+ *
+ *  -# @ref kernels::CpuGemmBatchedPackRhsKernel (once if the B matrices are constant)
+ *  -# @ref kernels::CpuGemmBatchedKernel
+ *
+ * The problems are described by @ref GEMMBatchedProblem and can all have different shapes. Each problem is computed by
+ * a single thread and the threads pick groups of problems of similar cost, so the dispatch overhead is paid once for
+ * the whole batch rather than once per problem. All the B matrices are packed in a single buffer.
+ */
+class CpuGemmBatched : public ICpuOperator
+{
+public:
+    /** Default constructor */
+    CpuGemmBatched() = default;
+    /** Default destructor */
+    ~CpuGemmBatched() = default;
+    /** Configure operator for a given list of arguments
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0         |src1        |src2      |dst            |
+     * |:------------|:-----------|:---------|:--------------|
+     * |F32          |F32         |F32       |F32            |
+     *
+     * @note The views of D of the different problems must not overlap. The elements of @p d outside of these views are
+     *       left untouched.
+     *
+     * @param[in]  a         Tensor info holding the A matrices. Data type supported: F32
+     * @param[in]  b         Tensor info holding the B matrices. Data type supported: same as @p a
+     * @param[in]  c         Tensor info holding the biases. Can be nullptr. Data type supported: same as @p a
+     * @param[out] d         Tensor info holding the D matrices. Must be initialized. Data type supported: same as @p a
+     * @param[in]  problems  Problems of the batched GEMM
+     * @param[in]  gemm_info GEMM information. Only the activation, which must be RELU, BOUNDED_RELU or LU_BOUNDED_RELU,
+     *                       is supported
+     */
+    void configure(const ITensorInfo                     *a,
+                   const ITensorInfo                     *b,
+                   const ITensorInfo                     *c,
+                   ITensorInfo                           *d,
+                   const std::vector<GEMMBatchedProblem> &problems,
+                   const GEMMInfo                        &gemm_info = GEMMInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuGemmBatched.
+     *
+     * Similar to @ref CpuGemmBatched::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                     *a,
+                           const ITensorInfo                     *b,
+                           const ITensorInfo                     *c,
+                           const ITensorInfo                     *d,
+                           const std::vector<GEMMBatchedProblem> &problems,
+                           const GEMMInfo                        &gemm_info = GEMMInfo());
+    /** Run with the views of A and D of @p problems instead of the ones given to configure()
+     *
+     * This is used when padding was added to the tensors after configure(). The operator is not modified: the packed
+     * B matrices are kept, so the shapes and the views of B and of the biases must be the ones given to configure().
+     *
+     * @param[in] tensors  Same tensors as run()
+     * @param[in] problems Problems of the batched GEMM, in the order given to configure()
+     */
+    void run_with_views(ITensorPack &tensors, const std::vector<GEMMBatchedProblem> &problems);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    /** Run the problems, with the views of @p views if not nullptr */
+    void run_problems(ITensorPack &tensors, const std::vector<GEMMBatchedProblem> *views);
+
+    enum AuxTensorIdx
+    {
+        PackedRHS = 0,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuGemmBatchedPackRhsKernel> _pack_rhs_kernel{nullptr};
+    std::unique_ptr<kernels::CpuGemmBatchedKernel>        _mm_kernel{nullptr};
+
+    TensorInfo          _packed_rhs{};
+    ActivationLayerInfo _act_info{};
+
+    bool _reshape_b_only_on_first_run{false};
+    bool _is_prepared{false};
+
+    experimental::MemoryRequirements _aux_mem{Count};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUGEMMBATCHED_H
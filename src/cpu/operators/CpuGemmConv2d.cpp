@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/ConsumeWeights.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
@@ -228,6 +229,13 @@ CpuGemmConv2d::CpuGemmConv2d()
       _wt_method(WeightTransformMethod::ReshapeThenTranspose),
       _run_wt(true),
       _act_info(),
+      _conv_info(),
+      _kernel_dims(),
+      _dilation(),
+      _num_groups(1),
+      _input_pad_right(0),
+      _is_dynamic(false),
+      _src_shape(),
       _aux_mem(AuxTensorIdx::Count)
 {
 }
@@ -455,6 +463,13 @@ void CpuGemmConv2d::configure(const ITensorInfo         *src,
     _data_layout  = data_layout;
     _skip_im2col  = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 &&
                     conv_info.stride().first == 1 && conv_info.stride().second == 1);
+    _conv_info       = conv_info;
+    _kernel_dims     = Size2D(kernel_width, kernel_height);
+    _dilation        = dilation;
+    _num_groups      = num_groups;
+    _input_pad_right = 0;
+    _is_dynamic      = src->is_dynamic() || dst->is_dynamic();
+    _src_shape       = src->tensor_shape();
 
     const ITensorInfo *gemm_input_to_use  = src;
     ITensorInfo       *gemm_output_to_use = dst;
@@ -485,17 +500,16 @@ void CpuGemmConv2d::configure(const ITensorInfo         *src,
     // Create tensor to store im2col reshaped inputs
     if (!_skip_im2col)
     {
-        const int    block_by        = arm_compute::block_by(weights_info.weight_format());
-        unsigned int input_pad_right = 0;
+        const int block_by = arm_compute::block_by(weights_info.weight_format());
         if (block_by > 1)
         {
-            input_pad_right =
+            _input_pad_right =
                 (src->dimension(idx_channel) % block_by) == 0 ? 0 : block_by - (src->dimension(idx_channel) % block_by);
         }
         // Configure
         _im2col_kernel = std::make_unique<kernels::CpuIm2ColKernel>();
-        _im2col_kernel->configure(src, &_im2col_output, Size2D(kernel_width, kernel_height), conv_info, false, dilation,
-                                  num_groups, input_pad_right);
+        _im2col_kernel->configure(src, &_im2col_output, _kernel_dims, conv_info, false, dilation, num_groups,
+                                  _input_pad_right);
 
         // Update GEMM input
         gemm_input_to_use = &_im2col_output;
@@ -679,6 +693,8 @@ Status CpuGemmConv2d::validate(const ITensorInfo         *src,
     }
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups > 1, "Grouping (num_groups != 1) is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->is_dynamic() || (biases != nullptr && biases->is_dynamic()),
+                                    "Dynamic shapes are only supported for src and dst");
 
     const DataLayout data_layout = src->data_layout();
     const DataType   data_type   = src->data_type();
@@ -861,6 +877,9 @@ void CpuGemmConv2d::run(ITensorPack &tensors)
 {
     prepare(tensors);
 
+    ARM_COMPUTE_ERROR_ON_MSG(_is_dynamic && tensors.get_const_tensor(ACL_SRC_0)->info()->tensor_shape() != _src_shape,
+                             "workspace_dynamic() must be called when the shapes change");
+
     auto src               = tensors.get_const_tensor(ACL_SRC_0);
     auto dst               = tensors.get_tensor(ACL_DST);
     auto gemm_input_to_use = src;
@@ -1043,6 +1062,13 @@ void CpuGemmConv2d::prepare(ITensorPack &tensors)
         }
         _is_quantized ? _mm_gemmlowp->prepare(gemm_pack) : _mm_gemm->prepare(gemm_pack);
 
+        // The GEMM consumed the view of the weights, so it doesn't read the weights themselves either
+        if (consume_weights() && _run_wt && _wt_method == WeightTransformMethod::ReinterpretThenTranspose &&
+            !reinterpreted_wei.get()->is_used())
+        {
+            weights->mark_as_unused();
+        }
+
         _is_prepared = true;
     }
 }
@@ -1050,6 +1076,87 @@ experimental::MemoryRequirements CpuGemmConv2d::workspace() const
 {
     return _aux_mem;
 }
+
+const experimental::MemoryRequirements &CpuGemmConv2d::workspace_dynamic(const ITensorPack &tensors) const
+{
+    ARM_COMPUTE_ERROR_ON(!_is_dynamic);
+    const ITensor *src = tensors.get_const_tensor(ACL_SRC_0);
+    const ITensor *dst = tensors.get_const_tensor(ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    if (src->info()->tensor_shape() != _src_shape)
+    {
+        // Only the src dependent state is updated, the weights stay prepared
+        const int idx_width  = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::WIDTH);
+        const int idx_height = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT);
+
+        unsigned int conv_w      = 0;
+        unsigned int conv_h      = 0;
+        std::tie(conv_w, conv_h) = scaled_dimensions(src->info()->dimension(idx_width),
+                                                     src->info()->dimension(idx_height), _kernel_dims.width,
+                                                     _kernel_dims.height, _conv_info, _dilation);
+
+        const ITensorInfo *gemm_input_to_use = src->info();
+        if (!_skip_im2col)
+        {
+            _im2col_output.set_tensor_shape(compute_im2col_conv_shape(src->info(), _kernel_dims, _conv_info, false,
+                                                                      _dilation, false, _num_groups,
+                                                                      _input_pad_right));
+            _im2col_kernel->configure(src->info(), &_im2col_output, _kernel_dims, _conv_info, false, _dilation,
+                                      _num_groups, _input_pad_right);
+            gemm_input_to_use = &_im2col_output;
+        }
+
+        ITensorInfo *gemm_output_to_use = nullptr;
+        if (!_skip_col2im)
+        {
+            TensorShape shape_gemm = _im2col_output.tensor_shape();
+            shape_gemm.set(0, _gemm_output.dimension(0));
+            shape_gemm.set(1, conv_w * conv_h);
+            _gemm_output.set_tensor_shape(shape_gemm);
+            _gemm_output_3d    = TensorInfo(_gemm_output);
+            gemm_output_to_use = &_gemm_output;
+        }
+        else
+        {
+            _gemm_output_3d.set_tensor_shape(dst->info()->tensor_shape());
+            _gemm_output       = TensorInfo(_gemm_output_3d);
+            gemm_output_to_use = &_gemm_output_3d;
+        }
+
+        if (_is_quantized)
+        {
+            _mm_gemmlowp->update_shapes(gemm_input_to_use, gemm_output_to_use);
+        }
+        else
+        {
+            _mm_gemm->update_shapes(gemm_input_to_use, gemm_output_to_use);
+        }
+
+        if (!_skip_col2im && _data_layout == DataLayout::NCHW)
+        {
+            _col2im_kernel->configure(gemm_output_to_use, dst->info(), Size2D(conv_w, conv_h));
+        }
+        else
+        {
+            _reshape->configure(gemm_output_to_use, dst->info());
+        }
+
+        const auto mm_mem_req = _is_quantized ? _mm_gemmlowp->workspace() : _mm_gemm->workspace();
+        for (unsigned int cont = 0; cont < mm_mem_req.size(); ++cont)
+        {
+            _aux_mem[cont] = mm_mem_req[cont];
+        }
+        _aux_mem[Im2ColOutput] =
+            MemoryInfo(offset_int_vec(Im2ColOutput), MemoryLifetime::Temporary, _im2col_output.total_size());
+        _aux_mem[GemmOutput] =
+            MemoryInfo(offset_int_vec(GemmOutput), MemoryLifetime::Temporary, _gemm_output.total_size());
+        _src_shape = src->info()->tensor_shape();
+    }
+
+    return _aux_mem;
+}
+
 bool CpuGemmConv2d::isVarWeightsKernel() const
 {
     return _mm_gemm && _mm_gemm->isVarWeightsKernel();
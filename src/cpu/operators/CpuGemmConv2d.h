@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -150,9 +150,10 @@ public:
     void update_quantization_parameters(ITensorPack &tensors);
 
     // Inherited methods overridden:
-    void                             run(ITensorPack &tensors) override;
-    void                             prepare(ITensorPack &tensors) override;
-    experimental::MemoryRequirements workspace() const override;
+    void                                    run(ITensorPack &tensors) override;
+    void                                    prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements        workspace() const override;
+    const experimental::MemoryRequirements &workspace_dynamic(const ITensorPack &tensors) const override;
 
 private:
     /** Configures the appropriate matrix multiply routine
@@ -286,10 +287,11 @@ private:
     std::unique_ptr<kernels::CpuCol2ImKernel>         _col2im_kernel;
     std::unique_ptr<CpuReshape>                       _reshape;
 
-    TensorInfo _im2col_output;
-    TensorInfo _weights_reshaped;
-    TensorInfo _gemm_output;
-    TensorInfo _gemm_output_3d;
+    // The shape dependent members are updated by workspace_dynamic() when the shapes are dynamic
+    mutable TensorInfo _im2col_output;
+    TensorInfo         _weights_reshaped;
+    mutable TensorInfo _gemm_output;
+    mutable TensorInfo _gemm_output_3d;
 
     DataLayout _data_layout;
 
@@ -300,8 +302,15 @@ private:
     WeightTransformMethod _wt_method;
     bool                  _run_wt;
     ActivationLayerInfo   _act_info;
+    PadStrideInfo         _conv_info;
+    Size2D                _kernel_dims;
+    Size2D                _dilation;
+    unsigned int          _num_groups;
+    unsigned int          _input_pad_right;
+    bool                  _is_dynamic;
+    mutable TensorShape   _src_shape;
 
-    experimental::MemoryRequirements _aux_mem{Count};
+    mutable experimental::MemoryRequirements _aux_mem{Count};
 };
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/runtime/ConsumeWeights.h"
 #include "arm_compute/runtime/FunctionDescriptors.h"
 
 #include "src/common/utils/Log.h"
@@ -240,6 +241,12 @@ void CpuGemmDirectConv2d::prepare(ITensorPack &tensors)
         // Call prepare of assembly dispatch
         _gemm_asm_func->prepare(tensors);
 
+        // The assembly kernel runs on the pretransposed weights only
+        if (consume_weights() && _aux_mem[Pretranspose].size > 0)
+        {
+            weights->mark_as_unused();
+        }
+
         _is_prepared = true;
     }
 }
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGemmInt4.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/ConsumeWeights.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuGemmInt4::configure(
+    const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, ITensorInfo *d, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmInt4::validate(a, b, c, d, gemm_info));
+    ARM_COMPUTE_LOG_PARAMS(a, b, c, d, gemm_info);
+
+    const Int4WeightsInfo &int4_info    = gemm_info.int4_weights_info();
+    const bool             quantize_lhs = gemm_info.fast_math();
+    const size_t           block_rows   = kernels::CpuGemmInt4Kernel::block_rows;
+
+    _is_prepared                 = false;
+    _reshape_b_only_on_first_run = b->are_values_constant();
+    _num_row_blocks              = ceil_to_multiple(d->dimension(1), block_rows) / block_rows;
+
+    // Configure the packing of the weights
+    _pack_rhs_kernel = std::make_unique<kernels::CpuGemmInt4PackRhsKernel>();
+    _pack_rhs_kernel->configure(b, &_packed_rhs, int4_info);
+    _aux_mem[PackedRHS] =
+        MemoryInfo(offset_int_vec(PackedRHS),
+                   _reshape_b_only_on_first_run ? MemoryLifetime::Persistent : MemoryLifetime::Temporary,
+                   _packed_rhs.total_size());
+
+    // Configure the quantization of the LHS
+    const ITensorInfo *lhs_to_use = a;
+    if (quantize_lhs)
+    {
+        _quantize_lhs_kernel = std::make_unique<kernels::CpuGemmInt4QuantizeLhsKernel>();
+        _quantize_lhs_kernel->configure(a, &_quantized_lhs, int4_info.group_size);
+        _aux_mem[QuantizedLHS] =
+            MemoryInfo(offset_int_vec(QuantizedLHS), MemoryLifetime::Temporary, _quantized_lhs.total_size());
+        lhs_to_use = &_quantized_lhs;
+    }
+
+    // Configure the matrix multiplication
+    _mm_kernel = std::make_unique<kernels::CpuGemmInt4Kernel>();
+    _mm_kernel->configure(lhs_to_use, &_packed_rhs, c, d, int4_info.group_size, quantize_lhs);
+
+    // Configure activation
+    if (gemm_info.activation_info().enabled())
+    {
+        _activation_func = std::make_unique<CpuActivation>();
+        _activation_func->configure(d, nullptr, gemm_info.activation_info());
+    }
+}
+
+Status CpuGemmInt4::validate(
+    const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, const ITensorInfo *d, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(a);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, d);
+
+    const Int4WeightsInfo &int4_info = gemm_info.int4_weights_info();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!int4_info.enabled(), "The weights must be block-quantized 4-bit values");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->is_dynamic() || d->is_dynamic(),
+                                    "Dynamic shapes are not supported with 4-bit weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_a_reshaped() || gemm_info.is_b_reshaped(),
+                                    "Reshaped matrices are not supported with 4-bit weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.reinterpret_input_as_3d() || gemm_info.depth_output_gemm3d() != 0,
+                                    "3D reinterpretation is not supported with 4-bit weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.pretranspose_B() || gemm_info.fixed_format(),
+                                    "The layout of 4-bit weights is fixed by Int4WeightsInfo");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.accumulate(), "Accumulation is not supported with 4-bit weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.weights_sparsity() != WeightsSparsity::DENSE,
+                                    "Sparse weights cannot be block-quantized 4-bit values");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->dimension(0) != int4_info.row_size(a->dimension(0)),
+                                    "Each row of the weights must hold the K values of one output column");
+
+    TensorInfo packed_rhs(kernels::CpuGemmInt4PackRhsKernel::compute_packed_shape(*b, int4_info), 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmInt4PackRhsKernel::validate(b, &packed_rhs, int4_info));
+
+    const ITensorInfo *lhs_to_use = a;
+    TensorInfo         quantized_lhs{};
+    if (gemm_info.fast_math())
+    {
+        quantized_lhs = TensorInfo(
+            kernels::CpuGemmInt4QuantizeLhsKernel::compute_quantized_shape(*a, int4_info.group_size), 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ON_ERROR(
+            kernels::CpuGemmInt4QuantizeLhsKernel::validate(a, &quantized_lhs, int4_info.group_size));
+        lhs_to_use = &quantized_lhs;
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmInt4Kernel::validate(lhs_to_use, &packed_rhs, c, d,
+                                                                     int4_info.group_size, gemm_info.fast_math()));
+
+    if (gemm_info.activation_info().enabled())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuActivation::validate(d, nullptr, gemm_info.activation_info()));
+    }
+
+    return Status{};
+}
+
+void CpuGemmInt4::run(ITensorPack &tensors)
+{
+    prepare(tensors);
+
+    auto a = tensors.get_const_tensor(ACL_SRC_0);
+    auto b = tensors.get_const_tensor(ACL_SRC_1);
+    auto c = tensors.get_const_tensor(ACL_SRC_2);
+    auto d = tensors.get_tensor(ACL_DST);
+
+    CpuAuxTensorHandler packed_rhs(offset_int_vec(PackedRHS), _packed_rhs, tensors, true);
+    CpuAuxTensorHandler quantized_lhs(offset_int_vec(QuantizedLHS), _quantized_lhs, tensors, true,
+                                      _quantize_lhs_kernel == nullptr /*bypass_alloc*/);
+
+    if (!_reshape_b_only_on_first_run)
+    {
+        ITensorPack pack_rhs_pack{{ACL_SRC, b}, {ACL_DST, packed_rhs.get()}};
+        NEScheduler::get().schedule_op(_pack_rhs_kernel.get(), Window::DimX, _pack_rhs_kernel->window(),
+                                       pack_rhs_pack);
+    }
+
+    const ITensor *lhs_to_use = a;
+    if (_quantize_lhs_kernel)
+    {
+        ITensorPack quantize_pack{{ACL_SRC, a}, {ACL_DST, quantized_lhs.get()}};
+        NEScheduler::get().schedule_op(_quantize_lhs_kernel.get(), Window::DimY, _quantize_lhs_kernel->window(),
+                                       quantize_pack);
+        lhs_to_use = quantized_lhs.get();
+    }
+
+    // With few rows, as in matrix-vector products, the output columns are split across the threads instead
+    const size_t split_dimension =
+        (_num_row_blocks < NEScheduler::get().num_threads()) ? Window::DimX : Window::DimY;
+
+    ITensorPack mm_pack{{ACL_SRC_0, lhs_to_use}, {ACL_SRC_1, packed_rhs.get()}, {ACL_SRC_2, c}, {ACL_DST, d}};
+    NEScheduler::get().schedule_op(_mm_kernel.get(), split_dimension, _mm_kernel->window(), mm_pack);
+
+    if (_activation_func)
+    {
+        ITensorPack pack{{ACL_SRC, d}, {ACL_DST, d}};
+        _activation_func->run(pack);
+    }
+}
+
+void CpuGemmInt4::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        if (_reshape_b_only_on_first_run)
+        {
+            const ITensor      *b = tensors.get_const_tensor(ACL_SRC_1);
+            CpuAuxTensorHandler packed_rhs(offset_int_vec(PackedRHS), _packed_rhs, tensors);
+
+            ITensorPack pack_rhs_pack{{ACL_SRC, b}, {ACL_DST, packed_rhs.get()}};
+            NEScheduler::get().schedule_op(_pack_rhs_kernel.get(), Window::DimX, _pack_rhs_kernel->window(),
+                                           pack_rhs_pack);
+
+            // run() only reads the packed weights
+            if (consume_weights())
+            {
+                b->mark_as_unused();
+            }
+        }
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuGemmInt4::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGEMMINT4_H
+#define ACL_SRC_CPU_OPERATORS_CPUGEMMINT4_H
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuGemmInt4Kernel.h"
+#include "src/cpu/kernels/CpuGemmInt4PackRhsKernel.h"
+#include "src/cpu/kernels/CpuGemmInt4QuantizeLhsKernel.h"
+#include "src/cpu/operators/CpuActivation.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to multiply a F32/F16 matrix by block-quantized signed 4-bit weights. This function calls the following kernels:
+ *
+ *  -# @ref kernels::CpuGemmInt4PackRhsKernel (once if the weights are constant)
+ *  -# @ref kernels::CpuGemmInt4QuantizeLhsKernel (if fast math is enabled)
+ *  -# @ref kernels::CpuGemmInt4Kernel
+ *  -# @ref CpuActivation (if activation is specified in GEMMInfo)
+ *
+ * The weights are described by @ref GEMMInfo::int4_weights_info(). With fast math, the LHS is quantized to signed 8-bit
+ * values per group and the products are accumulated in integers, otherwise the weights are dequantized to F32.
+ */
+class CpuGemmInt4 : public ICpuOperator
+{
+public:
+    /** Default constructor */
+    CpuGemmInt4() = default;
+    /** Default destructor */
+    ~CpuGemmInt4() = default;
+    /** Configure operator for a given list of arguments
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0         |src1        |src2      |dst            |
+     * |:------------|:-----------|:---------|:--------------|
+     * |F32          |U8          |F32       |F32            |
+     * |F16          |U8          |F16       |F16            |
+     *
+     * @param[in]  a         First input tensor info. Shape supported: [K, M, batches]. Data type supported: F16/F32
+     * @param[in]  b         Block-quantized 4-bit weights tensor info, as described by @ref Int4WeightsInfo. Data type supported: U8
+     * @param[in]  c         Bias tensor info. Can be nullptr. Shape supported: 1D [N]. Data type supported: same as @p a
+     * @param[out] d         Output tensor info. Shape supported: [N, M, batches]. Data type supported: same as @p a
+     * @param[in]  gemm_info GEMM information. The weights descriptor must be enabled
+     */
+    void configure(
+        const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, ITensorInfo *d, const GEMMInfo &gemm_info);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuGemmInt4.
+     *
+     * Similar to @ref CpuGemmInt4::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *a,
+                           const ITensorInfo *b,
+                           const ITensorInfo *c,
+                           const ITensorInfo *d,
+                           const GEMMInfo    &gemm_info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        PackedRHS = 0,
+        QuantizedLHS,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuGemmInt4PackRhsKernel>     _pack_rhs_kernel{nullptr};
+    std::unique_ptr<kernels::CpuGemmInt4QuantizeLhsKernel> _quantize_lhs_kernel{nullptr};
+    std::unique_ptr<kernels::CpuGemmInt4Kernel>            _mm_kernel{nullptr};
+    std::unique_ptr<CpuActivation>                         _activation_func{nullptr};
+
+    TensorInfo _packed_rhs{};
+    TensorInfo _quantized_lhs{};
+
+    size_t _num_row_blocks{0};
+    bool   _reshape_b_only_on_first_run{false};
+    bool   _is_prepared{false};
+
+    experimental::MemoryRequirements _aux_mem{Count};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUGEMMINT4_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/ConsumeWeights.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 
@@ -464,6 +465,10 @@ Status CpuGemmLowpMatrixMultiplyCore::validate(const ITensorInfo *a,
         }
     }
 
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((a->is_dynamic() || output->is_dynamic()) &&
+                                        (!run_optimised_requantized || flip_signedness),
+                                    "Dynamic shapes are only supported by the requantizing assembly kernel");
+
     if (run_optimised)
     {
         ARM_COMPUTE_RETURN_ERROR_ON(b->dimension(0) != output->dimension(0));
@@ -794,6 +799,13 @@ void CpuGemmLowpMatrixMultiplyCore::prepare(ITensorPack &tensors)
             NEScheduler::get().schedule_op(_mtx_b_reduction_kernel.get(), Window::DimX,
                                            _mtx_b_reduction_kernel->window(), pack);
         }
+
+        // run() only reads the reshaped weights and the precomputed column sums
+        if (consume_weights() && !_asm_glue->is_configured() && _reshape_b_only_on_first_run &&
+            !_run_vector_matrix_multiplication)
+        {
+            original_b->mark_as_unused();
+        }
         _is_prepared = true;
     }
 }
@@ -802,6 +814,23 @@ experimental::MemoryRequirements CpuGemmLowpMatrixMultiplyCore::workspace() cons
     return _aux_mem;
 }
 
+void CpuGemmLowpMatrixMultiplyCore::update_shapes(const ITensorInfo *a, const ITensorInfo *dst)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_fused_assembly_path, "Dynamic shapes are only supported by the assembly kernel");
+    _asm_glue->update_shapes(a, dst);
+
+    const auto asm_mem_req = _asm_glue->workspace();
+    for (unsigned int slot = 0; slot < asm_mem_req.size(); ++slot)
+    {
+        _aux_mem[slot] = asm_mem_req[slot];
+    }
+
+    if (_run_activation)
+    {
+        _activation_func->configure(dst, nullptr, _gemm_info.activation_info());
+    }
+}
+
 void CpuGemmLowpMatrixMultiplyCore::update_quantization_parameters(const GEMMLowpOutputStageInfo &output_info,
                                                                    const QuantizationInfo        &a,
                                                                    const QuantizationInfo        &b,
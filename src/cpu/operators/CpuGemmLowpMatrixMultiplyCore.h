@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -139,6 +139,14 @@ public:
                                                                     const QuantizationInfo        &b,
                                                                     const bool                     is_prepared,
                                                                     const bool                     negated_offsets);
+    /** Update the shapes of an operator configured with dynamic shapes
+     *
+     * Only supported when the requantizing assembly kernel is used. The prepared weights are kept.
+     *
+     * @param[in] a   First input tensor info (Matrix A) with the new shape
+     * @param[in] dst Output tensor info with the new shape
+     */
+    void update_shapes(const ITensorInfo *a, const ITensorInfo *dst);
 
 private:
     enum AuxTensorIdx
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGemmSparse.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/ConsumeWeights.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuGemmSparse::configure(
+    const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, ITensorInfo *d, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmSparse::validate(a, b, c, d, gemm_info));
+    ARM_COMPUTE_LOG_PARAMS(a, b, c, d, gemm_info);
+
+    const WeightsSparsity sparsity   = gemm_info.weights_sparsity();
+    const size_t          block_rows = kernels::CpuGemmSparseKernel::block_rows;
+
+    _is_prepared                 = false;
+    _reshape_b_only_on_first_run = b->are_values_constant();
+    _num_row_blocks              = ceil_to_multiple(d->dimension(1), block_rows) / block_rows;
+
+    // Configure the compression of the weights
+    _pack_rhs_kernel = std::make_unique<kernels::CpuGemmSparsePackRhsKernel>();
+    _pack_rhs_kernel->configure(b, &_packed_rhs, sparsity);
+    _aux_mem[PackedRHS] =
+        MemoryInfo(offset_int_vec(PackedRHS),
+                   _reshape_b_only_on_first_run ? MemoryLifetime::Persistent : MemoryLifetime::Temporary,
+                   _packed_rhs.total_size());
+
+    // Configure the matrix multiplication
+    _mm_kernel = std::make_unique<kernels::CpuGemmSparseKernel>();
+    _mm_kernel->configure(a, &_packed_rhs, c, d, sparsity);
+
+    // Configure activation
+    if (gemm_info.activation_info().enabled())
+    {
+        _activation_func = std::make_unique<CpuActivation>();
+        _activation_func->configure(d, nullptr, gemm_info.activation_info());
+    }
+}
+
+Status CpuGemmSparse::validate(
+    const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, const ITensorInfo *d, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, d);
+
+    const WeightsSparsity sparsity = gemm_info.weights_sparsity();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(sparsity == WeightsSparsity::DENSE, "The weights must be sparse");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->is_dynamic() || d->is_dynamic(),
+                                    "Dynamic shapes are not supported with sparse weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_a_reshaped() || gemm_info.is_b_reshaped(),
+                                    "Reshaped matrices are not supported with sparse weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.reinterpret_input_as_3d() || gemm_info.depth_output_gemm3d() != 0,
+                                    "3D reinterpretation is not supported with sparse weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.pretranspose_B() || gemm_info.fixed_format(),
+                                    "The layout of sparse weights is fixed by the compression");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.accumulate(), "Accumulation is not supported with sparse weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.int4_weights_info().enabled(),
+                                    "Sparse weights cannot be block-quantized 4-bit values");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->dimension(1) != a->dimension(0),
+                                    "The K dimension of the weights must match the LHS");
+    ARM_COMPUTE_RETURN_ERROR_ON(b->dimension(0) != d->dimension(0));
+
+    TensorInfo packed_rhs(kernels::CpuGemmSparsePackRhsKernel::compute_packed_shape(*b, sparsity), 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmSparsePackRhsKernel::validate(b, &packed_rhs, sparsity));
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmSparseKernel::validate(a, &packed_rhs, c, d, sparsity));
+
+    if (gemm_info.activation_info().enabled())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuActivation::validate(d, nullptr, gemm_info.activation_info()));
+    }
+
+    return Status{};
+}
+
+void CpuGemmSparse::run(ITensorPack &tensors)
+{
+    prepare(tensors);
+
+    auto a = tensors.get_const_tensor(ACL_SRC_0);
+    auto b = tensors.get_const_tensor(ACL_SRC_1);
+    auto c = tensors.get_const_tensor(ACL_SRC_2);
+    auto d = tensors.get_tensor(ACL_DST);
+
+    CpuAuxTensorHandler packed_rhs(offset_int_vec(PackedRHS), _packed_rhs, tensors, true);
+
+    if (!_reshape_b_only_on_first_run)
+    {
+        ITensorPack pack_rhs_pack{{ACL_SRC, b}, {ACL_DST, packed_rhs.get()}};
+        NEScheduler::get().schedule_op(_pack_rhs_kernel.get(), Window::DimX, _pack_rhs_kernel->window(),
+                                       pack_rhs_pack);
+        ARM_COMPUTE_THROW_ON_ERROR(_pack_rhs_kernel->validate_packed_values());
+    }
+
+    // With few rows, as in matrix-vector products, the output columns are split across the threads instead
+    const size_t split_dimension =
+        (_num_row_blocks < NEScheduler::get().num_threads()) ? Window::DimX : Window::DimY;
+
+    ITensorPack mm_pack{{ACL_SRC_0, a}, {ACL_SRC_1, packed_rhs.get()}, {ACL_SRC_2, c}, {ACL_DST, d}};
+    NEScheduler::get().schedule_op(_mm_kernel.get(), split_dimension, _mm_kernel->window(), mm_pack);
+
+    if (_activation_func)
+    {
+        ITensorPack pack{{ACL_SRC, d}, {ACL_DST, d}};
+        _activation_func->run(pack);
+    }
+}
+
+void CpuGemmSparse::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        if (_reshape_b_only_on_first_run)
+        {
+            const ITensor      *b = tensors.get_const_tensor(ACL_SRC_1);
+            CpuAuxTensorHandler packed_rhs(offset_int_vec(PackedRHS), _packed_rhs, tensors);
+
+            ITensorPack pack_rhs_pack{{ACL_SRC, b}, {ACL_DST, packed_rhs.get()}};
+            NEScheduler::get().schedule_op(_pack_rhs_kernel.get(), Window::DimX, _pack_rhs_kernel->window(),
+                                           pack_rhs_pack);
+            ARM_COMPUTE_THROW_ON_ERROR(_pack_rhs_kernel->validate_packed_values());
+
+            // run() only reads the compressed weights
+            if (consume_weights())
+            {
+                b->mark_as_unused();
+            }
+        }
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuGemmSparse::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
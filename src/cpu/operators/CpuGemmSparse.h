@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGEMMSPARSE_H
+#define ACL_SRC_CPU_OPERATORS_CPUGEMMSPARSE_H
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuGemmSparseKernel.h"
+#include "src/cpu/kernels/CpuGemmSparsePackRhsKernel.h"
+#include "src/cpu/operators/CpuActivation.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to multiply a F32 matrix by sparse weights. This function calls the following kernels:
+ *
+ *  -# @ref kernels::CpuGemmSparsePackRhsKernel (once if the weights are constant)
+ *  -# @ref kernels::CpuGemmSparseKernel
+ *  -# @ref CpuActivation (if activation is specified in GEMMInfo)
+ *
+ * The sparsity pattern is given by @ref GEMMInfo::weights_sparsity(). The weights are provided dense and compressed
+ * when the function is prepared, so that the multiplication only loads and multiplies the non-zero values. Weights
+ * that do not follow the sparsity pattern make prepare() and run() throw an exception instead of being pruned.
+ */
+class CpuGemmSparse : public ICpuOperator
+{
+public:
+    /** Default constructor */
+    CpuGemmSparse() = default;
+    /** Default destructor */
+    ~CpuGemmSparse() = default;
+    /** Configure operator for a given list of arguments
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0         |src1        |src2      |dst            |
+     * |:------------|:-----------|:---------|:--------------|
+     * |F32          |F32         |F32       |F32            |
+     *
+     * @param[in]  a         First input tensor info. Shape supported: [K, M, batches]. Data type supported: F32
+     * @param[in]  b         Dense weights tensor info with explicit zeros. Shape supported: [N, K]. Data type supported: same as @p a
+     * @param[in]  c         Bias tensor info. Can be nullptr. Shape supported: 1D [N]. Data type supported: same as @p a
+     * @param[out] d         Output tensor info. Shape supported: [N, M, batches]. Data type supported: same as @p a
+     * @param[in]  gemm_info GEMM information. The sparsity pattern must not be WeightsSparsity::DENSE
+     */
+    void configure(
+        const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, ITensorInfo *d, const GEMMInfo &gemm_info);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuGemmSparse.
+     *
+     * Similar to @ref CpuGemmSparse::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *a,
+                           const ITensorInfo *b,
+                           const ITensorInfo *c,
+                           const ITensorInfo *d,
+                           const GEMMInfo    &gemm_info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        PackedRHS = 0,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuGemmSparsePackRhsKernel> _pack_rhs_kernel{nullptr};
+    std::unique_ptr<kernels::CpuGemmSparseKernel>        _mm_kernel{nullptr};
+    std::unique_ptr<CpuActivation>                       _activation_func{nullptr};
+
+    TensorInfo _packed_rhs{};
+
+    size_t _num_row_blocks{0};
+    bool   _reshape_b_only_on_first_run{false};
+    bool   _is_prepared{false};
+
+    experimental::MemoryRequirements _aux_mem{Count};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUGEMMSPARSE_H
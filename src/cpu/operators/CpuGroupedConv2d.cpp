@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGroupedConv2d.h"
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/AutoConfiguration.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+/** Number of rows of a problem: enough problems for the threads to balance the work, with a tile of the input that
+ * stays in the L1 cache while the packed weights of the group are streamed
+ */
+constexpr size_t rows_per_problem = 64;
+
+/** With the NHWC data layout, padding the width, unlike padding the channels, breaks the even spacing of the pixels */
+bool has_width_padding(const ITensorInfo &info)
+{
+    return info.padding().top != 0 || info.padding().bottom != 0;
+}
+
+GEMMInfo make_gemm_info(const Conv2dInfo &info)
+{
+    GEMMInfo gemm_info;
+    gemm_info.set_activation_info(info.act_info);
+    return gemm_info;
+}
+} // namespace
+
+std::vector<GEMMBatchedProblem> CpuGroupedConv2d::make_problems(const ITensorInfo &src,
+                                                                const ITensorInfo &weights,
+                                                                const ITensorInfo &dst,
+                                                                unsigned int       num_groups)
+{
+    const size_t element_size = src.element_size();
+    const size_t ifm          = src.dimension(0);
+    const size_t ofm          = dst.dimension(0);
+    const size_t ifm_group    = ifm / num_groups;
+    const size_t ofm_group    = ofm / num_groups;
+    const size_t num_rows     = src.tensor_shape().total_size_upper(1);
+
+    // Without padding in width the pixels are evenly spaced, even if the channels are padded
+    const size_t src_row_stride = src.strides_in_bytes()[1] / element_size;
+    const size_t dst_row_stride = dst.strides_in_bytes()[1] / element_size;
+
+    // The weights of a group are a [IFM / num_groups, OFM / num_groups] slice of the weights tensor
+    const size_t weights_stride_k = weights.strides_in_bytes()[0] / element_size;
+    const size_t weights_stride_n = weights.strides_in_bytes()[3] / element_size;
+
+    std::vector<GEMMBatchedProblem> problems;
+    for (unsigned int g = 0; g < num_groups; ++g)
+    {
+        for (size_t row0 = 0; row0 < num_rows; row0 += rows_per_problem)
+        {
+            GEMMBatchedProblem p;
+            p.m           = std::min(rows_per_problem, num_rows - row0);
+            p.n           = ofm_group;
+            p.k           = ifm_group;
+            p.a_offset    = row0 * src_row_stride + g * ifm_group;
+            p.lda         = src_row_stride;
+            p.b_offset    = g * ofm_group * weights_stride_n;
+            p.b_stride_k  = weights_stride_k;
+            p.b_stride_n  = weights_stride_n;
+            p.bias_offset = g * ofm_group;
+            p.d_offset    = row0 * dst_row_stride + g * ofm_group;
+            p.ldd         = dst_row_stride;
+            problems.push_back(p);
+        }
+    }
+    return problems;
+}
+
+void CpuGroupedConv2d::configure(const ITensorInfo *src,
+                                 const ITensorInfo *weights,
+                                 const ITensorInfo *biases,
+                                 ITensorInfo       *dst,
+                                 const Conv2dInfo  &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGroupedConv2d::validate(src, weights, biases, dst, info));
+    ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, info.conv_info, info.act_info, info.num_groups);
+
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(misc::shape_calculator::compute_deep_convolution_shape(
+                                 *src, *weights, info.conv_info)));
+
+    _num_groups  = info.num_groups;
+    _weights     = *weights;
+    _src_strides = src->strides_in_bytes();
+    _dst_strides = dst->strides_in_bytes();
+
+    _gemm_batched = std::make_unique<CpuGemmBatched>();
+    _gemm_batched->configure(src, weights, biases, dst, make_problems(*src, *weights, *dst, _num_groups),
+                             make_gemm_info(info));
+}
+
+Status CpuGroupedConv2d::validate(const ITensorInfo *src,
+                                  const ITensorInfo *weights,
+                                  const ITensorInfo *biases,
+                                  const ITensorInfo *dst,
+                                  const Conv2dInfo  &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(src, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.weights_info.are_reshaped(), "Reshaped weights are not supported");
+
+    const unsigned int num_groups = info.num_groups;
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(1) != 1 || weights->dimension(2) != 1,
+                                    "Grouped convolution is only supported with 1x1 kernels");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.conv_info.stride() != std::make_pair(1U, 1U) || info.conv_info.has_padding(),
+                                    "Grouped convolution is only supported without stride nor padding");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) % num_groups != 0 || weights->dimension(3) % num_groups != 0,
+                                    "The number of groups must divide the number of input and output channels");
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) * num_groups != src->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(has_width_padding(*src), "The input must not be padded in width");
+
+    if (biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(3));
+    }
+
+    const TensorShape dst_shape =
+        misc::shape_calculator::compute_deep_convolution_shape(*src, *weights, info.conv_info);
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), dst_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(has_width_padding(*dst), "The output must not be padded in width");
+    }
+
+    const TensorInfo   dst_info(dst_shape, 1, src->data_type(), DataLayout::NHWC);
+    const ITensorInfo *dst_to_use = (dst->total_size() != 0) ? dst : &dst_info;
+    return CpuGemmBatched::validate(src, weights, biases, dst_to_use,
+                                    make_problems(*src, *weights, *dst_to_use, num_groups), make_gemm_info(info));
+}
+
+void CpuGroupedConv2d::run(ITensorPack &tensors)
+{
+    const ITensorInfo *src_info = tensors.get_const_tensor(ACL_SRC_0)->info();
+    const ITensorInfo *dst_info = tensors.get_tensor(ACL_DST)->info();
+
+    // The channels of the input or the output can be padded after configure(): the views of the problems are then
+    // computed for the new strides, while the packed weights are kept
+    if (src_info->strides_in_bytes() != _src_strides || dst_info->strides_in_bytes() != _dst_strides)
+    {
+        ARM_COMPUTE_ERROR_ON(has_width_padding(*src_info) || has_width_padding(*dst_info));
+        _gemm_batched->run_with_views(tensors, make_problems(*src_info, _weights, *dst_info, _num_groups));
+    }
+    else
+    {
+        _gemm_batched->run(tensors);
+    }
+}
+
+void CpuGroupedConv2d::prepare(ITensorPack &constants)
+{
+    _gemm_batched->prepare(constants);
+}
+
+experimental::MemoryRequirements CpuGroupedConv2d::workspace() const
+{
+    return _gemm_batched->workspace();
+}
+} // namespace cpu
+} // namespace arm_compute
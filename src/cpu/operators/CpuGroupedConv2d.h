@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGROUPEDCONV2D_H
+#define ACL_SRC_CPU_OPERATORS_CPUGROUPEDCONV2D_H
+
+#include "arm_compute/core/Strides.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/GEMMBatchedInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/operators/CpuGemmBatched.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+struct Conv2dInfo;
+namespace cpu
+{
+/** Basic function to compute a grouped pointwise convolution with @ref CpuGemmBatched
+ *
+ * With the NHWC data layout and a 1x1 kernel without stride nor padding, the input of each group is a strided view of
+ * the input tensor with one row per pixel: the convolution is a batch of one matrix product per group. The rows of each
+ * group are split in several problems that share the same packed weights, so that the threads can balance the work
+ * even when there are fewer groups than threads.
+ */
+class CpuGroupedConv2d : public ICpuOperator
+{
+public:
+    CpuGroupedConv2d() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGroupedConv2d);
+    ~CpuGroupedConv2d() = default;
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |F32            |F32            |F32            |F32            |
+     *
+     * @param[in]  src     Source tensor info. 3 lower dimensions represent a single input [IFM, width, height],
+     *                     while every optional dimension from 4 and above represent a batch of inputs.
+     *                     Data types supported: F32.
+     * @param[in]  weights Weights tensor info. Weights are 4D tensor with dimensions [IFM / num_groups, 1, 1, OFM].
+     *                     Data type supported: Same as @p src.
+     * @param[in]  biases  Biases tensor info. Can be nullptr. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p src.
+     * @param[out] dst     Destination tensor info. 3 lower dimensions represent a single output [OFM, width, height], while the rest represent batch of outputs.
+     *                     Data types supported: Same as @p src.
+     * @param[in]  info    Contains the number of groups, which must divide IFM and OFM, and the fused activation, which can be
+     *                     RELU, BOUNDED_RELU or LU_BOUNDED_RELU. The convolution must have a stride of 1 and no padding.
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *weights,
+                   const ITensorInfo *biases,
+                   ITensorInfo       *dst,
+                   const Conv2dInfo  &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuGroupedConv2d
+     *
+     * Similar to CpuGroupedConv2d::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *weights,
+                           const ITensorInfo *biases,
+                           const ITensorInfo *dst,
+                           const Conv2dInfo  &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &constants) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    /** Describe the matrix products of the convolution
+     *
+     * @return One problem for each block of rows of each group
+     */
+    static std::vector<GEMMBatchedProblem>
+    make_problems(const ITensorInfo &src, const ITensorInfo &weights, const ITensorInfo &dst, unsigned int num_groups);
+
+    std::unique_ptr<CpuGemmBatched> _gemm_batched{nullptr};
+    unsigned int                    _num_groups{1};
+    TensorInfo                      _weights{};
+    Strides                         _src_strides{}; /**< Strides of the input at configure() */
+    Strides                         _dst_strides{}; /**< Strides of the output at configure() */
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUGROUPEDCONV2D_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,6 +80,15 @@ Status get_gemmlowp_output_stage_info(const ITensorInfo         *src,
 
     return Status{};
 }
+
+GEMMInfo int4_gemm_info(const CpuMatMulSettings &settings, const ActivationLayerInfo &act_info)
+{
+    GEMMInfo gemm_info;
+    gemm_info.set_fast_math(settings.fast_math());
+    gemm_info.set_activation_info(act_info);
+    gemm_info.set_int4_weights_info(settings.int4_weights_info());
+    return gemm_info;
+}
 } // namespace
 
 CpuMatMul::CpuMatMul()
@@ -101,11 +110,22 @@ Status CpuMatMul::validate(const ITensorInfo         *lhs,
                            const CpuMatMulSettings   &settings,
                            const ActivationLayerInfo &act_info)
 {
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->are_values_constant(), "LHS Tensor must be dynamic.");
+
+    // Constant 4-bit weights are packed only once, in prepare()
+    if (settings.int4_weights_info().enabled())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.adj_lhs() || !info.adj_rhs(),
+                                        "4-bit RHS must be transposed and LHS must not be transposed");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs->num_dimensions() > 2, "4-bit RHS must be 2 dimensional");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(settings.fixed_format(), "Fixed format is not supported with 4-bit RHS");
+        return CpuGemmInt4::validate(lhs, rhs, nullptr, dst, int4_gemm_info(settings, act_info));
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs->are_values_constant(), "RHS Tensor must be dynamic.");
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, rhs, dst);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::F32, DataType::F16, DataType::BFLOAT16,
                                                          DataType::QASYMM8, DataType::QASYMM8_SIGNED);
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->are_values_constant(), "LHS Tensor must be dynamic.");
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs->are_values_constant(), "RHS Tensor must be dynamic.");
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(lhs);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(lhs);
 
@@ -190,6 +210,20 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     _adj_rhs   = info.adj_rhs();
     _fast_math = settings.fast_math();
 
+    // Block-quantized 4-bit rhs is already stored transposed and is packed by the dedicated GEMM
+    if (settings.int4_weights_info().enabled())
+    {
+        _int4_gemm = std::make_unique<CpuGemmInt4>();
+        _int4_gemm->configure(lhs, rhs, nullptr, dst, int4_gemm_info(settings, act_info));
+
+        const auto int4_mem_req = _int4_gemm->workspace();
+        for (unsigned int slot = 0; slot < int4_mem_req.size(); ++slot)
+        {
+            _aux_mem[slot] = int4_mem_req[slot];
+        }
+        return;
+    }
+
     // 1. Create and reshape tensors
     // ------------------------------------------------------
     // a. Clone TensorInfo to prevent changing original tensor values during setup
@@ -282,8 +316,22 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     }
 }
 
+void CpuMatMul::prepare(ITensorPack &tensors)
+{
+    if (_int4_gemm)
+    {
+        _int4_gemm->prepare(tensors);
+    }
+}
+
 void CpuMatMul::run(ITensorPack &tensors)
 {
+    if (_int4_gemm)
+    {
+        _int4_gemm->run(tensors);
+        return;
+    }
+
     // Retrieve tensors from tensor pack
     auto lhs = tensors.get_tensor(ACL_SRC_0);
     auto rhs = tensors.get_const_tensor(ACL_SRC_1);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
+#include "src/cpu/operators/CpuGemmInt4.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
 namespace arm_compute
@@ -45,6 +46,9 @@ namespace cpu
  *  -# @ref cpu::kernels::CpuTransposeKernel
  * Then :
  *  -# @ref cpu::CpuGemmAssemblyDispatch
+ *
+ * If the rhs holds block-quantized 4-bit weights :
+ *  -# @ref cpu::CpuGemmInt4
  */
 class CpuMatMul : public ICpuOperator
 {
@@ -88,6 +92,7 @@ public:
 
     // Inherited methods overridden:
     void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
     experimental::MemoryRequirements workspace() const override;
 
 private:
@@ -103,6 +108,7 @@ private:
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_lhs{nullptr};
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_rhs{nullptr};
     std::unique_ptr<CpuGemmAssemblyDispatch>     _asm_glue{nullptr};
+    std::unique_ptr<CpuGemmInt4>                 _int4_gemm{nullptr};
 
     // TensorInfo for tensors stored in auxillary memory
     TensorInfo _lhs_transposed{};
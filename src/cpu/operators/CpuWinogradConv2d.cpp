@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,8 +28,11 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/ConsumeWeights.h"
 #include "arm_compute/runtime/FunctionDescriptors.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/PreparedWeightsCache.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Log.h"
 #include "src/core/CPP/Validate.h"
@@ -424,7 +427,44 @@ void CpuWinogradConv2d::prepare(ITensorPack &tensors)
     if (!_is_prepared)
     {
         const ITensor *weights = tensors.get_const_tensor(ACL_SRC_1);
-        ITensor       *weights_aux =
+
+        // Look for the weights already transformed by a previous run in the prepared weights cache
+        PreparedWeightsCache &cache = PreparedWeightsCache::get();
+        std::string           cache_key{};
+        if (cache.is_enabled())
+        {
+            const auto &wds          = _winograd_impl.winograd_spec;
+            const auto  cache_config = _winograd_impl.weight_transform->get_name() + ";" +
+                                      std::to_string(static_cast<int>(_winograd_transformed_weights.data_type())) +
+                                      ",ld_row:" + std::to_string(wds.weight_ld_row) +
+                                      ",ld_matrix:" + std::to_string(wds.weight_ld_matrix) +
+                                      ",size:" + std::to_string(wds.weight_matrix_size_bytes);
+            cache_key = PreparedWeightsCache::make_key("CpuWinogradConv2d", PreparedWeightsCache::hash(*weights),
+                                                       cache_config);
+
+            const std::shared_ptr<const uint8_t> cached_weights =
+                cache.load(cache_key, _winograd_transformed_weights.total_size());
+            if (cached_weights != nullptr)
+            {
+                // The GEMM only reads the transformed weights while it prepares them, so it can use the read-only
+                // mapping of the cache file
+                Tensor transformed_weights;
+                transformed_weights.allocator()->init(_winograd_transformed_weights);
+                transformed_weights.allocator()->import_memory(const_cast<uint8_t *>(cached_weights.get()));
+
+                ITensorPack gemm_pack = tensors;
+                gemm_pack.add_const_tensor(ACL_SRC_1, &transformed_weights);
+                _gemm_function->prepare(gemm_pack);
+                if (consume_weights())
+                {
+                    weights->mark_as_unused();
+                }
+                _is_prepared = true;
+                return;
+            }
+        }
+
+        ITensor *weights_aux =
             utils::cast::polymorphic_cast<ITensor *>(tensors.get_tensor(offset_int_vec(PermutedWeights)));
 
         CpuAuxTensorHandler permuted_weights(_weights_hwio, *weights_aux);
@@ -463,9 +503,20 @@ void CpuWinogradConv2d::prepare(ITensorPack &tensors)
             *_conv_args, permuted_weights_ptr, permuted_weight_row_stride, permuted_weight_col_stride,
             permuted_weight_channel_stride, win_wght_transf_ptr, _winograd_impl.winograd_spec, 0, 1 // Thread 1 of 1
         );
+        if (!cache_key.empty())
+        {
+            cache.store(cache_key, reinterpret_cast<const uint8_t *>(win_wght_transf_ptr),
+                        _winograd_transformed_weights.total_size());
+        }
         ITensorPack gemm_pack = tensors;
         gemm_pack.add_const_tensor(ACL_SRC_1, winograd_transformed_weights.get());
         _gemm_function->prepare(gemm_pack);
+
+        // run() only reads the weights transformed to the Winograd domain
+        if (consume_weights())
+        {
+            weights->mark_as_unused();
+        }
         _is_prepared = 1;
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,8 +25,13 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/PreparedWeightsCache.h"
 
+#include "src/common/cpuinfo/CpuIsaInfo.h"
+#include "src/common/cpuinfo/CpuModel.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/AssemblyUtils.h"
@@ -36,6 +41,11 @@
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 #include <arm_neon.h>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <set>
+#include <sstream>
 
 namespace arm_compute
 {
@@ -98,6 +108,30 @@ void run_parallel_pretranspose_B_array(arm_gemm::GemmCommon<TypeInput, TypeWeigh
     }
     NEScheduler::get().run_tagged_workloads(workloads, "CpuGemmAssemblyDispatch/pretranspose_B_array");
 }
+
+/** Parameters of an output stage the pretransposed B depends on, as part of the prepared weights cache key */
+template <typename OutputStage>
+std::string output_stage_cache_config(const OutputStage &)
+{
+    return "";
+}
+
+std::string output_stage_cache_config(const arm_gemm::Requantize32 &os)
+{
+    // The column sums stored with the pretransposed B depend on the offsets
+    return ";a_offset:" + std::to_string(os.a_offset) + ",b_offset:" + std::to_string(os.b_offset);
+}
+
+/** Keep a copy of updated requantization parameters for the output stages that use them */
+template <typename OutputStage>
+void update_output_stage(OutputStage &, const arm_gemm::Requantize32 &)
+{
+}
+
+void update_output_stage(arm_gemm::Requantize32 &os, const arm_gemm::Requantize32 &requant)
+{
+    os = requant;
+}
 } // namespace
 
 using namespace arm_compute::experimental;
@@ -147,6 +181,241 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
     return p;
 }
 
+/** Scheduling hint compatible with the window exposed by arm_gemm
+ *
+ * @param[in] win Window of the assembly kernel wrapper
+ *
+ * @return The scheduling hint
+ */
+IScheduler::Hints gemm_scheduling_hint(const Window &win)
+{
+    // The default case is when we split among the X dimension
+    IScheduler::Hints scheduling_hint = IScheduler::Hints(Window::DimX);
+    // If arm_gemm exposes a 2D window, perform 2D scheduling
+    if (win.num_iterations(Window::DimY) > 1 && win.num_iterations(Window::DimX) > 1)
+    {
+        scheduling_hint = IScheduler::Hints(IScheduler::split_dimensions_all);
+    }
+    // Split among Y
+    else if (win.num_iterations(Window::DimY) > 1)
+    {
+        scheduling_hint = IScheduler::Hints(Window::DimY);
+    }
+    return scheduling_hint;
+}
+
+/** Number of threads the assembly kernel is split over
+ *
+ * @param[in] win         Window of the assembly kernel wrapper
+ * @param[in] window_size Total size of the window of the assembly kernel
+ * @param[in] hint        Scheduling hint of the assembly kernel wrapper
+ *
+ * @return The number of threads the assembly kernel must expect
+ */
+unsigned int num_gemm_threads(const Window &win, unsigned int window_size, const IScheduler::Hints &hint)
+{
+    unsigned int num_threads = std::min(window_size, NEScheduler::get().num_threads());
+    if (hint.split_dimension() != IScheduler::split_dimensions_all)
+    {
+        // Make sure the kernel does not expect more threads than we can actually spawn
+        num_threads = std::min(static_cast<unsigned int>(win.num_iterations(hint.split_dimension())), num_threads);
+    }
+    return num_threads;
+}
+
+/** CPU models and ISA extensions of the system, which the kernels available and their timings depend on */
+const std::string &cpu_tuning_signature()
+{
+    static const std::string signature = []()
+    {
+        const CPUInfo        &cpu_info = CPUInfo::get();
+        std::set<std::string> models;
+        for (unsigned int cpu = 0; cpu < cpu_info.get_cpu_num(); ++cpu)
+        {
+            models.insert(cpuinfo::cpu_model_to_string(cpu_info.get_cpu_model(cpu)));
+        }
+
+        std::stringstream ss;
+        ss << "cpus:";
+        for (auto it = models.begin(); it != models.end(); ++it)
+        {
+            ss << (it != models.begin() ? "+" : "") << *it;
+        }
+        const cpuinfo::CpuIsaInfo isa = cpu_info.get_isa();
+        ss << ",isa:" << isa.neon << isa.sve << isa.sve2 << isa.sme << isa.sme2 << isa.fhm << isa.fp16 << isa.bf16
+           << isa.svebf16 << isa.dot << isa.i8mm << isa.svei8mm << isa.svef32mm
+           << ",smevl:" << cpu_info.get_sme2_vector_length_in_bytes();
+        return ss.str();
+    }();
+    return signature;
+}
+
+/** Identifier of a GEMM in the tuning table of @ref NEGEMMTuner, valid on the CPUs of the same models only */
+std::string
+gemm_tuning_id(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const arm_gemm::GemmArgs &args)
+{
+    std::stringstream ss;
+    ss << string_from_data_type(a->data_type()) << "," << string_from_data_type(b->data_type()) << ","
+       << string_from_data_type(d->data_type()) << ",M:" << args._Msize << ",N:" << args._Nsize << ",K:" << args._Ksize
+       << ",batches:" << args._nbatches << ",multis:" << args._nmulti << ",threads:" << args._maxthreads
+       << ",act:" << static_cast<int>(args._act.type) << ",fast:" << args._fast_mode << ",acc:" << args._accumulate
+       << "," << cpu_tuning_signature();
+    return ss.str();
+}
+
+/** Create the assembly kernel with the given name
+ *
+ * @param[in]  args        Arguments of the GEMM
+ * @param[in]  os          Output stage of the GEMM
+ * @param[in]  kernel_name Name of the kernel to create
+ * @param[out] cfg         Configuration selecting the kernel, must outlive the call
+ *
+ * @return The kernel, nullptr if it doesn't support the arguments
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+arm_gemm::UniqueGemmCommon<TypeInput, TypeWeight, TypeOutput>
+create_named_kernel(const arm_gemm::GemmArgs &args,
+                    const OutputStage        &os,
+                    const std::string        &kernel_name,
+                    arm_gemm::GemmConfig     &cfg)
+{
+    cfg                           = args._cfg != nullptr ? *args._cfg : arm_gemm::GemmConfig();
+    cfg.method                    = arm_gemm::GemmMethod::DEFAULT;
+    cfg.filter                    = kernel_name;
+    arm_gemm::GemmArgs named_args = args;
+    named_args._cfg               = &cfg;
+    return arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(named_args, os);
+}
+
+/** Time an assembly kernel on zero-initialised operands
+ *
+ * @param[in] gemm           Assembly kernel to time
+ * @param[in] args           Arguments the kernel was created with
+ * @param[in] num_iterations Number of timed runs
+ *
+ * @return Time of the fastest run in nanoseconds
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+uint64_t time_gemm_kernel(arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> &gemm,
+                          const arm_gemm::GemmArgs                                &args,
+                          unsigned int                                             num_iterations)
+{
+    const size_t m       = args._Msize;
+    const size_t n       = args._Nsize;
+    const size_t k       = args._Ksize;
+    const size_t batches = args._nbatches;
+    const size_t multis  = args._nmulti;
+
+    // Uninitialised floating point operands could hold denormals, which would skew the timings
+    const auto allocate = [](Tensor &tensor, size_t size, size_t alignment)
+    {
+        tensor.allocator()->init(TensorInfo(TensorShape(std::max<size_t>(size, 1)), 1, DataType::U8), alignment);
+        tensor.allocator()->allocate();
+        std::memset(tensor.buffer(), 0, size);
+        return tensor.buffer();
+    };
+    Tensor     a;
+    Tensor     b;
+    Tensor     d;
+    Tensor     pretranspose;
+    Tensor     workspace;
+    const auto a_ptr =
+        reinterpret_cast<const TypeInput *>(allocate(a, m * k * batches * multis * sizeof(TypeInput), 0));
+    const auto b_ptr = reinterpret_cast<const TypeWeight *>(allocate(b, k * n * multis * sizeof(TypeWeight), 0));
+    const auto d_ptr = reinterpret_cast<TypeOutput *>(allocate(d, m * n * batches * multis * sizeof(TypeOutput), 0));
+
+    if (gemm.B_pretranspose_required())
+    {
+        // Forcing 128-byte alignment (required by 32-bit kernels)
+        gemm.pretranspose_B_array(allocate(pretranspose, gemm.get_B_pretransposed_array_size(), 128), b_ptr, n, n * k,
+                                  false);
+    }
+
+    kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput> wrapper;
+    wrapper.configure(&gemm, "tuning");
+    const IScheduler::Hints hint = gemm_scheduling_hint(wrapper.window());
+    if (gemm.get_working_size() != 0)
+    {
+        gemm.set_working_space(allocate(workspace, gemm.get_working_size(), 4096));
+        gemm.set_nthreads(num_gemm_threads(wrapper.window(), gemm.get_window_size().total_size(), hint));
+    }
+    gemm.set_arrays(a_ptr, k, m * k, m * k * batches, b_ptr, n, n * k, d_ptr, n, m * n, m * n * batches, nullptr, 0);
+
+    // The first run warms up the caches and the threads, and isn't timed
+    uint64_t best_time = std::numeric_limits<uint64_t>::max();
+    for (unsigned int i = 0; i <= num_iterations; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        NEScheduler::get().schedule(&wrapper, hint);
+        const auto end = std::chrono::steady_clock::now();
+        if (i != 0)
+        {
+            const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            best_time       = std::min(best_time, static_cast<uint64_t>(time));
+        }
+    }
+    return best_time;
+}
+
+/** Name of the kernel the tuner selects for a GEMM
+ *
+ * Looks the GEMM up in the tuning table, or times its compatible kernels and stores the fastest one in the table if
+ * tuning of new GEMMs is enabled.
+ *
+ * @param[in] gemm_id Identifier of the GEMM, see @ref gemm_tuning_id
+ * @param[in] args    Arguments of the GEMM
+ * @param[in] os      Output stage of the GEMM
+ *
+ * @return Name of the kernel to use, empty to keep the default selection
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+std::string tune_gemm_kernel(const std::string &gemm_id, const arm_gemm::GemmArgs &args, const OutputStage &os)
+{
+    NEGEMMTuner &tuner = NEGEMMTuner::get();
+    std::string  kernel_name{};
+    if (tuner.find_tuning_params(gemm_id, kernel_name) || !tuner.tune_new_kernels())
+    {
+        return kernel_name;
+    }
+
+    const auto candidates = arm_gemm::get_compatible_kernels<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os);
+    const unsigned int num_iterations = tuner.num_iterations();
+    uint64_t           best_time      = std::numeric_limits<uint64_t>::max();
+    for (const auto &candidate : candidates)
+    {
+        // arm_gemm selects kernels by substring, so a name contained in another one can't select its kernel alone
+        const bool is_ambiguous = std::any_of(candidates.begin(), candidates.end(),
+                                              [&](const arm_gemm::KernelDescription &other)
+                                              {
+                                                  return other.name != candidate.name &&
+                                                         other.name.find(candidate.name) != std::string::npos;
+                                              });
+        if (is_ambiguous)
+        {
+            continue;
+        }
+
+        arm_gemm::GemmConfig cfg{};
+        auto gemm = create_named_kernel<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os, candidate.name, cfg);
+        if (gemm == nullptr)
+        {
+            continue;
+        }
+        const uint64_t time = time_gemm_kernel<TypeInput, TypeWeight, TypeOutput>(*gemm, args, num_iterations);
+        if (time < best_time)
+        {
+            best_time   = time;
+            kernel_name = candidate.name;
+        }
+    }
+
+    if (!kernel_name.empty())
+    {
+        tuner.add_tuning_params(gemm_id, kernel_name);
+    }
+    return kernel_name;
+}
+
 /** Fallback in case ACL doesn't have a function */
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage = arm_gemm::Nothing>
 class Fallback : public CpuGemmAssemblyDispatch::IFallback
@@ -192,6 +461,7 @@ public:
     void                             prepare(ITensorPack &tensors) override;
     bool                             is_configured() const override;
     experimental::MemoryRequirements workspace() const override;
+    void                             update_shapes(const ITensorInfo *a, const ITensorInfo *d) override;
     bool                             isVarWeightsKernel() const override
     {
         if (!_gemm_kernel_asm)
@@ -231,6 +501,8 @@ public:
         }
 
         _gemm_kernel_asm->update_quantization_parameters(gemm_requant_info);
+        update_output_stage(_os, gemm_requant_info);
+        _cache_output_stage = output_stage_cache_config(gemm_requant_info);
 
         // After update_quantization_parameters(), window may change, reconfigure it.
         auto *opt = reinterpret_cast<kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput> *>(
@@ -260,6 +532,8 @@ private:
     void configure_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const AsmGemmInfo &info);
     /** Prepare the indirect buffer */
     void prepare_indirect_buffer(ITensorPack &tensors);
+    /** Configure the Arm® Neon™ wrapper and the workspace of the assembly kernel */
+    void configure_wrapper();
 
     /** Operator to transpose B before gemm or pretranspose_B_array*/
     std::unique_ptr<CpuTranspose> _pre_pretranspose_b{nullptr};
@@ -294,6 +568,28 @@ private:
     bool                                  _is_c_constant{true};
     bool                                  _run_pre_pretranspose_b{false};
     bool                                  _B_pre_pretranspose_required{false};
+    /** Configuration of the kernel the pretransposed B depends on, as part of the prepared weights cache key */
+    std::string _cache_config{};
+    /** Parameters of the output stage the pretransposed B depends on, as part of the prepared weights cache key */
+    std::string _cache_output_stage{};
+    /** Pretransposed B mapped from the prepared weights cache, or shared with the other operators of the process */
+    std::shared_ptr<const uint8_t> _cached_pretranspose{nullptr};
+    /** Whether the pretransposed B is shared with the other operators of the process */
+    bool _share_pretranspose{false};
+    /** Whether the pretransposed B lives in the prepared weights cache instead of a persistent workspace tensor */
+    bool _cache_pretranspose{false};
+    /** Arguments of the assembly kernel */
+    arm_gemm::GemmArgs _args{nullptr, 0, 0, 0, 0, 0, 0, false, {}, 1};
+    /** Configuration of the assembly kernel, kept when the shapes change */
+    arm_gemm::GemmConfig _kernel_cfg{};
+    /** Output stage of the assembly kernel */
+    OutputStage _os{};
+    /** B tensor info */
+    TensorInfo _b_info{};
+    /** Whether the shapes of A and D can change after configure */
+    bool _is_dynamic{false};
+    /** Whether the kernel was recreated after B was prepared and needs to be pointed at it */
+    bool _rebind_pretransposed_b{false};
 };
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
@@ -457,38 +753,60 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
 {
     _is_b_constant = b->are_values_constant();
     _is_c_constant = c ? c->are_values_constant() : true;
+    _is_dynamic    = a->is_dynamic() || d->is_dynamic();
 
-    _gemm_kernel_asm = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os);
-    if (_gemm_kernel_asm == nullptr)
+    if (_is_dynamic && args._Msize == 1)
     {
-        //configuration not supported: Leave function unconfigured:
-        return;
+        // Don't let the initial shape select a GEMV-only kernel, which can't run the later shapes
+        arm_gemm::GemmArgs selection_args = args;
+        selection_args._Msize             = 2;
+        const auto selection = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(selection_args, os);
+        if (selection == nullptr)
+        {
+            return;
+        }
+        _kernel_cfg = selection->get_config();
+        args._cfg   = &_kernel_cfg;
     }
 
-    arm_gemm::GemmConfig gemm_cfg = _gemm_kernel_asm->get_config();
-
-    // arm_compute wrapper for the Gemm object (see above)
-    auto acl_gemm_wrapper = std::make_unique<kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput>>();
-    ARM_COMPUTE_ERROR_ON(acl_gemm_wrapper == nullptr);
-    acl_gemm_wrapper->configure(_gemm_kernel_asm.get(), gemm_cfg.filter);
-    const size_t       workspace_size = _gemm_kernel_asm->get_working_size();
-    const unsigned int alignment      = 4096;
-    _workspace_info                   = TensorInfo(TensorShape(workspace_size), 1, DataType::U8);
-    _aux_mem[AsmGemmWorkspace] =
-        MemoryInfo(offset_int_vec(AsmGemmWorkspace), MemoryLifetime::Temporary, workspace_size, alignment);
-
-    //if we disable this code below in brackets then ConvLayer deadlocks when threads > 1 and
-    //the shapes are In=1x1x1024 Weights=1x1x1024x1001 Biases=1001 Out=1x1x1001
+    // Let the tuner pick the kernel. Fixed format and indirect kernels are left alone, as their weights or
+    // indirection buffers are laid out by the caller for the default kernel.
+    arm_gemm::GemmConfig tuned_cfg{};
+    const bool           is_tunable = !_is_dynamic && !args._fixed_format && !args._indirect_input &&
+                            args._Ksections == 1 && gemm_info.method == AsmConvMethod::Im2Col &&
+                            (args._cfg == nullptr || args._cfg->weight_format == arm_gemm::WeightFormat::ANY);
+    if (is_tunable && NEGEMMTuner::get().is_enabled())
     {
-        const unsigned int window_size = _gemm_kernel_asm->get_window_size().total_size();
-        if (window_size < static_cast<unsigned int>(args._maxthreads))
+        const std::string kernel_name = tune_gemm_kernel<TypeInput, TypeWeight, TypeOutput, OutputStage>(
+            gemm_tuning_id(a, b, d, args), args, os);
+        if (!kernel_name.empty())
         {
-            _gemm_kernel_asm->set_nthreads(window_size);
+            _gemm_kernel_asm =
+                create_named_kernel<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os, kernel_name, tuned_cfg);
         }
     }
 
-    _optimised_kernel = std::move(acl_gemm_wrapper);
-    _gemm_info        = gemm_info;
+    if (_gemm_kernel_asm == nullptr)
+    {
+        _gemm_kernel_asm = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os);
+    }
+    if (_gemm_kernel_asm == nullptr)
+    {
+        //configuration not supported: Leave function unconfigured:
+        return;
+    }
+
+    // Keep what is needed to recreate the same kernel when the shapes change
+    _kernel_cfg = _gemm_kernel_asm->get_config();
+    _args       = args;
+    _args._cfg  = &_kernel_cfg;
+    _os         = os;
+    _b_info     = *b;
+    _gemm_info  = gemm_info;
+
+    configure_wrapper();
+
+    const arm_gemm::GemmConfig &gemm_cfg = _kernel_cfg;
 
     // Check if we need to pre-pretranspose B. Fixed format kernels need no pre-pretranspose.
     _B_pre_pretranspose_required = _gemm_info.transpose_b && !isVarWeightsKernel();
@@ -539,8 +857,25 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
         const unsigned int alignment           = 128;
         const size_t       B_pretranspose_size = _gemm_kernel_asm->get_B_pretransposed_array_size();
         _pretranspose_info                     = TensorInfo(TensorShape(B_pretranspose_size), 1, DataType::U8);
-        MemoryLifetime lifetime = _is_b_constant ? MemoryLifetime::Persistent : MemoryLifetime::Temporary;
-        _aux_mem[Pretranspose]  = MemoryInfo(offset_int_vec(Pretranspose), lifetime, B_pretranspose_size, alignment);
+        // A pretransposed B going through the prepared weights cache is either mapped from the cache or shared with
+        // the process, so no workspace is requested for it: a cache hit allocates nothing, and a miss pretransposes
+        // B into a buffer local to prepare()
+        PreparedWeightsCache &cache = PreparedWeightsCache::get();
+        _share_pretranspose         = _is_b_constant && _is_c_constant && cache.is_sharing_enabled();
+        _cache_pretranspose         = _share_pretranspose || (_is_b_constant && _is_c_constant && cache.is_enabled());
+        const MemoryLifetime lifetime = _is_b_constant ? MemoryLifetime::Persistent : MemoryLifetime::Temporary;
+        _aux_mem[Pretranspose]        = MemoryInfo(offset_int_vec(Pretranspose), lifetime,
+                                                   _cache_pretranspose ? 0 : B_pretranspose_size, alignment);
+
+        std::stringstream cache_config;
+        cache_config << gemm_cfg.filter << ";method:" << static_cast<int>(gemm_cfg.method)
+                     << ",blocks:" << gemm_cfg.inner_block_size << "x" << gemm_cfg.outer_block_size
+                     << ",wf:" << static_cast<int>(gemm_cfg.weight_format) << ";N:" << args._Nsize
+                     << ",K:" << args._Ksize << ",sections:" << args._Ksections << ",multis:" << args._nmulti
+                     << ",b:" << static_cast<int>(b->data_type()) << ",transpose_b:" << _B_pre_pretranspose_required
+                     << ",size:" << B_pretranspose_size;
+        _cache_config       = cache_config.str();
+        _cache_output_stage = output_stage_cache_config(os);
     }
 
     // Handle indirect GEMM convolution
@@ -557,6 +892,69 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
     }
 }
 
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_wrapper()
+{
+    // arm_compute wrapper for the Gemm object (see above)
+    auto acl_gemm_wrapper = std::make_unique<kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput>>();
+    ARM_COMPUTE_ERROR_ON(acl_gemm_wrapper == nullptr);
+    acl_gemm_wrapper->configure(_gemm_kernel_asm.get(), _kernel_cfg.filter);
+    const size_t       workspace_size = _gemm_kernel_asm->get_working_size();
+    const unsigned int alignment      = 4096;
+    _workspace_info                   = TensorInfo(TensorShape(workspace_size), 1, DataType::U8);
+    _aux_mem[AsmGemmWorkspace] =
+        MemoryInfo(offset_int_vec(AsmGemmWorkspace), MemoryLifetime::Temporary, workspace_size, alignment);
+
+    //if we disable this code below in brackets then ConvLayer deadlocks when threads > 1 and
+    //the shapes are In=1x1x1024 Weights=1x1x1024x1001 Biases=1001 Out=1x1x1001
+    {
+        const unsigned int window_size = _gemm_kernel_asm->get_window_size().total_size();
+        if (window_size < static_cast<unsigned int>(_args._maxthreads))
+        {
+            _gemm_kernel_asm->set_nthreads(window_size);
+        }
+    }
+
+    _optimised_kernel = std::move(acl_gemm_wrapper);
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::update_shapes(const ITensorInfo *a, const ITensorInfo *d)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_dynamic, "The GEMM wasn't configured with dynamic shapes");
+
+    const Params p = extract_parameters(a, &_b_info, d, _gemm_info);
+    if (p.M == _args._Msize && p.batches == _args._nbatches)
+    {
+        return;
+    }
+    ARM_COMPUTE_ERROR_ON(p.N != _args._Nsize || p.K != _args._Ksize || p.multis != _args._nmulti);
+
+    // Recreate the kernel picked at configure time, so that the prepared B matches its layout
+    arm_gemm::GemmArgs args = _args;
+    args._Msize             = p.M;
+    args._nbatches          = p.batches;
+    auto gemm_kernel_asm    = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, _os);
+    if (gemm_kernel_asm == nullptr || gemm_kernel_asm->get_config().filter != _kernel_cfg.filter)
+    {
+        ARM_COMPUTE_ERROR("The assembly kernel doesn't support the new shapes");
+    }
+
+    _gemm_kernel_asm = std::move(gemm_kernel_asm);
+    _args            = args;
+    configure_wrapper();
+
+    if (std::is_same<OutputStage, arm_gemm::DequantizeFloat>::value)
+    {
+        _gemm_kernel_asm->set_dequantize_scale(a->quantization_info().uniform().scale *
+                                               _b_info.quantization_info().uniform().scale);
+    }
+
+    // The pretransposed B buffer keeps its configure time size: the part of it that depends on M is
+    // only used for testing, so the buffer prepared once stays valid for every shape.
+    _rebind_pretransposed_b = _is_prepared;
+}
+
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPack &tensors)
 {
@@ -574,15 +972,35 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
         }
         const ITensor *b_to_use = b;
 
+        // Look for B already pretransposed by a previous run in the prepared weights cache.
+        // The pretransposed B of non-constant weights or biases is updated in run(), so can't be read-only.
+        PreparedWeightsCache &cache = PreparedWeightsCache::get();
+        std::string           cache_key{};
+        _cached_pretranspose = nullptr;
+        if (_B_pretranspose_required && _cache_pretranspose)
+        {
+            cache_key = PreparedWeightsCache::make_key("CpuGemmAssemblyDispatch", PreparedWeightsCache::hash(*b),
+                                                       _cache_config + _cache_output_stage);
+            if (_share_pretranspose)
+            {
+                _cached_pretranspose = cache.find_shared(cache_key, _pretranspose_info.total_size());
+            }
+            if (_cached_pretranspose == nullptr)
+            {
+                _cached_pretranspose = cache.load(cache_key, _pretranspose_info.total_size());
+            }
+        }
+        const bool use_cached_b = _cached_pretranspose != nullptr;
+
         // Pre-pretranspose B if required
         CpuAuxTensorHandler pre_pretransposed_b(
             offset_int_vec(PrePretransposedB), _pre_pretransposed_b_info, tensors,
             /*pack_inject: no need to inject into tensors*/
             false,
             /*bypass_alloc: no need to allocate if pre-pretranspose B is not required as this handle will not be used*/
-            !_run_pre_pretranspose_b);
+            !_run_pre_pretranspose_b || use_cached_b);
 
-        if (_run_pre_pretranspose_b)
+        if (_run_pre_pretranspose_b && !use_cached_b)
         {
             ARM_COMPUTE_ERROR_ON(_pre_pretranspose_b == nullptr);
             ITensorPack pre_pretranspose_pack{{ACL_SRC, b_to_use}, {ACL_DST, pre_pretransposed_b.get()}};
@@ -590,8 +1008,14 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
             b_to_use = pre_pretransposed_b.get();
         }
 
+        if (use_cached_b)
+        {
+            // The kernels only read the pretransposed B, so they can use the read-only mapping of the cache file
+            _gemm_kernel_asm->set_pretransposed_B_data(const_cast<uint8_t *>(_cached_pretranspose.get()));
+            b->mark_as_unused();
+        }
         // Pretranspose B if required
-        if (_B_pretranspose_required)
+        else if (_B_pretranspose_required)
         {
             // Fixed format kernels need no pretranspose.
             ARM_COMPUTE_ERROR_ON(arm_compute::is_fixed_format(
@@ -610,6 +1034,18 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
                 _gemm_kernel_asm.get(), pretranspose.get(), in1_ptr, ldb, multi_stride_b,
                 NEScheduler::get().num_threads(), _B_pre_pretranspose_required && kernel_supports_transpose);
 
+            if (!cache_key.empty())
+            {
+                cache.store(cache_key, pretranspose.get()->buffer(), _pretranspose_info.total_size());
+            }
+            if (_cache_pretranspose)
+            {
+                // The auxiliary tensor is released at the end of prepare(), the kernels read the shared copy
+                _cached_pretranspose =
+                    cache.share(cache_key, pretranspose.get()->buffer(), _pretranspose_info.total_size());
+                _gemm_kernel_asm->set_pretransposed_B_data(const_cast<uint8_t *>(_cached_pretranspose.get()));
+            }
+
             b->mark_as_unused();
             // Note that we don't need to mark b_to_use as unused, as if it's been assigned to pre_pretransposed_b,
             // its memory will be auto-managed by the handler
@@ -736,44 +1172,39 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     }
 
     // The scheduling_hint needs to be compatible with the window exposed by arm_gemm
-    // The default case is when we split among the X dimension
-    IScheduler::Hints scheduling_hint = IScheduler::Hints(Window::DimX);
-    // If arm_gemm exposes a 2D window, perform 2D scheduling
-    if (_optimised_kernel->window().num_iterations(Window::DimY) > 1 &&
-        _optimised_kernel->window().num_iterations(Window::DimX) > 1)
-    {
-        scheduling_hint = IScheduler::Hints(IScheduler::split_dimensions_all);
-    }
-    // Split among Y
-    else if (_optimised_kernel->window().num_iterations(Window::DimY) > 1)
-    {
-        scheduling_hint = IScheduler::Hints(Window::DimY);
-    }
+    const IScheduler::Hints scheduling_hint = gemm_scheduling_hint(_optimised_kernel->window());
 
     // Set workspace if needed and reset number of threads as buffer manager gets re-created with max_threads
     CpuAuxTensorHandler workspace(offset_int_vec(AsmGemmWorkspace), _workspace_info, tensors, false);
     if (workspace.get()->buffer() != nullptr)
     {
         _gemm_kernel_asm->set_working_space(reinterpret_cast<void *>(workspace.get()->buffer()));
-        const unsigned int split_dim   = scheduling_hint.split_dimension();
-        const unsigned int window_size = _gemm_kernel_asm->get_window_size().total_size();
-        unsigned int       num_threads = NEScheduler::get().num_threads();
-        if (window_size < num_threads)
+        _gemm_kernel_asm->set_nthreads(num_gemm_threads(
+            _optimised_kernel->window(), _gemm_kernel_asm->get_window_size().total_size(), scheduling_hint));
+    }
+
+    // Prepare assembly kernel
+    prepare(tensors);
+
+    // A kernel recreated by update_shapes() after prepare() still has to be given the prepared B
+    if (_rebind_pretransposed_b)
+    {
+        if (c && c->info()->data_type() == DataType::S32)
         {
-            num_threads = window_size;
+            _gemm_kernel_asm->set_quantized_bias(
+                reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()), 0);
         }
-        if (split_dim != IScheduler::split_dimensions_all)
+        if (_B_pretranspose_required && _is_b_constant)
         {
-            // Make sure the kernel does not expect more threads than we can actually spawn
-            const unsigned int num_iterations = _optimised_kernel->window().num_iterations(split_dim);
-            num_threads                       = std::min(num_iterations, num_threads);
+            const ITensor *pretranspose = tensors.get_const_tensor(offset_int_vec(Pretranspose));
+            const uint8_t *b_pretransposed =
+                _cached_pretranspose != nullptr ? _cached_pretranspose.get() : pretranspose->buffer();
+            ARM_COMPUTE_ERROR_ON(b_pretransposed == nullptr);
+            _gemm_kernel_asm->set_pretransposed_B_data(const_cast<uint8_t *>(b_pretransposed));
         }
-        _gemm_kernel_asm->set_nthreads(num_threads);
+        _rebind_pretransposed_b = false;
     }
 
-    // Prepare assembly kernel
-    prepare(tensors);
-
     // Setup up matrix bias in the assembly kernel, it's just a pointer to matrix C.
     TypeOutput *bias = nullptr;
     if (c && c->info()->data_type() != DataType::S32)
@@ -1087,6 +1518,12 @@ Status CpuGemmAssemblyDispatch::validate(
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(a);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(info.reshape_b_only_on_first_run),
                                     "Assembly kernel will not be executed when reshape_b_only_on_first_run is false");
+    if (a->is_dynamic() || d->is_dynamic())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.method != AsmConvMethod::Im2Col,
+                                        "Dynamic shapes are only supported by the GEMM based method");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->is_dynamic(), "Dynamic shapes of B are not supported");
+    }
 
 #ifndef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->element_size() == 1, "8bit integer types only supported for aarch64");
@@ -1270,5 +1707,12 @@ void CpuGemmAssemblyDispatch::update_quantization_parameters(const GEMMLowpOutpu
     ARM_COMPUTE_ERROR_ON(_arm_gemm == nullptr);
     _arm_gemm->update_quantization_parameters(output_info, a, b, is_prepared, negated_offsets);
 }
+
+void CpuGemmAssemblyDispatch::update_shapes(const ITensorInfo *a, const ITensorInfo *d)
+{
+    ARM_COMPUTE_ERROR_ON(_arm_gemm == nullptr);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, d);
+    _arm_gemm->update_shapes(a, d);
+}
 } // namespace cpu
 } // namespace arm_compute
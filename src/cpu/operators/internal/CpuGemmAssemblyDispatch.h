@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -92,6 +92,7 @@ public:
                                                                                 const QuantizationInfo &,
                                                                                 const bool,
                                                                                 const bool) = 0;
+        virtual void update_shapes(const ITensorInfo *a, const ITensorInfo *d)              = 0;
         virtual ~IFallback()                                                                = default;
     };
 
@@ -197,6 +198,15 @@ public:
                                         const QuantizationInfo        &b,
                                         const bool                     is_prepared,
                                         const bool                     negated_offsets);
+    /** Update the shapes of a GEMM configured with dynamic shapes
+     *
+     * The assembly kernel picked at configure time is kept, so B is only prepared once.
+     * Only M and the number of batches are allowed to change.
+     *
+     * @param[in] a Input tensor info (Matrix A) with the new shape
+     * @param[in] d Output tensor info with the new shape
+     */
+    void update_shapes(const ITensorInfo *a, const ITensorInfo *d);
 
     // Inherited methods overridden:
     void                             prepare(ITensorPack &tensors) override;
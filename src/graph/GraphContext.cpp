@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,11 +27,13 @@
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/Utils.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
 {
-GraphContext::GraphContext() : _config(), _memory_managers(), _weights_managers()
+GraphContext::GraphContext() : _config(), _memory_managers(), _weights_managers(), _memory_footprint_recorder()
 {
 }
 
@@ -98,9 +100,21 @@ std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
     return _weights_managers;
 }
 
-void GraphContext::finalize()
+void GraphContext::set_memory_footprint_recorder(std::shared_ptr<MemoryFootprintRecorder> recorder)
+{
+    _memory_footprint_recorder = std::move(recorder);
+}
+
+MemoryFootprintRecorder *GraphContext::memory_footprint_recorder()
+{
+    return _memory_footprint_recorder.get();
+}
+
+void GraphContext::finalize(unsigned int num_concurrent_tasks)
 {
     const size_t num_pools = 1;
+    // Each function executed concurrently needs its own pool for its auxiliary memory
+    const size_t num_intra_pools = std::max<size_t>(num_pools, num_concurrent_tasks);
     for (auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
@@ -108,7 +122,7 @@ void GraphContext::finalize()
         // Finalize intra layer memory manager
         if (mm_obj.second.intra_mm != nullptr)
         {
-            mm_obj.second.intra_mm->populate(*mm_obj.second.allocator, num_pools);
+            mm_obj.second.intra_mm->populate(*mm_obj.second.allocator, num_intra_pools);
         }
         // Finalize cross layer memory manager
         if (mm_obj.second.cross_mm != nullptr)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,16 +29,80 @@
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/MemoryFootprint.h"
 #include "arm_compute/graph/PassManager.h"
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/PreparedWeightsCache.h"
+#include "arm_compute/runtime/TensorAllocator.h"
 
 #include "src/common/utils/Log.h"
+#include "src/graph/detail/BranchExecutor.h"
 
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+/** Set the allocator of the unmanaged tensors of the calling thread, and restore the previous one on destruction */
+class ScopedThreadAllocator final
+{
+public:
+    explicit ScopedThreadAllocator(IAllocator *allocator) : _previous(TensorAllocator::thread_allocator())
+    {
+        TensorAllocator::set_thread_allocator(allocator);
+    }
+    ~ScopedThreadAllocator()
+    {
+        TensorAllocator::set_thread_allocator(_previous);
+    }
+    ScopedThreadAllocator(const ScopedThreadAllocator &)            = delete;
+    ScopedThreadAllocator &operator=(const ScopedThreadAllocator &) = delete;
+
+private:
+    IAllocator *_previous;
+};
+
+/** Share the prepared weights between the operators configured in scope, and restore the setting on destruction */
+class ScopedWeightsSharing final
+{
+public:
+    explicit ScopedWeightsSharing(bool enable) : _previous(PreparedWeightsCache::get().is_sharing_enabled())
+    {
+        PreparedWeightsCache::get().set_sharing(_previous || enable);
+    }
+    ~ScopedWeightsSharing()
+    {
+        PreparedWeightsCache::get().set_sharing(_previous);
+    }
+    ScopedWeightsSharing(const ScopedWeightsSharing &)            = delete;
+    ScopedWeightsSharing &operator=(const ScopedWeightsSharing &) = delete;
+
+private:
+    bool _previous;
+};
+
+/** Run a workload on a batch size, and go back to the whole batch on destruction, even if the execution threw */
+class ScopedBatchSize final
+{
+public:
+    ScopedBatchSize(ExecutionWorkload &workload, unsigned int batch_size) : _workload(workload)
+    {
+        _workload.batch_size = batch_size;
+    }
+    ~ScopedBatchSize()
+    {
+        _workload.batch_size = 0;
+    }
+    ScopedBatchSize(const ScopedBatchSize &)            = delete;
+    ScopedBatchSize &operator=(const ScopedBatchSize &) = delete;
+
+private:
+    ExecutionWorkload &_workload;
+};
+} // namespace
+
 GraphManager::GraphManager() : _workloads()
 {
 }
@@ -92,10 +156,42 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Validate all nodes
     detail::validate_all_nodes(graph);
 
+    // Place the CPU tensors which aren't memory managed (weights and their transformed versions) on the NUMA node,
+    // or on huge pages
+    IAllocator *tensor_allocator = TensorAllocator::thread_allocator();
+    if (forced_target == Target::NEON && (ctx.config().numa_node >= 0 || ctx.config().use_huge_pages))
+    {
+        tensor_allocator = ctx.memory_management_ctx(Target::NEON)->allocator;
+    }
+
+    // Record the memory held by the functions of each node
+    if (ctx.config().record_memory_footprint)
+    {
+        auto recorder    = std::make_shared<MemoryFootprintRecorder>(tensor_allocator);
+        tensor_allocator = recorder->allocator();
+        ctx.set_memory_footprint_recorder(std::move(recorder));
+    }
+    const ScopedThreadAllocator scoped_allocator(tensor_allocator);
+
+    // The functions configured for each batch size prepare the same weights, they share a single copy of them
+    const ScopedWeightsSharing scoped_sharing(forced_target == Target::NEON && ctx.config().dynamic_batch);
+
     // Configure all nodes
     auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
 
+    // Group independent tasks to execute them concurrently
+    if (forced_target == Target::NEON)
+    {
+        detail::configure_execution_stages(graph, workload, ctx.config().max_concurrent_branches);
+    }
+
+    // Configure the nodes again for smaller batches
+    if (forced_target == Target::NEON && ctx.config().dynamic_batch)
+    {
+        detail::configure_batch_workloads(graph, ctx, workload, topological_sorted_nodes);
+    }
+
     // Allocate const tensors and call accessors
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
@@ -114,7 +210,7 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     }
 
     // Finalize Graph context
-    ctx.finalize();
+    ctx.finalize(workload.branch_executor != nullptr ? workload.branch_executor->num_lanes() : 1);
 
     // Register graph
     _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
@@ -148,6 +244,21 @@ void GraphManager::execute_graph(Graph &graph)
     }
 }
 
+void GraphManager::execute_graph(Graph &graph, unsigned int batch_size)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+    // The batch size comes from the application at run time: an unsupported one is rejected in release builds too
+    if (batch_size == 0 || batch_size > it->second.max_batch_size)
+    {
+        ARM_COMPUTE_ERROR_VAR("Batch size %u not supported by the graph configuration (1 to %u)!", batch_size,
+                              it->second.max_batch_size);
+    }
+
+    const ScopedBatchSize scoped_batch_size(it->second, batch_size);
+    execute_graph(graph);
+}
+
 void GraphManager::invalidate_graph(Graph &graph)
 {
     auto it = _workloads.find(graph.id());
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/MemoryFootprint.h"
+
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/runtime/IPoolManager.h"
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+#include "arm_compute/runtime/TrackingAllocator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Size of the objects managed by the function memory managers of a context */
+size_t function_managed_size(GraphContext &ctx)
+{
+    size_t size = 0;
+    for (auto &mm_ctx : ctx.memory_managers())
+    {
+        const auto &mm      = mm_ctx.second.intra_mm;
+        const auto *manager = mm != nullptr ? dynamic_cast<ISimpleLifetimeManager *>(mm->lifetime_manager()) : nullptr;
+        size += manager != nullptr ? manager->managed_size() : 0;
+    }
+    return size;
+}
+
+/** Memory of the pools of a memory manager */
+size_t pools_size(IMemoryManager *mm)
+{
+    const auto *manager = mm != nullptr ? dynamic_cast<ISimpleLifetimeManager *>(mm->lifetime_manager()) : nullptr;
+    return manager != nullptr ? manager->pool_size() * mm->pool_manager()->num_pools() : 0;
+}
+} // namespace
+
+size_t MemoryFootprint::total() const
+{
+    return activations + weights + padding + workspace + transformed_weights;
+}
+
+MemoryFootprint &MemoryFootprint::operator+=(const MemoryFootprint &other)
+{
+    activations += other.activations;
+    weights += other.weights;
+    padding += other.padding;
+    workspace += other.workspace;
+    transformed_weights += other.transformed_weights;
+    return *this;
+}
+
+MemoryFootprintRecorder::MemoryFootprintRecorder(IAllocator *allocator)
+    : _tracker(std::make_unique<TrackingAllocator>(allocator)), _workspaces(), _node(EmptyNodeID), _managed_size(0)
+{
+}
+
+MemoryFootprintRecorder::~MemoryFootprintRecorder() = default;
+
+IAllocator *MemoryFootprintRecorder::allocator()
+{
+    return _tracker.get();
+}
+
+void MemoryFootprintRecorder::begin_node(const INode &node, GraphContext &ctx)
+{
+    _node         = node.id();
+    _managed_size = function_managed_size(ctx);
+    _tracker->set_tag(_node);
+}
+
+void MemoryFootprintRecorder::end_node(GraphContext &ctx)
+{
+    const size_t managed_size = function_managed_size(ctx);
+    if (managed_size > _managed_size)
+    {
+        _workspaces[_node] += managed_size - _managed_size;
+    }
+    _node = EmptyNodeID;
+    _tracker->set_tag(TrackingAllocator::no_tag);
+}
+
+size_t MemoryFootprintRecorder::workspace(NodeID nid) const
+{
+    const auto it = _workspaces.find(nid);
+    return it != _workspaces.end() ? it->second : 0;
+}
+
+size_t MemoryFootprintRecorder::transformed_weights(NodeID nid) const
+{
+    return _tracker->bytes_held(nid);
+}
+
+GraphMemoryFootprint memory_footprint(const Graph &g, GraphContext &ctx)
+{
+    const MemoryFootprintRecorder *recorder = ctx.memory_footprint_recorder();
+
+    GraphMemoryFootprint footprint;
+    for (const auto &node : g.nodes())
+    {
+        if (node == nullptr)
+        {
+            continue;
+        }
+
+        NodeMemoryFootprint node_footprint;
+        node_footprint.id   = node->id();
+        node_footprint.type = node->type();
+        node_footprint.name = node->name();
+        for (size_t i = 0; i < node->num_outputs(); ++i)
+        {
+            Tensor *tensor = node->output(i);
+            if (tensor == nullptr)
+            {
+                continue;
+            }
+            ITensorHandle *handle = tensor->handle();
+            // The memory of sub-tensors is held by their parent
+            if (handle != nullptr && handle->is_subtensor())
+            {
+                continue;
+            }
+
+            const TensorDescriptor &desc  = tensor->desc();
+            const size_t            bytes = desc.shape.total_size() * element_size_from_data_type(desc.data_type);
+            if (node->type() == NodeType::Const)
+            {
+                // Weights which aren't used anymore have been released
+                if (handle != nullptr && !handle->tensor().is_used())
+                {
+                    continue;
+                }
+                node_footprint.footprint.weights += bytes;
+            }
+            else
+            {
+                node_footprint.footprint.activations += bytes;
+            }
+            if (handle != nullptr)
+            {
+                const size_t allocated = handle->tensor().info()->total_size();
+                node_footprint.footprint.padding += allocated > bytes ? allocated - bytes : 0;
+            }
+        }
+        if (recorder != nullptr)
+        {
+            node_footprint.footprint.workspace           = recorder->workspace(node->id());
+            node_footprint.footprint.transformed_weights = recorder->transformed_weights(node->id());
+        }
+
+        footprint.total += node_footprint.footprint;
+        footprint.nodes.push_back(std::move(node_footprint));
+    }
+
+    for (auto &mm_ctx : ctx.memory_managers())
+    {
+        footprint.transition_pools += pools_size(mm_ctx.second.cross_mm.get());
+        footprint.function_pools += pools_size(mm_ctx.second.intra_mm.get());
+    }
+    return footprint;
+}
+} // namespace graph
+} // namespace arm_compute
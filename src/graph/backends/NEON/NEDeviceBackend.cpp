@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,13 +34,18 @@
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/Tensor.h"
+#include "arm_compute/runtime/AffinityPoolManager.h"
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/ConsumeWeights.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/HugePageAllocator.h"
+#include "arm_compute/runtime/IntervalLifetimeManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
 #include "arm_compute/runtime/OffsetLifetimeManager.h"
-#include "arm_compute/runtime/PoolManager.h"
+#include "arm_compute/runtime/PreparedWeightsCache.h"
 #include "arm_compute/runtime/Scheduler.h"
 
 namespace arm_compute
@@ -69,21 +74,72 @@ void NEDeviceBackend::release_backend_context(GraphContext &ctx)
 
 void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
 {
-    // Set number of threads
-    if (ctx.config().num_threads >= 0)
+    const int numa_node = ctx.config().numa_node;
+
+    // Set number of threads, bound to the CPUs of the NUMA node if one is requested
+    if (numa_node >= 0 && Scheduler::get_type() == Scheduler::Type::CPP)
+    {
+        const unsigned int num_threads = ctx.config().num_threads > 0
+                                             ? static_cast<unsigned int>(ctx.config().num_threads)
+                                             : numa::node_cpus(numa_node).size();
+        Scheduler::get().set_num_threads_with_affinity(
+            num_threads, numa::make_bind_func(numa::BindPolicy::Compact, numa_node));
+    }
+    else if (ctx.config().num_threads >= 0)
     {
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
 
+    // Map the weights prepared by previous runs
+    if (!ctx.config().prepared_weights_cache.empty())
+    {
+        PreparedWeightsCache::get().set_directory(ctx.config().prepared_weights_cache);
+    }
+
+    // Free the original weights of the functions which transform them
+    if (ctx.config().consume_weights)
+    {
+        set_consume_weights(true);
+    }
+
+    // Time the kernels of the new GEMMs and keep the fastest ones in the tuning file
+    if (ctx.config().use_tuner)
+    {
+        NEGEMMTuner::get().set_tuning_file(ctx.config().cpu_tuner_file);
+        NEGEMMTuner::get().set_tune_new_kernels(true);
+    }
+
     // Create function level memory manager
     if (ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
+        const MemoryManagerAffinity affinity =
+            ctx.config().use_interval_memory_planner ? MemoryManagerAffinity::Interval : MemoryManagerAffinity::Offset;
+
         MemoryManagerContext mm_ctx;
         mm_ctx.target      = Target::NEON;
-        mm_ctx.intra_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
-        mm_ctx.cross_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
+        mm_ctx.intra_mm    = create_memory_manager(affinity);
+        mm_ctx.cross_mm    = create_memory_manager(affinity);
         mm_ctx.cross_group = std::make_shared<MemoryGroup>(mm_ctx.cross_mm);
         mm_ctx.allocator   = &_allocator;
+        if (numa_node >= 0)
+        {
+            // Memory pools are placed on the node of the threads using them, on huge pages if also requested
+            const bool use_huge_pages = ctx.config().use_huge_pages;
+            auto      &numa_allocator = _numa_allocators[std::make_pair(numa_node, use_huge_pages)];
+            if (numa_allocator == nullptr)
+            {
+                numa_allocator = std::make_unique<NumaAllocator>(numa_node, use_huge_pages);
+            }
+            mm_ctx.allocator = numa_allocator.get();
+        }
+        else if (ctx.config().use_huge_pages)
+        {
+            if (_huge_page_allocator == nullptr)
+            {
+                _huge_page_allocator = std::make_unique<HugePageAllocator>();
+            }
+            mm_ctx.allocator = _huge_page_allocator.get();
+        }
 
         ctx.insert_memory_management_ctx(std::move(mm_ctx));
     }
@@ -157,11 +213,16 @@ std::shared_ptr<arm_compute::IMemoryManager> NEDeviceBackend::create_memory_mana
     {
         lifetime_mgr = std::make_shared<BlobLifetimeManager>();
     }
+    else if (affinity == MemoryManagerAffinity::Interval)
+    {
+        lifetime_mgr = std::make_shared<IntervalLifetimeManager>();
+    }
     else
     {
         lifetime_mgr = std::make_shared<OffsetLifetimeManager>();
     }
-    auto pool_mgr = std::make_shared<PoolManager>();
+    // Graphs are executed over and over by the same threads: let each of them keep its pool without locking
+    auto pool_mgr = std::make_shared<AffinityPoolManager>();
     auto mm       = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
 
     return mm;
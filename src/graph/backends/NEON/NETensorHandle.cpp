@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,6 +43,11 @@ void NETensorHandle::allocate()
     _tensor.allocator()->allocate();
 }
 
+bool NETensorHandle::import_memory(void *memory)
+{
+    return bool(_tensor.allocator()->import_memory(memory));
+}
+
 void NETensorHandle::free()
 {
     _tensor.allocator()->free();
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/graph/detail/BranchExecutor.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+namespace
+{
+std::unique_ptr<IScheduler> create_lane_scheduler(unsigned int num_threads, bool pinned)
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    // Pinned lanes need a scheduler supporting affinity, even with a single thread
+    if (num_threads > 1 || pinned)
+    {
+        auto scheduler = std::make_unique<CPPScheduler>();
+        scheduler->set_num_threads(num_threads);
+        return scheduler;
+    }
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(num_threads, pinned);
+    return std::make_unique<SingleThreadScheduler>();
+}
+
+/** Run tasks with the given scheduler as the calling thread's scheduler
+ *
+ * @return The exception thrown by a task if any
+ */
+std::exception_ptr run_tasks(const std::vector<ExecutionTask *> &tasks, IScheduler &scheduler)
+{
+    std::exception_ptr exception = nullptr;
+    IScheduler        *previous  = Scheduler::get_thread_override();
+    Scheduler::set_thread_override(&scheduler);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        for (auto *task : tasks)
+        {
+            (*task)();
+        }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    Scheduler::set_thread_override(previous);
+    return exception;
+}
+} // namespace
+
+struct BranchExecutor::Lane
+{
+    /** Constructor
+     *
+     * @param[in] num_threads Number of threads of the lane's scheduler
+     * @param[in] own_thread  True if the lane runs its tasks on a dedicated thread, false to use the calling thread
+     * @param[in] bind_func   Binding function of the lane's threads. Can be nullptr to leave the threads unpinned.
+     */
+    Lane(unsigned int num_threads, bool own_thread, IScheduler::BindFunc bind_func)
+        : scheduler(create_lane_scheduler(num_threads, bind_func != nullptr)),
+          num_threads(num_threads),
+          bind_func(std::move(bind_func))
+    {
+        if (own_thread)
+        {
+            thread = std::thread(&Lane::worker_thread, this);
+        }
+        else
+        {
+            apply_affinity();
+        }
+    }
+    ~Lane()
+    {
+        if (thread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(m);
+                stop     = true;
+                has_work = true;
+            }
+            cv.notify_all();
+            thread.join();
+        }
+    }
+    void start()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m);
+            has_work = true;
+        }
+        cv.notify_all();
+    }
+    std::exception_ptr wait()
+    {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait(lock, [&] { return !has_work; });
+        return exception;
+    }
+    /** Pin the calling thread, which runs the lane's tasks, and the threads of the lane's scheduler */
+    void apply_affinity()
+    {
+#if ARM_COMPUTE_CPP_SCHEDULER
+        if (bind_func != nullptr)
+        {
+            scheduler->set_num_threads_with_affinity(num_threads, bind_func);
+        }
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+    }
+    void worker_thread()
+    {
+        apply_affinity();
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(m);
+            cv.wait(lock, [&] { return has_work; });
+            if (stop)
+            {
+                return;
+            }
+            exception = run_tasks(tasks, *scheduler);
+            has_work  = false;
+            lock.unlock();
+            cv.notify_all();
+        }
+    }
+
+    std::unique_ptr<IScheduler>  scheduler;
+    unsigned int                 num_threads;
+    IScheduler::BindFunc         bind_func;
+    std::vector<ExecutionTask *> tasks{};
+    std::exception_ptr           exception{nullptr};
+    std::thread                  thread{};
+    std::mutex                   m{};
+    std::condition_variable      cv{};
+    bool                         has_work{false};
+    bool                         stop{false};
+};
+
+BranchExecutor::BranchExecutor(unsigned int num_lanes, unsigned int num_threads, IScheduler::BindFunc bind_func)
+    : _lanes()
+{
+    ARM_COMPUTE_ERROR_ON(num_lanes == 0);
+    const unsigned int threads_per_lane = std::max(1U, num_threads / num_lanes);
+    for (unsigned int l = 0; l < num_lanes; ++l)
+    {
+        // Each lane binds its threads as the active scheduler binds its own share of the thread indices
+        IScheduler::BindFunc lane_bind_func = nullptr;
+        if (bind_func != nullptr)
+        {
+            const int first_thread = static_cast<int>(l * threads_per_lane);
+            lane_bind_func         = [bind_func, first_thread](int thread, int num_cores)
+            { return bind_func(first_thread + thread, num_cores); };
+        }
+        _lanes.emplace_back(std::make_unique<Lane>(threads_per_lane, l != 0, std::move(lane_bind_func)));
+    }
+}
+
+BranchExecutor::~BranchExecutor() = default;
+
+unsigned int BranchExecutor::num_lanes() const
+{
+    return _lanes.size();
+}
+
+void BranchExecutor::run(const std::vector<ExecutionTask *> &tasks)
+{
+    const unsigned int num_lanes =
+        std::min(static_cast<unsigned int>(_lanes.size()), static_cast<unsigned int>(tasks.size()));
+    if (num_lanes == 0)
+    {
+        return;
+    }
+
+    // Distribute the tasks round-robin among the lanes
+    for (unsigned int l = 0; l < num_lanes; ++l)
+    {
+        _lanes[l]->tasks.clear();
+    }
+    for (unsigned int t = 0; t < tasks.size(); ++t)
+    {
+        _lanes[t % num_lanes]->tasks.push_back(tasks[t]);
+    }
+
+    for (unsigned int l = 1; l < num_lanes; ++l)
+    {
+        _lanes[l]->start();
+    }
+    std::exception_ptr last_exception = run_tasks(_lanes[0]->tasks, *_lanes[0]->scheduler);
+    for (unsigned int l = 1; l < num_lanes; ++l)
+    {
+        std::exception_ptr exception = _lanes[l]->wait();
+        if (exception)
+        {
+            last_exception = exception;
+        }
+    }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    if (last_exception)
+    {
+        std::rethrow_exception(last_exception);
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
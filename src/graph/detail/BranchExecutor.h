@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_GRAPH_DETAIL_BRANCHEXECUTOR_H
+#define ACL_SRC_GRAPH_DETAIL_BRANCHEXECUTOR_H
+
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+struct ExecutionTask;
+
+namespace detail
+{
+/** Executes independent graph tasks concurrently
+ *
+ * The threads of the active scheduler are partitioned among a number of lanes. Each lane owns a scheduler with its
+ * share of the threads, which is used by the functions of the tasks it runs. The calling thread acts as the first
+ * lane while the other lanes are backed by dedicated threads.
+ */
+class BranchExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_lanes   Maximum number of tasks to run concurrently
+     * @param[in] num_threads Total number of threads to partition among the lanes
+     * @param[in] bind_func   (Optional) Binding function the threads of the active scheduler are pinned with. Each lane
+     *                        pins its threads to the cores of its own share of the thread indices.
+     */
+    BranchExecutor(unsigned int num_lanes, unsigned int num_threads, IScheduler::BindFunc bind_func = nullptr);
+    /** Prevent instances of this class from being copied */
+    BranchExecutor(const BranchExecutor &) = delete;
+    /** Prevent instances of this class from being copied */
+    BranchExecutor &operator=(const BranchExecutor &) = delete;
+    /** Destructor */
+    ~BranchExecutor();
+    /** Run a list of independent tasks concurrently and wait for all of them to complete
+     *
+     * @param[in] tasks Tasks to execute. They must not depend on each other.
+     */
+    void run(const std::vector<ExecutionTask *> &tasks);
+    /** Number of lanes of the executor
+     *
+     * @return Maximum number of tasks run concurrently
+     */
+    unsigned int num_lanes() const;
+
+private:
+    struct Lane;
+    std::vector<std::unique_ptr<Lane>> _lanes;
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_SRC_GRAPH_DETAIL_BRANCHEXECUTOR_H
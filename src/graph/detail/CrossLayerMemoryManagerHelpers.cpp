@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -180,6 +180,38 @@ void count_input_handles_per_target(const TaskHandles &task_handles, TargetHandl
     }
 }
 
+/** Merges the handles of the tasks executed concurrently in each stage
+ *
+ * The tensors of all the tasks of a stage are then considered in flight during the whole stage.
+ *
+ * @param[in] tasks_handles Tensor handles for each task
+ * @param[in] stages        Number of tasks in each stage
+ *
+ * @return Tensor handles for each stage
+ */
+std::vector<TaskHandles> merge_stage_handles(const std::vector<TaskHandles> &tasks_handles,
+                                             const std::vector<unsigned int> &stages)
+{
+    std::vector<TaskHandles> stages_handles;
+    stages_handles.reserve(stages.size());
+
+    auto task_handle_it = tasks_handles.begin();
+    for (const auto &stage_size : stages)
+    {
+        TaskHandles stage_handles;
+        for (unsigned int i = 0; i < stage_size; ++i, ++task_handle_it)
+        {
+            stage_handles.input_handles.insert(stage_handles.input_handles.end(), task_handle_it->input_handles.begin(),
+                                               task_handle_it->input_handles.end());
+            stage_handles.output_handles.insert(stage_handles.output_handles.end(),
+                                                task_handle_it->output_handles.begin(),
+                                                task_handle_it->output_handles.end());
+        }
+        stages_handles.push_back(std::move(stage_handles));
+    }
+    return stages_handles;
+}
+
 /** Calculates the lifetime of each tensor handle
  *
  * @param[in, out] tasks_handles Tensor handles for each task
@@ -252,6 +284,12 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
         count_input_handles_per_target(tasks_handles.back(), target_handle_count);
     }
 
+    // Tasks executed concurrently must not share memory: compute the lifetimes per stage instead of per task
+    if (!workload.stages.empty())
+    {
+        tasks_handles = merge_stage_handles(tasks_handles, workload.stages);
+    }
+
     // Setup memory managers
     for (auto &hc : target_handle_count)
     {
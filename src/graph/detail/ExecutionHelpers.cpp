@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,12 +23,22 @@
  */
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/MemoryFootprint.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/NumaAllocator.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include "src/graph/detail/BranchExecutor.h"
+
+#include <algorithm>
+#include <map>
 
 namespace arm_compute
 {
@@ -36,6 +46,125 @@ namespace graph
 {
 namespace detail
 {
+namespace
+{
+/** Returns the size of the outermost dimension of a tensor, which holds its batches */
+unsigned int outermost_dimension(Tensor &tensor)
+{
+    const TensorShape &shape = tensor.desc().shape;
+    return shape[std::max<size_t>(shape.num_dimensions(), 1U) - 1];
+}
+
+/** Checks whether a node moves data across the samples of a batch */
+bool mixes_samples(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::BoundingBoxTransformLayer:
+        case NodeType::DetectionOutputLayer:
+        case NodeType::DetectionPostProcessLayer:
+        case NodeType::GenerateProposalsLayer:
+        case NodeType::PermuteLayer:
+        case NodeType::PriorBoxLayer:
+        case NodeType::ROIAlignLayer:
+        case NodeType::StackLayer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Reorder tasks by stage, the tasks of a stage being independent from each other
+ *
+ * @param[in]     g     Graph the tasks were created from
+ * @param[in,out] tasks Tasks to reorder, the topological order is kept within a stage
+ *
+ * @return Number of tasks per stage
+ */
+std::vector<unsigned int> sort_tasks_by_stage(Graph &g, std::vector<ExecutionTask> &tasks)
+{
+    // Nodes without a task (e.g. sub-tensor based nodes) forward the stage of their inputs
+    std::vector<bool> has_task(g.nodes().size(), false);
+    for (auto &task : tasks)
+    {
+        has_task[task.node->id()] = true;
+    }
+
+    std::vector<int> node_stage(g.nodes().size(), -1);
+    for (auto &node_id : dfs(g))
+    {
+        const INode *node = g.node(node_id);
+        if (node == nullptr)
+        {
+            continue;
+        }
+        int stage = -1;
+        for (const auto &input_edge_id : node->input_edges())
+        {
+            const Edge *input_edge = g.edge(input_edge_id);
+            if (input_edge != nullptr && input_edge->producer() != nullptr)
+            {
+                stage = std::max(stage, node_stage[input_edge->producer_id()]);
+            }
+        }
+        node_stage[node_id] = has_task[node_id] ? stage + 1 : stage;
+    }
+
+    std::stable_sort(tasks.begin(), tasks.end(),
+                     [&](const ExecutionTask &a, const ExecutionTask &b)
+                     { return node_stage[a.node->id()] < node_stage[b.node->id()]; });
+
+    std::vector<unsigned int> stages;
+    int                       current_stage = -1;
+    for (auto &task : tasks)
+    {
+        if (node_stage[task.node->id()] != current_stage)
+        {
+            current_stage = node_stage[task.node->id()];
+            stages.push_back(0);
+        }
+        ++stages.back();
+    }
+    return stages;
+}
+
+/** Execute tasks, running the independent tasks of each stage concurrently if an executor is given
+ *
+ * @param[in] tasks    Tasks to execute, ordered by stage
+ * @param[in] stages   Number of tasks per stage, ignored without executor
+ * @param[in] executor Executor of the independent tasks, nullptr to run the tasks sequentially
+ */
+void run_tasks(std::vector<ExecutionTask> &tasks, const std::vector<unsigned int> &stages, BranchExecutor *executor)
+{
+    if (executor == nullptr)
+    {
+        for (auto &task : tasks)
+        {
+            task();
+        }
+        return;
+    }
+
+    std::vector<ExecutionTask *> stage_tasks;
+    auto                         task_it = tasks.begin();
+    for (const auto &stage_size : stages)
+    {
+        if (stage_size == 1)
+        {
+            (*task_it)();
+            ++task_it;
+            continue;
+        }
+        stage_tasks.clear();
+        for (unsigned int i = 0; i < stage_size; ++i, ++task_it)
+        {
+            stage_tasks.push_back(&*task_it);
+        }
+        executor->run(stage_tasks);
+    }
+}
+} // namespace
+
 void validate_all_nodes(Graph &g)
 {
     auto &nodes = g.nodes();
@@ -96,6 +225,25 @@ void allocate_all_output_tensors(INode &node)
     }
 }
 
+void import_or_allocate_all_output_tensors(INode &node)
+{
+    for (unsigned int i = 0; i < node.num_outputs(); ++i)
+    {
+        Tensor *tensor = node.output(i);
+        if (tensor != nullptr && !tensor->bound_edges().empty())
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(!tensor->handle(), "Tensor handle is not configured!");
+            ITensorAccessor *accessor = tensor->accessor();
+            void            *memory =
+                accessor != nullptr ? accessor->memory_to_import(*tensor->handle()->tensor().info()) : nullptr;
+            if (memory == nullptr || !tensor->handle()->import_memory(memory))
+            {
+                tensor->handle()->allocate();
+            }
+        }
+    }
+}
+
 void allocate_const_tensors(Graph &g)
 {
     for (auto &node : g.nodes())
@@ -105,6 +253,8 @@ void allocate_const_tensors(Graph &g)
             switch (node->type())
             {
                 case NodeType::Const:
+                    import_or_allocate_all_output_tensors(*node);
+                    break;
                 case NodeType::Input:
                     allocate_all_output_tensors(*node);
                     break;
@@ -140,15 +290,25 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
     // Reserve memory for tasks
     workload.tasks.reserve(node_order.size());
 
+    MemoryFootprintRecorder *recorder = ctx.memory_footprint_recorder();
+
     // Create tasks
     for (auto &node_id : node_order)
     {
         auto node = g.node(node_id);
         if (node != nullptr)
         {
+            if (recorder != nullptr)
+            {
+                recorder->begin_node(*node, ctx);
+            }
             Target                     assigned_target = node->assigned_target();
             backends::IDeviceBackend  &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
             std::unique_ptr<IFunction> func            = backend.configure_node(*node, ctx);
+            if (recorder != nullptr)
+            {
+                recorder->end_node(ctx);
+            }
             if (func != nullptr || is_utility_node(node))
             {
                 workload.tasks.emplace_back(ExecutionTask(std::move(func), node));
@@ -174,6 +334,137 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
     return workload;
 }
 
+void configure_execution_stages(Graph &g, ExecutionWorkload &workload, unsigned int max_concurrent_branches)
+{
+    if (max_concurrent_branches < 2 || workload.tasks.empty())
+    {
+        return;
+    }
+
+    std::vector<unsigned int> stages = sort_tasks_by_stage(g, workload.tasks);
+
+    // Concurrent execution is only worth it if some stages have independent tasks
+    const unsigned int widest_stage = *std::max_element(stages.begin(), stages.end());
+    if (widest_stage > 1)
+    {
+        // The lanes keep the threads on the NUMA node the backend binds the scheduler to
+        IScheduler::BindFunc bind_func = nullptr;
+        if (workload.ctx != nullptr && workload.ctx->config().numa_node >= 0 &&
+            Scheduler::get_type() == Scheduler::Type::CPP)
+        {
+            bind_func = numa::make_bind_func(numa::BindPolicy::Compact, workload.ctx->config().numa_node);
+        }
+
+        const unsigned int num_lanes = std::min(widest_stage, max_concurrent_branches);
+        workload.stages              = std::move(stages);
+        workload.branch_executor     = std::make_shared<BranchExecutor>(
+            num_lanes, std::max(1U, Scheduler::get().num_threads()), std::move(bind_func));
+    }
+}
+
+void configure_batch_workloads(Graph                     &g,
+                               GraphContext              &ctx,
+                               ExecutionWorkload         &workload,
+                               const std::vector<NodeID> &node_order)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(workload.inputs.empty(), "Graph has no inputs!");
+    workload.max_batch_size = outermost_dimension(*workload.inputs[0]);
+
+    // Computing the first samples of every tensor is only enough if each sample is computed independently, with the
+    // batch as the outermost dimension of all the non-constant tensors
+    std::vector<Tensor *> batched_tensors;
+    for (auto &node : g.nodes())
+    {
+        if (node == nullptr || node->type() == NodeType::Const)
+        {
+            continue;
+        }
+        if (mixes_samples(*node))
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Node " << node->id() << " mixes the samples of the batch, "
+                                               << "the graph always runs the whole batch" << std::endl);
+            return;
+        }
+        for (unsigned int i = 0; i < node->num_outputs(); ++i)
+        {
+            Tensor *tensor = node->output(i);
+            if (tensor == nullptr || tensor->bound_edges().empty() ||
+                std::find(batched_tensors.begin(), batched_tensors.end(), tensor) != batched_tensors.end())
+            {
+                continue;
+            }
+            if (outermost_dimension(*tensor) != workload.max_batch_size)
+            {
+                ARM_COMPUTE_LOG_GRAPH_INFO("Tensor " << tensor->id() << " doesn't hold the batch in its outermost "
+                                                     << "dimension, the graph always runs the whole batch"
+                                                     << std::endl);
+                return;
+            }
+            batched_tensors.push_back(tensor);
+        }
+    }
+
+    MemoryFootprintRecorder *recorder = ctx.memory_footprint_recorder();
+    for (unsigned int batch_size = 1; batch_size < workload.max_batch_size; batch_size *= 2)
+    {
+        BatchWorkload batch_workload;
+
+        // Swap the batched tensors for views of their first samples while the nodes are configured
+        std::vector<std::unique_ptr<ITensorHandle>> handles;
+        for (auto &tensor : batched_tensors)
+        {
+            TensorShape shape = tensor->desc().shape;
+            shape.set(shape.num_dimensions() - 1, batch_size);
+
+            const Target              target  = tensor->desc().target;
+            backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(target);
+            std::unique_ptr<ITensorHandle> view =
+                backend.create_subtensor(tensor->handle(), shape, Coordinates(), false);
+            ARM_COMPUTE_ERROR_ON_MSG(!view, "Couldn't create backend sub-tensor handle!");
+            handles.push_back(tensor->extract_handle());
+            tensor->set_handle(std::move(view));
+        }
+
+        batch_workload.tasks.reserve(workload.tasks.size());
+        for (auto &node_id : node_order)
+        {
+            auto node = g.node(node_id);
+            if (node == nullptr)
+            {
+                continue;
+            }
+            if (recorder != nullptr)
+            {
+                recorder->begin_node(*node, ctx);
+            }
+            Target                     assigned_target = node->assigned_target();
+            backends::IDeviceBackend  &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
+            std::unique_ptr<IFunction> func            = backend.configure_node(*node, ctx);
+            if (recorder != nullptr)
+            {
+                recorder->end_node(ctx);
+            }
+            if (func != nullptr)
+            {
+                batch_workload.tasks.emplace_back(ExecutionTask(std::move(func), node));
+            }
+        }
+
+        for (size_t i = 0; i < batched_tensors.size(); ++i)
+        {
+            batch_workload.handles.push_back(batched_tensors[i]->extract_handle());
+            batched_tensors[i]->set_handle(std::move(handles[i]));
+        }
+
+        // The independent tasks of the smaller batches run concurrently too
+        if (workload.branch_executor != nullptr)
+        {
+            batch_workload.stages = sort_tasks_by_stage(g, batch_workload.tasks);
+        }
+        workload.batch_workloads.emplace(batch_size, std::move(batch_workload));
+    }
+}
+
 void release_unused_tensors(Graph &g)
 {
     for (auto &tensor : g.tensors())
@@ -222,9 +513,66 @@ bool call_all_input_node_accessors(ExecutionWorkload &workload)
 void prepare_all_tasks(ExecutionWorkload &workload)
 {
     ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+    MemoryFootprintRecorder *recorder = workload.ctx != nullptr ? workload.ctx->memory_footprint_recorder() : nullptr;
+
+    // The tasks of the smaller batches share the constant tensors of the workload
+    std::vector<ExecutionTask *> tasks;
     for (auto &task : workload.tasks)
     {
-        task.prepare();
+        tasks.push_back(&task);
+    }
+    for (auto &batch_workload : workload.batch_workloads)
+    {
+        for (auto &task : batch_workload.second.tasks)
+        {
+            tasks.push_back(&task);
+        }
+    }
+
+    // Count the tasks left to prepare which read each tensor
+    std::map<Tensor *, unsigned int> pending_readers;
+    for (auto &task : tasks)
+    {
+        if (task->node != nullptr)
+        {
+            for (size_t i = 0; i < task->node->num_inputs(); ++i)
+            {
+                Tensor *tensor = task->node->input(i);
+                if (tensor != nullptr)
+                {
+                    ++pending_readers[tensor];
+                }
+            }
+        }
+    }
+
+    for (auto &task : tasks)
+    {
+        if (recorder != nullptr && task->node != nullptr)
+        {
+            recorder->begin_node(*task->node, *workload.ctx);
+            task->prepare();
+            recorder->end_node(*workload.ctx);
+        }
+        else
+        {
+            task->prepare();
+        }
+
+        // A function which consumed its inputs while preparing can't release them before the other tasks reading
+        // them are prepared too: the last one decides whether they are still used
+        if (task->node != nullptr)
+        {
+            for (size_t i = 0; i < task->node->num_inputs(); ++i)
+            {
+                Tensor *tensor = task->node->input(i);
+                if (tensor != nullptr && --pending_readers[tensor] > 0 && tensor->handle() != nullptr &&
+                    !tensor->handle()->tensor().is_used())
+                {
+                    tensor->handle()->tensor().mark_as_used();
+                }
+            }
+        }
         release_unused_tensors(*workload.graph);
     }
 }
@@ -242,10 +590,16 @@ void call_all_tasks(ExecutionWorkload &workload)
         }
     }
 
-    // Execute tasks
-    for (auto &task : workload.tasks)
+    // Execute tasks, on the smallest configured batch holding the one to run if any
+    const auto batch_workload = workload.batch_size != 0 ? workload.batch_workloads.lower_bound(workload.batch_size)
+                                                         : workload.batch_workloads.end();
+    if (batch_workload != workload.batch_workloads.end())
+    {
+        run_tasks(batch_workload->second.tasks, batch_workload->second.stages, workload.branch_executor.get());
+    }
+    else
     {
-        task();
+        run_tasks(workload.tasks, workload.stages, workload.branch_executor.get());
     }
 
     // Release memory for the transition buffers
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,6 +48,16 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+void Stream::run(unsigned int batch_size)
+{
+    _manager.execute_graph(_g, batch_size);
+}
+
+GraphContext &Stream::context()
+{
+    return _ctx;
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -77,6 +77,19 @@ bool output_edges_are_separate_tensors(Graph &g, const Edge *input_edge)
                        });
 }
 
+// Check if the function of the node supports in-place computation on its assigned target
+bool target_supports_in_place(const INode &node)
+{
+    switch (node.type())
+    {
+        // The CPU softmax kernels read each element of a row before overwriting it
+        case NodeType::SoftmaxLayer:
+            return node.assigned_target() == Target::NEON;
+        default:
+            return true;
+    }
+}
+
 // If do in-place calculation, then need to use the new output and inherit original output's accessor
 void set_new_output_and_inherit_accessor(std::unique_ptr<INode> &node, Tensor *orig_output, Tensor *new_output)
 {
@@ -226,6 +239,8 @@ void InPlaceOperationMutator::mutate(Graph &g)
                                          NodeType::BatchNormalizationLayer,
                                          NodeType::EltwiseLayer,
                                          NodeType::UnaryEltwiseLayer,
+                                         NodeType::PReluLayer,
+                                         NodeType::SoftmaxLayer,
                                          NodeType::DepthwiseConvolutionLayer,
                                          NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer,
                                          NodeType::PrintLayer};
@@ -233,7 +248,7 @@ void InPlaceOperationMutator::mutate(Graph &g)
     // Not interested in the order of nodes
     for (auto &node : g.nodes())
     {
-        if (node && in_place_nodes.find(node->type()) != std::end(in_place_nodes))
+        if (node && in_place_nodes.find(node->type()) != std::end(in_place_nodes) && target_supports_in_place(*node))
         {
             // Get input edge
             Edge *input_edge = node->input_edge(0);
@@ -241,7 +256,7 @@ void InPlaceOperationMutator::mutate(Graph &g)
             // Check if parent has a single output if yes then force in place calculation else not
             if ((input_edge != nullptr) && output_edges_are_separate_tensors(g, input_edge))
             {
-                if (node->type() == NodeType::EltwiseLayer)
+                if (node->type() == NodeType::EltwiseLayer || node->type() == NodeType::PReluLayer)
                 {
                     try_in_place_elementwise(node);
                 }
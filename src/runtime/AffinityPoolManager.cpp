@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/AffinityPoolManager.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <thread>
+
+namespace arm_compute
+{
+namespace
+{
+/** Number of attempts to lock a pool before blocking */
+constexpr unsigned int num_spin_attempts = 64;
+
+/** Get a token unique to the calling thread
+ *
+ * @return Address of a thread local variable
+ */
+uintptr_t thread_token()
+{
+#ifndef NO_MULTI_THREADING
+    static thread_local char token = 0;
+    return reinterpret_cast<uintptr_t>(&token);
+#else  /* NO_MULTI_THREADING */
+    return 1;
+#endif /* NO_MULTI_THREADING */
+}
+} // namespace
+
+IMemoryPool *AffinityPoolManager::try_lock_pool()
+{
+    const uintptr_t token = thread_token();
+
+    // Reclaim the pool used last by this thread
+    for (auto &slot : _slots)
+    {
+        bool expected = false;
+        if (slot->owner.load(std::memory_order_relaxed) == token &&
+            slot->occupied.compare_exchange_strong(expected, true, std::memory_order_seq_cst))
+        {
+            return slot->pool.get();
+        }
+    }
+
+    // Otherwise take any free pool, preferring the ones no thread has used yet
+    for (const bool allow_owned : {false, true})
+    {
+        for (auto &slot : _slots)
+        {
+            bool expected = false;
+            if ((allow_owned || slot->owner.load(std::memory_order_relaxed) == 0) &&
+                slot->occupied.compare_exchange_strong(expected, true, std::memory_order_seq_cst))
+            {
+                slot->owner.store(token, std::memory_order_relaxed);
+                return slot->pool.get();
+            }
+        }
+    }
+    return nullptr;
+}
+
+IMemoryPool *AffinityPoolManager::lock_pool()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_slots.empty(), "Haven't setup any pools!");
+
+    for (unsigned int i = 0; i < num_spin_attempts; ++i)
+    {
+        IMemoryPool *pool = try_lock_pool();
+        if (pool != nullptr)
+        {
+            return pool;
+        }
+#ifndef NO_MULTI_THREADING
+        std::this_thread::yield();
+#endif /* NO_MULTI_THREADING */
+    }
+
+#ifndef NO_MULTI_THREADING
+    // All the pools are occupied: block until one is unlocked.
+    // The waiter is registered before retrying so that unlock_pool() either frees a pool seen by the retry or sees the
+    // waiter and notifies it.
+    std::unique_lock<arm_compute::Mutex> lock(_mtx);
+    _num_waiters.fetch_add(1, std::memory_order_seq_cst);
+    IMemoryPool *pool = try_lock_pool();
+    while (pool == nullptr)
+    {
+        _cv.wait(lock);
+        pool = try_lock_pool();
+    }
+    _num_waiters.fetch_sub(1, std::memory_order_seq_cst);
+    return pool;
+#else  /* NO_MULTI_THREADING */
+    ARM_COMPUTE_ERROR("All the pools are occupied!");
+    return nullptr;
+#endif /* NO_MULTI_THREADING */
+}
+
+void AffinityPoolManager::unlock_pool(IMemoryPool *pool)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_slots.empty(), "Haven't setup any pools!");
+
+    for (auto &slot : _slots)
+    {
+        if (slot->pool.get() == pool)
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(!slot->occupied.load(std::memory_order_relaxed), "Pool is not locked!");
+            slot->occupied.store(false, std::memory_order_seq_cst);
+#ifndef NO_MULTI_THREADING
+            if (_num_waiters.load(std::memory_order_seq_cst) != 0)
+            {
+                arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+                _cv.notify_one();
+            }
+#endif /* NO_MULTI_THREADING */
+            return;
+        }
+    }
+    ARM_COMPUTE_ERROR("Pool to be unlocked couldn't be found!");
+}
+
+void AffinityPoolManager::register_pool(std::unique_ptr<IMemoryPool> pool)
+{
+    for (const auto &slot : _slots)
+    {
+        ARM_COMPUTE_UNUSED(slot);
+        ARM_COMPUTE_ERROR_ON_MSG(slot->occupied.load(), "All pools should be free in order to register a new one!");
+    }
+
+    auto slot  = std::make_unique<Slot>();
+    slot->pool = std::move(pool);
+    _slots.push_back(std::move(slot));
+}
+
+std::unique_ptr<IMemoryPool> AffinityPoolManager::release_pool()
+{
+    for (const auto &slot : _slots)
+    {
+        ARM_COMPUTE_UNUSED(slot);
+        ARM_COMPUTE_ERROR_ON_MSG(slot->occupied.load(), "All pools should be free in order to release one!");
+    }
+
+    if (!_slots.empty())
+    {
+        std::unique_ptr<IMemoryPool> pool = std::move(_slots.back()->pool);
+        _slots.pop_back();
+        return pool;
+    }
+
+    return nullptr;
+}
+
+void AffinityPoolManager::clear_pools()
+{
+    for (const auto &slot : _slots)
+    {
+        ARM_COMPUTE_UNUSED(slot);
+        ARM_COMPUTE_ERROR_ON_MSG(slot->occupied.load(),
+                                 "All pools should be free in order to clear the AffinityPoolManager!");
+    }
+    _slots.clear();
+}
+
+size_t AffinityPoolManager::num_pools() const
+{
+    return _slots.size();
+}
+} // namespace arm_compute
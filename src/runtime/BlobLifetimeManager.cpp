@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 #include <cmath>
 #include <iterator>
 #include <map>
+#include <numeric>
 
 namespace arm_compute
 {
@@ -44,6 +45,12 @@ const BlobLifetimeManager::info_type &BlobLifetimeManager::info() const
     return _blobs;
 }
 
+size_t BlobLifetimeManager::pool_size() const
+{
+    return std::accumulate(std::begin(_blobs), std::end(_blobs), size_t(0),
+                           [](size_t size, const BlobInfo &blob) { return size + blob.size; });
+}
+
 std::unique_ptr<IMemoryPool> BlobLifetimeManager::create_pool(IAllocator *allocator)
 {
     ARM_COMPUTE_ERROR_ON(allocator == nullptr);
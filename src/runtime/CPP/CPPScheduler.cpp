@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,12 +30,17 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/Utility.h"
 
+#include "src/common/cpuinfo/CpuModel.h"
 #include "support/Mutex.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdlib>
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <system_error>
@@ -74,6 +79,109 @@ private:
     const unsigned int _end;
 };
 
+/** Work-stealing feeder: each thread owns a deque of workload indices and steals from its peers once it is empty
+ *
+ * The workloads are split in contiguous chunks, one per thread, so that neighbouring windows are processed by
+ * the same thread. The owner pops from the front of its deque while idle threads steal from the back of the
+ * other threads' deques. Each deque is encoded as a single 64-bit atomic (front in the lower half, back in the
+ * upper half) so both operations are lock-free compare-and-swaps.
+ */
+class WorkStealingFeeder
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_threads   Number of threads taking part in the execution (one deque per thread)
+     * @param[in] num_workloads Number of workloads to distribute among the deques
+     */
+    WorkStealingFeeder(unsigned int num_threads, unsigned int num_workloads) : _deques(num_threads)
+    {
+        for (unsigned int t = 0; t < num_threads; ++t)
+        {
+            const uint64_t front = static_cast<uint64_t>(t) * num_workloads / num_threads;
+            const uint64_t back  = static_cast<uint64_t>(t + 1) * num_workloads / num_threads;
+            _deques[t].range.store(pack(front, back), std::memory_order_relaxed);
+        }
+    }
+    /** Return the next element of the thread's own deque, or steal one from another thread if it is empty.
+     *
+     * @param[in]  thread_id Id of the calling thread
+     * @param[out] next      Will contain the next element if there is one.
+     *
+     * @return False if all the deques are empty and next wasn't set.
+     */
+    bool get_next(unsigned int thread_id, unsigned int &next)
+    {
+        ARM_COMPUTE_ERROR_ON(thread_id >= _deques.size());
+        if (pop_front(thread_id, next))
+        {
+            return true;
+        }
+        const unsigned int num_deques = _deques.size();
+        for (unsigned int i = 1; i < num_deques; ++i)
+        {
+            if (steal_back((thread_id + i) % num_deques, next))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    /** Deque of workload indices padded to a cache line to avoid false sharing between threads */
+    struct ChunkDeque
+    {
+        std::atomic<uint64_t> range{0};
+        char                  padding[64 - sizeof(std::atomic<uint64_t>)]{};
+    };
+
+    static uint64_t pack(uint64_t front, uint64_t back)
+    {
+        return (back << 32) | front;
+    }
+    bool pop_front(unsigned int deque_id, unsigned int &next)
+    {
+        auto    &range = _deques[deque_id].range;
+        uint64_t value = range.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const uint64_t front = value & 0xFFFFFFFFu;
+            const uint64_t back  = value >> 32;
+            if (front >= back)
+            {
+                return false;
+            }
+            if (range.compare_exchange_weak(value, pack(front + 1, back), std::memory_order_relaxed))
+            {
+                next = static_cast<unsigned int>(front);
+                return true;
+            }
+        }
+    }
+    bool steal_back(unsigned int deque_id, unsigned int &next)
+    {
+        auto    &range = _deques[deque_id].range;
+        uint64_t value = range.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const uint64_t front = value & 0xFFFFFFFFu;
+            const uint64_t back  = value >> 32;
+            if (front >= back)
+            {
+                return false;
+            }
+            if (range.compare_exchange_weak(value, pack(front, back - 1), std::memory_order_relaxed))
+            {
+                next = static_cast<unsigned int>(back - 1);
+                return true;
+            }
+        }
+    }
+
+    std::vector<ChunkDeque> _deques;
+};
+
 /** Execute workloads[info.thread_id] first, then call the feeder to get the index of the next workload to run.
  *
  * Will run workloads until the feeder reaches the end of its range.
@@ -92,6 +200,86 @@ void process_workloads(std::vector<IScheduler::Workload> &workloads, ThreadFeede
     } while (feeder.get_next(workload_index));
 }
 
+/** Execute the workloads of the thread's own deque, then steal workloads from the other threads until all the
+ * deques are empty.
+ *
+ * @param[in]     workloads The array of workloads
+ * @param[in,out] feeder    The work-stealing feeder indicating which workload to execute next.
+ * @param[in]     info      Threading and CPU info.
+ */
+void process_workloads(std::vector<IScheduler::Workload> &workloads, WorkStealingFeeder &feeder, const ThreadInfo &info)
+{
+    unsigned int workload_index = 0;
+    while (feeder.get_next(info.thread_id, workload_index))
+    {
+        ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
+        workloads[workload_index](info);
+    }
+}
+
+/** Hint the core that the current thread is busy-waiting */
+inline void cpu_relax()
+{
+#if defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::: "memory");
+#elif defined(__x86_64__) || defined(__i386__)
+    __asm__ __volatile__("pause" ::: "memory");
+#endif /* defined(__aarch64__) || defined(__arm__) */
+}
+
+/** Current time of the steady clock in nanoseconds */
+inline int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/** Busy-wait until a condition is met or a time budget has elapsed
+ *
+ * The delay between two polls of the condition grows exponentially up to max_backoff relax iterations, after which
+ * the thread yields between polls.
+ *
+ * @param[in] condition        Condition to poll
+ * @param[in] spin_duration_us Time budget in microseconds. If 0 the condition is only checked once.
+ * @param[in] max_backoff      Maximum number of relax iterations between two polls
+ *
+ * @return True if the condition was met within the time budget
+ */
+template <typename Condition>
+bool spin_wait(Condition &&condition, unsigned int spin_duration_us, unsigned int max_backoff)
+{
+    if (condition())
+    {
+        return true;
+    }
+    if (spin_duration_us == 0)
+    {
+        return false;
+    }
+    const int64_t deadline = now_ns() + static_cast<int64_t>(spin_duration_us) * 1000;
+    unsigned int  backoff  = 1;
+    while (!condition())
+    {
+        if (now_ns() > deadline)
+        {
+            return false;
+        }
+        if (backoff >= max_backoff)
+        {
+            // Backoff saturated: give the core away in case it is oversubscribed
+            std::this_thread::yield();
+            continue;
+        }
+        for (unsigned int i = 0; i < backoff; ++i)
+        {
+            cpu_relax();
+        }
+        backoff *= 2;
+    }
+    return true;
+}
+
 /** Set thread affinity. Pin current thread to a particular core
  *
  * @param[in] core_id ID of the core to which the current thread is pinned
@@ -111,7 +299,7 @@ void set_thread_affinity(int core_id)
 #endif /* !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) */
 }
 
-/** There are currently 2 scheduling modes supported by CPPScheduler
+/** There are currently 3 scheduling modes supported by CPPScheduler
  *
  * Linear:
  *  The default mode where all the scheduling is carried out by the main thread linearly (in a loop).
@@ -136,6 +324,12 @@ void set_thread_affinity(int core_id)
  *  1. Main thread wakes FanoutThread 0, 1
  *  2. FanoutThread 0 wakes FanoutThread 2, 3, 4
  *  3. FanoutThread 1 wakes FanoutThread 5, 6
+ *
+ * Steal:
+ *  The threads are woken up as in the linear mode, but instead of pulling workloads from a single shared counter
+ *  each thread owns a deque seeded with a contiguous chunk of the workloads. Once a thread has drained its own
+ *  deque it steals workloads from the back of its peers' deques, so a slow core only delays the workloads it has
+ *  actually started. This mode is only selected when explicitly requested.
  */
 
 class Thread final
@@ -160,6 +354,10 @@ public:
     /** Set workloads */
     void set_workload(std::vector<IScheduler::Workload> *workloads, ThreadFeeder &feeder, const ThreadInfo &info);
 
+    /** Set workloads to be distributed through a work-stealing feeder */
+    void
+    set_workload(std::vector<IScheduler::Workload> *workloads, WorkStealingFeeder &feeder, const ThreadInfo &info);
+
     /** Request the worker thread to start executing workloads.
      *
      * The thread will start by executing workloads[info.thread_id] and will then call the feeder to
@@ -176,6 +374,29 @@ public:
     /** Function ran by the worker thread. */
     void worker_thread();
 
+    /** Set the time the thread busy-waits for new work (and the main thread for its completion) before sleeping
+     *
+     * @param[in] spin_duration_us Time budget in microseconds. 0 disables busy-waiting.
+     * @param[in] max_backoff      Maximum number of relax iterations between two polls
+     */
+    void set_spin_wait(unsigned int spin_duration_us, unsigned int max_backoff)
+    {
+        _spin_duration_us.store(spin_duration_us, std::memory_order_relaxed);
+        _max_backoff.store(max_backoff, std::memory_order_relaxed);
+    }
+
+    /** Enable the recording of the time at which the thread picks up its job */
+    void set_record_wake_time(bool record)
+    {
+        _record_wake_time.store(record, std::memory_order_relaxed);
+    }
+
+    /** Time in nanoseconds at which the thread picked up its last job (Only valid after wait() returned) */
+    int64_t wake_time_ns() const
+    {
+        return _wake_time_ns;
+    }
+
     /** Set the scheduling strategy to be linear */
     void set_linear_mode()
     {
@@ -197,10 +418,15 @@ private:
     ThreadInfo                         _info{};
     std::vector<IScheduler::Workload> *_workloads{nullptr};
     ThreadFeeder                      *_feeder{nullptr};
+    WorkStealingFeeder                *_stealing_feeder{nullptr};
     std::mutex                         _m{};
     std::condition_variable            _cv{};
-    bool                               _wait_for_work{false};
-    bool                               _job_complete{true};
+    std::atomic<bool>                  _wait_for_work{false};
+    std::atomic<bool>                  _job_complete{true};
+    std::atomic<unsigned int>          _spin_duration_us{0};
+    std::atomic<unsigned int>          _max_backoff{0};
+    std::atomic<bool>                  _record_wake_time{false};
+    int64_t                            _wake_time_ns{0};
     std::exception_ptr                 _current_exception{nullptr};
     int                                _core_pin{-1};
     std::list<Thread>                 *_thread_pool{nullptr};
@@ -227,9 +453,20 @@ Thread::~Thread()
 
 void Thread::set_workload(std::vector<IScheduler::Workload> *workloads, ThreadFeeder &feeder, const ThreadInfo &info)
 {
-    _workloads = workloads;
-    _feeder    = &feeder;
-    _info      = info;
+    _workloads       = workloads;
+    _feeder          = &feeder;
+    _stealing_feeder = nullptr;
+    _info            = info;
+}
+
+void Thread::set_workload(std::vector<IScheduler::Workload> *workloads,
+                          WorkStealingFeeder                &feeder,
+                          const ThreadInfo                  &info)
+{
+    _workloads       = workloads;
+    _feeder          = nullptr;
+    _stealing_feeder = &feeder;
+    _info            = info;
 }
 
 void Thread::start()
@@ -244,9 +481,14 @@ void Thread::start()
 
 std::exception_ptr Thread::wait()
 {
+    // Poll for completion first so that short jobs don't put the main thread to sleep
+    const bool completed = spin_wait([&] { return _job_complete.load(std::memory_order_acquire); },
+                                     _spin_duration_us.load(std::memory_order_relaxed),
+                                     _max_backoff.load(std::memory_order_relaxed));
+    if (!completed)
     {
         std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _job_complete; });
+        _cv.wait(lock, [&] { return _job_complete.load(); });
     }
     return _current_exception;
 }
@@ -257,14 +499,23 @@ void Thread::worker_thread()
 
     while (true)
     {
+        // Poll for new work for a bounded time before going to sleep: back-to-back jobs are then picked up without
+        // going through the kernel scheduler. The lock is still taken below to synchronise with set_workload().
+        spin_wait([&] { return _wait_for_work.load(std::memory_order_acquire); },
+                  _spin_duration_us.load(std::memory_order_relaxed), _max_backoff.load(std::memory_order_relaxed));
+
         std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _wait_for_work; });
+        _cv.wait(lock, [&] { return _wait_for_work.load(); });
         _wait_for_work = false;
+        if (_record_wake_time.load(std::memory_order_relaxed))
+        {
+            _wake_time_ns = now_ns();
+        }
 
         _current_exception = nullptr;
 
         // Exit if the worker thread has not been fed with workloads
-        if (_workloads == nullptr || _feeder == nullptr)
+        if (_workloads == nullptr || (_feeder == nullptr && _stealing_feeder == nullptr))
         {
             return;
         }
@@ -285,7 +536,14 @@ void Thread::worker_thread()
         try
         {
 #endif /* ARM_COMPUTE_EXCEPTIONS_ENABLED */
-            process_workloads(*_workloads, *_feeder, _info);
+            if (_stealing_feeder != nullptr)
+            {
+                process_workloads(*_workloads, *_stealing_feeder, _info);
+            }
+            else
+            {
+                process_workloads(*_workloads, *_feeder, _info);
+            }
 
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
         }
@@ -305,16 +563,19 @@ void Thread::worker_thread()
 struct CPPScheduler::Impl final
 {
     constexpr static unsigned int m_default_wake_fanout = 4;
+    constexpr static unsigned int m_default_max_backoff = 64;
     enum class Mode
     {
         Linear,
-        Fanout
+        Fanout,
+        Steal
     };
     enum class ModeToggle
     {
         None,
         Linear,
-        Fanout
+        Fanout,
+        Steal
     };
     explicit Impl(unsigned int thread_hint)
         : _num_threads(thread_hint), _threads(_num_threads - 1), _mode(Mode::Linear), _wake_fanout(0U)
@@ -328,36 +589,115 @@ struct CPPScheduler::Impl final
         {
             _forced_mode = ModeToggle::Fanout;
         }
+        else if (mode_env_v == "steal")
+        {
+            _forced_mode = ModeToggle::Steal;
+        }
         else
         {
             _forced_mode = ModeToggle::None;
         }
+
+        const auto spin_env_v = utility::getenv("ARM_COMPUTE_CPP_SCHEDULER_SPIN_US");
+        if (!spin_env_v.empty())
+        {
+            _spin_wait_config.spin_duration_us =
+                static_cast<unsigned int>(std::strtoul(spin_env_v.c_str(), nullptr, 10));
+        }
+        apply_thread_config();
+    }
+    void apply_thread_config()
+    {
+        for (auto &thread : _threads)
+        {
+            thread.set_spin_wait(_spin_wait_config.spin_duration_us, _spin_wait_config.max_backoff);
+            thread.set_record_wake_time(_collect_dispatch_stats);
+        }
     }
     void set_num_threads(unsigned int num_threads, unsigned int thread_hint)
     {
         _num_threads = num_threads == 0 ? thread_hint : num_threads;
         _threads.resize(_num_threads - 1);
+        _thread_cores.assign(_num_threads, -1);
+        apply_thread_config();
+        update_thread_capacities();
         auto_switch_mode(_num_threads);
     }
     void set_num_threads_with_affinity(unsigned int num_threads, unsigned int thread_hint, BindFunc func)
     {
         _num_threads = num_threads == 0 ? thread_hint : num_threads;
+        _thread_cores.assign(_num_threads, -1);
 
-        // Set affinity on main thread
-        set_thread_affinity(func(0, thread_hint));
+        // Set affinity on main thread, which runs with the last thread id
+        _thread_cores[_num_threads - 1] = func(0, thread_hint);
+        set_thread_affinity(_thread_cores[_num_threads - 1]);
 
         // Set affinity on worked threads
         _threads.clear();
         for (auto i = 1U; i < _num_threads; ++i)
         {
-            _threads.emplace_back(func(i, thread_hint));
+            _thread_cores[i - 1] = func(i, thread_hint);
+            _threads.emplace_back(_thread_cores[i - 1]);
         }
+        apply_thread_config();
+        update_thread_capacities();
         auto_switch_mode(_num_threads);
     }
+    /** Compute the capacity of each thread from the type of the core it is pinned to
+     *
+     * Threads which are not pinned get the average capacity of the pinned ones. The capacities are left empty when
+     * the split should not be weighted, i.e. the threads aren't pinned or all run on equivalent cores.
+     */
+    void update_thread_capacities()
+    {
+        // Published as an immutable snapshot so that schedule() reads it without locking or copying
+        std::atomic_store(&_thread_capacities, std::shared_ptr<const std::vector<float>>());
+        if (!_capacity_weighted_split)
+        {
+            return;
+        }
+
+        std::vector<float> capacities(_thread_cores.size(), 0.f);
+        float              total_pinned = 0.f;
+        unsigned int       num_pinned   = 0;
+        for (size_t t = 0; t < _thread_cores.size(); ++t)
+        {
+            if (_thread_cores[t] >= 0)
+            {
+                const CPUModel model = CPUInfo::get().get_cpu_model(_thread_cores[t]);
+                const auto     it    = _core_capacities.find(model);
+                capacities[t]        = it != _core_capacities.end() ? it->second : cpuinfo::model_capacity(model);
+                total_pinned += capacities[t];
+                ++num_pinned;
+            }
+        }
+        if (num_pinned == 0)
+        {
+            return;
+        }
+        for (auto &capacity : capacities)
+        {
+            capacity = capacity > 0.f ? capacity : total_pinned / num_pinned;
+        }
+
+        const auto minmax = std::minmax_element(capacities.begin(), capacities.end());
+        if (*minmax.first != *minmax.second)
+        {
+            std::atomic_store(&_thread_capacities,
+                              std::shared_ptr<const std::vector<float>>(
+                                  std::make_shared<const std::vector<float>>(std::move(capacities))));
+        }
+    }
     void auto_switch_mode(unsigned int num_threads_to_use)
     {
         // If the environment variable is set to any of the modes, it overwrites the mode selected over num_threads_to_use
-        if (_forced_mode == ModeToggle::Fanout || (_forced_mode == ModeToggle::None && num_threads_to_use > 8))
+        if (_forced_mode == ModeToggle::Steal)
+        {
+            set_steal_mode();
+            ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Set CPPScheduler to Steal mode, with %d threads to use\n",
+                                                      num_threads_to_use);
+        }
+        else if (_forced_mode == ModeToggle::Fanout || (_forced_mode == ModeToggle::None && num_threads_to_use > 8))
         {
             set_fanout_mode(m_default_wake_fanout, num_threads_to_use);
             ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE(
@@ -380,6 +720,16 @@ struct CPPScheduler::Impl final
         _mode        = Mode::Linear;
         _wake_fanout = 0U;
     }
+    void set_steal_mode()
+    {
+        // Threads are woken up linearly by the main thread
+        for (auto &thread : _threads)
+        {
+            thread.set_linear_mode();
+        }
+        _mode        = Mode::Steal;
+        _wake_fanout = 0U;
+    }
     void set_fanout_mode(unsigned int wake_fanout, unsigned int num_threads_to_use)
     {
         ARM_COMPUTE_ERROR_ON(num_threads_to_use > _threads.size() + 1);
@@ -421,6 +771,15 @@ struct CPPScheduler::Impl final
     Mode               _mode{Mode::Linear};
     ModeToggle         _forced_mode{ModeToggle::None};
     unsigned int       _wake_fanout{0};
+
+    SpinWaitConfig _spin_wait_config{0U, m_default_max_backoff};
+    bool           _collect_dispatch_stats{false};
+    DispatchStats  _dispatch_stats{};
+
+    std::vector<int>                          _thread_cores{std::vector<int>(_num_threads, -1)};
+    bool                                      _capacity_weighted_split{true};
+    std::map<CPUModel, float>                 _core_capacities{};
+    std::shared_ptr<const std::vector<float>> _thread_capacities{};
 };
 
 /*
@@ -436,7 +795,11 @@ CPPScheduler::CPPScheduler() : _impl(std::make_unique<Impl>(num_threads_hint()))
 {
 }
 
-CPPScheduler::~CPPScheduler() = default;
+CPPScheduler::~CPPScheduler()
+{
+    // Asynchronous kernels must not outlive the thread pool
+    sync();
+}
 
 void CPPScheduler::set_num_threads(unsigned int num_threads)
 {
@@ -457,6 +820,81 @@ unsigned int CPPScheduler::num_threads() const
     return _impl->num_threads();
 }
 
+void CPPScheduler::set_scheduling_mode(SchedulingMode mode)
+{
+    // No changes in the scheduling mode while current workloads are running
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    switch (mode)
+    {
+        case SchedulingMode::Linear:
+            _impl->_forced_mode = Impl::ModeToggle::Linear;
+            break;
+        case SchedulingMode::Fanout:
+            _impl->_forced_mode = Impl::ModeToggle::Fanout;
+            break;
+        case SchedulingMode::Steal:
+            _impl->_forced_mode = Impl::ModeToggle::Steal;
+            break;
+        case SchedulingMode::Auto:
+        default:
+            _impl->_forced_mode = Impl::ModeToggle::None;
+            break;
+    }
+    _impl->auto_switch_mode(_impl->num_threads());
+}
+
+void CPPScheduler::set_spin_wait(const SpinWaitConfig &config)
+{
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->_spin_wait_config = config;
+    _impl->apply_thread_config();
+}
+
+CPPScheduler::SpinWaitConfig CPPScheduler::spin_wait_config() const
+{
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    return _impl->_spin_wait_config;
+}
+
+void CPPScheduler::set_dispatch_stats_enabled(bool enable)
+{
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->_collect_dispatch_stats = enable;
+    _impl->apply_thread_config();
+}
+
+CPPScheduler::DispatchStats CPPScheduler::dispatch_stats() const
+{
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    return _impl->_dispatch_stats;
+}
+
+void CPPScheduler::reset_dispatch_stats()
+{
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->_dispatch_stats = DispatchStats{};
+}
+
+void CPPScheduler::set_capacity_weighted_split(bool enable)
+{
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->_capacity_weighted_split = enable;
+    _impl->update_thread_capacities();
+}
+
+void CPPScheduler::set_core_capacity(CPUModel model, float capacity)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(capacity <= 0.f, "The capacity of a core must be positive");
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->_core_capacities[model] = capacity;
+    _impl->update_thread_capacities();
+}
+
+std::shared_ptr<const std::vector<float>> CPPScheduler::thread_capacities() const
+{
+    return std::atomic_load(&_impl->_thread_capacities);
+}
+
 #ifndef DOXYGEN_SKIP_THIS
 void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
 {
@@ -480,6 +918,7 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
             num_threads_to_start = static_cast<int>(_impl->wake_fanout()) - 1;
             break;
         }
+        case CPPScheduler::Impl::Mode::Steal:
         case CPPScheduler::Impl::Mode::Linear:
         default:
         {
@@ -487,8 +926,10 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
             break;
         }
     }
-    ThreadFeeder feeder(num_threads_to_use, workloads.size());
-    ThreadInfo   info;
+    const bool         use_stealing = _impl->mode() == CPPScheduler::Impl::Mode::Steal;
+    ThreadFeeder       feeder(num_threads_to_use, workloads.size());
+    WorkStealingFeeder stealing_feeder(use_stealing ? num_threads_to_use : 0U, workloads.size());
+    ThreadInfo         info;
     info.cpu_info          = &cpu_info();
     info.num_threads       = num_threads_to_use;
     unsigned int t         = 0;
@@ -497,9 +938,17 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
     for (; t < num_threads_to_use - 1; ++t, ++thread_it)
     {
         info.thread_id = t;
-        thread_it->set_workload(&workloads, feeder, info);
+        if (use_stealing)
+        {
+            thread_it->set_workload(&workloads, stealing_feeder, info);
+        }
+        else
+        {
+            thread_it->set_workload(&workloads, feeder, info);
+        }
     }
-    thread_it = _impl->_threads.begin();
+    const int64_t dispatch_start_ns = _impl->_collect_dispatch_stats ? now_ns() : 0;
+    thread_it                       = _impl->_threads.begin();
     for (int i = 0; i < num_threads_to_start; ++i, ++thread_it)
     {
         thread_it->start();
@@ -509,8 +958,16 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
     try
     {
-#endif                                              /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
-        process_workloads(workloads, feeder, info); // Main thread processes workloads
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        // Main thread processes workloads
+        if (use_stealing)
+        {
+            process_workloads(workloads, stealing_feeder, info);
+        }
+        else
+        {
+            process_workloads(workloads, feeder, info);
+        }
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
     }
     catch (...)
@@ -530,6 +987,21 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
                 last_exception = current_exception;
             }
         }
+        if (_impl->_collect_dispatch_stats && num_threads_to_use > 1)
+        {
+            // The dispatch latency is the time it took for the last worker thread to pick up its job
+            int64_t last_wake_ns = dispatch_start_ns;
+            thread_it            = _impl->_threads.begin();
+            for (unsigned int i = 0; i < num_threads_to_use - 1; ++i, ++thread_it)
+            {
+                last_wake_ns = std::max(last_wake_ns, thread_it->wake_time_ns());
+            }
+            const auto latency_ns = static_cast<uint64_t>(last_wake_ns - dispatch_start_ns);
+            auto      &stats      = _impl->_dispatch_stats;
+            ++stats.num_dispatches;
+            stats.total_latency_ns += latency_ns;
+            stats.max_latency_ns = std::max(stats.max_latency_ns, latency_ns);
+        }
         if (last_exception)
         {
             std::rethrow_exception(last_exception);
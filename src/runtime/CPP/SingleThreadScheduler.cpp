@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,8 +27,16 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
 
+#include "src/runtime/SchedulerUtils.h"
+
 namespace arm_compute
 {
+SingleThreadScheduler::~SingleThreadScheduler()
+{
+    // Asynchronous kernels must not outlive the scheduler
+    sync();
+}
+
 void SingleThreadScheduler::set_num_threads(unsigned int num_threads)
 {
     ARM_COMPUTE_UNUSED(num_threads);
@@ -48,6 +56,8 @@ void SingleThreadScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
         }
     }
 
+    scheduler_utils::ScopedKernelTrace trace(this, *kernel, max_window);
+
     ThreadInfo info;
     info.cpu_info = &cpu_info();
     kernel->run(kernel->window(), info);
@@ -59,6 +69,8 @@ void SingleThreadScheduler::schedule_op(ICPPKernel   *kernel,
                                         ITensorPack  &tensors)
 {
     ARM_COMPUTE_UNUSED(hints);
+    scheduler_utils::ScopedKernelTrace trace(this, *kernel, window);
+
     ThreadInfo info;
     info.cpu_info = &cpu_info();
     kernel->run_op(tensors, window, info);
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/ConsumeWeights.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <atomic>
+
+namespace arm_compute
+{
+namespace
+{
+std::atomic<bool> &consume_weights_flag()
+{
+    static std::atomic<bool> flag{utility::getenv("ARM_COMPUTE_CONSUME_WEIGHTS") == "1"};
+    return flag;
+}
+} // namespace
+
+void set_consume_weights(bool consume)
+{
+    consume_weights_flag().store(consume, std::memory_order_relaxed);
+}
+
+bool consume_weights()
+{
+    return consume_weights_flag().load(std::memory_order_relaxed);
+}
+} // namespace arm_compute
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HugePageAllocator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) && !defined(BARE_METAL)
+#include <sys/mman.h>
+#include <unistd.h>
+#define ARM_COMPUTE_HUGE_PAGES_SUPPORTED
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+
+namespace arm_compute
+{
+namespace
+{
+size_t page_size()
+{
+#ifdef ARM_COMPUTE_HUGE_PAGES_SUPPORTED
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#else  /* ARM_COMPUTE_HUGE_PAGES_SUPPORTED */
+    return 4096;
+#endif /* ARM_COMPUTE_HUGE_PAGES_SUPPORTED */
+}
+
+size_t round_up(size_t size, size_t multiple)
+{
+    return ((size + multiple - 1) / multiple) * multiple;
+}
+
+/** Memory region sharing the ownership of a buffer recycled by a @ref HugePageAllocator */
+class RecycledMemoryRegion final : public IMemoryRegion
+{
+public:
+    RecycledMemoryRegion(std::shared_ptr<void> buffer, size_t size) : IMemoryRegion(size), _buffer(std::move(buffer))
+    {
+    }
+
+    void *buffer() override
+    {
+        return _buffer.get();
+    }
+    const void *buffer() const override
+    {
+        return _buffer.get();
+    }
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) override
+    {
+        if (_buffer != nullptr && (offset < _size) && (_size - offset >= size))
+        {
+            return std::make_unique<MemoryRegion>(static_cast<uint8_t *>(_buffer.get()) + offset, size);
+        }
+        return nullptr;
+    }
+
+private:
+    std::shared_ptr<void> _buffer;
+};
+} // namespace
+
+constexpr size_t HugePageAllocator::huge_page_size;
+
+struct HugePageAllocator::Pool
+{
+    /** Mapped buffer */
+    struct Buffer
+    {
+        void  *ptr{nullptr};
+        size_t size{0};
+        bool   huge{false};
+    };
+
+    explicit Pool(size_t max_cached_size) : max_cached_size(max_cached_size)
+    {
+    }
+    ~Pool()
+    {
+        for (const auto &buffer : in_use)
+        {
+            unmap(buffer.second);
+        }
+        release_cached();
+    }
+
+    Buffer map(size_t size)
+    {
+#ifdef ARM_COMPUTE_HUGE_PAGES_SUPPORTED
+        constexpr int prot  = PROT_READ | PROT_WRITE;
+        constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+        if (size < huge_page_size)
+        {
+            void *ptr = mmap(nullptr, size, prot, flags, -1, 0);
+            if (ptr == MAP_FAILED)
+            {
+                ARM_COMPUTE_ERROR("Failed to map memory");
+            }
+            return {ptr, size, false};
+        }
+
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+        // Reserved huge pages, usually there are none unless the system is configured for them
+        if (use_reserved_pages.load(std::memory_order_relaxed))
+        {
+            void *ptr = mmap(nullptr, size, prot, flags | MAP_HUGETLB | (21 << MAP_HUGE_SHIFT), -1, 0);
+            if (ptr != MAP_FAILED)
+            {
+                return {ptr, size, true};
+            }
+            use_reserved_pages.store(false, std::memory_order_relaxed);
+        }
+#endif /* defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT) */
+
+        // Transparent huge pages: only the 2 MiB-aligned ranges can be backed by huge pages
+        const size_t mapped_size = size + huge_page_size;
+        uint8_t     *mapped      = static_cast<uint8_t *>(mmap(nullptr, mapped_size, prot, flags, -1, 0));
+        if (static_cast<void *>(mapped) == MAP_FAILED)
+        {
+            ARM_COMPUTE_ERROR("Failed to map memory");
+        }
+        const uintptr_t address = reinterpret_cast<uintptr_t>(mapped);
+        uint8_t        *ptr     = mapped + (round_up(address, huge_page_size) - address);
+        if (ptr != mapped)
+        {
+            munmap(mapped, ptr - mapped);
+        }
+        munmap(ptr + size, mapped + mapped_size - (ptr + size));
+#ifdef MADV_HUGEPAGE
+        const bool huge = madvise(ptr, size, MADV_HUGEPAGE) == 0;
+#else  /* MADV_HUGEPAGE */
+        const bool huge = false;
+#endif /* MADV_HUGEPAGE */
+        return {ptr, size, huge};
+#else  /* ARM_COMPUTE_HUGE_PAGES_SUPPORTED */
+        return {::operator new(size), size, false};
+#endif /* ARM_COMPUTE_HUGE_PAGES_SUPPORTED */
+    }
+
+    static void unmap(const Buffer &buffer)
+    {
+#ifdef ARM_COMPUTE_HUGE_PAGES_SUPPORTED
+        munmap(buffer.ptr, buffer.size);
+#else  /* ARM_COMPUTE_HUGE_PAGES_SUPPORTED */
+        ::operator delete(buffer.ptr);
+#endif /* ARM_COMPUTE_HUGE_PAGES_SUPPORTED */
+    }
+
+    void *acquire(size_t size)
+    {
+        if (size == 0)
+        {
+            return nullptr;
+        }
+        const size_t cls = size_class(size);
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            ++stats.num_allocations;
+            auto it = cached.find(cls);
+            if (it != cached.end() && !it->second.empty())
+            {
+                const Buffer buffer = it->second.back();
+                it->second.pop_back();
+                in_use.emplace(buffer.ptr, buffer);
+                ++stats.num_recycled;
+                stats.bytes_cached -= buffer.size;
+                stats.bytes_in_use += buffer.size;
+                return buffer.ptr;
+            }
+        }
+
+        // Map outside of the lock, other threads can keep recycling buffers meanwhile
+        const Buffer buffer = map(cls);
+
+        std::lock_guard<std::mutex> lock(mtx);
+        in_use.emplace(buffer.ptr, buffer);
+        stats.bytes_in_use += buffer.size;
+        stats.huge_page_bytes += buffer.huge ? buffer.size : 0;
+        stats.peak_bytes_mapped = std::max(stats.peak_bytes_mapped, stats.bytes_in_use + stats.bytes_cached);
+        return buffer.ptr;
+    }
+
+    void release(void *ptr)
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        Buffer buffer{};
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            auto                        it = in_use.find(ptr);
+            ARM_COMPUTE_ERROR_ON_MSG(it == in_use.end(), "Memory wasn't allocated by this allocator");
+            buffer = it->second;
+            in_use.erase(it);
+            stats.bytes_in_use -= buffer.size;
+            if (stats.bytes_cached + buffer.size <= max_cached_size)
+            {
+                cached[buffer.size].push_back(buffer);
+                stats.bytes_cached += buffer.size;
+                return;
+            }
+            stats.huge_page_bytes -= buffer.huge ? buffer.size : 0;
+        }
+        unmap(buffer);
+    }
+
+    void release_cached()
+    {
+        std::map<size_t, std::vector<Buffer>> buffers;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            std::swap(buffers, cached);
+            for (const auto &size_buffers : buffers)
+            {
+                for (const Buffer &buffer : size_buffers.second)
+                {
+                    stats.huge_page_bytes -= buffer.huge ? buffer.size : 0;
+                }
+            }
+            stats.bytes_cached = 0;
+        }
+        for (const auto &size_buffers : buffers)
+        {
+            std::for_each(size_buffers.second.begin(), size_buffers.second.end(), unmap);
+        }
+    }
+
+    const size_t                          max_cached_size;
+    std::mutex                            mtx{};
+    std::unordered_map<void *, Buffer>    in_use{};
+    std::map<size_t, std::vector<Buffer>> cached{};
+    Stats                                 stats{};
+    std::atomic<bool>                     use_reserved_pages{true};
+};
+
+HugePageAllocator::HugePageAllocator(size_t max_cached_size) : _pool(std::make_shared<Pool>(max_cached_size))
+{
+}
+
+HugePageAllocator::~HugePageAllocator() = default;
+
+HugePageAllocator::Stats HugePageAllocator::stats() const
+{
+    std::lock_guard<std::mutex> lock(_pool->mtx);
+    return _pool->stats;
+}
+
+void HugePageAllocator::release_cached()
+{
+    _pool->release_cached();
+}
+
+size_t HugePageAllocator::size_class(size_t size)
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+    if (size >= huge_page_size)
+    {
+        return round_up(size, huge_page_size);
+    }
+    // Four classes per power of two pages, which bounds the rounding to a quarter of the size
+    const size_t pages = round_up(size, page_size()) / page_size();
+    if (pages <= 4)
+    {
+        return std::min(pages * page_size(), huge_page_size);
+    }
+    size_t msb = 1;
+    while ((msb << 1) <= pages)
+    {
+        msb <<= 1;
+    }
+    return std::min(round_up(pages, msb / 4) * page_size(), huge_page_size);
+}
+
+void *HugePageAllocator::allocate(size_t size, size_t alignment)
+{
+    if (alignment > page_size())
+    {
+        ARM_COMPUTE_ERROR("Alignment larger than a page is not supported");
+    }
+    return _pool->acquire(size);
+}
+
+void HugePageAllocator::free(void *ptr)
+{
+    _pool->release(ptr);
+}
+
+std::unique_ptr<IMemoryRegion> HugePageAllocator::make_region(size_t size, size_t alignment)
+{
+    if (alignment > page_size())
+    {
+        ARM_COMPUTE_ERROR("Alignment larger than a page is not supported");
+    }
+    if (size == 0)
+    {
+        return std::make_unique<MemoryRegion>(nullptr, 0);
+    }
+    std::shared_ptr<Pool> pool = _pool;
+    std::shared_ptr<void> buffer(pool->acquire(size), [pool](void *ptr) { pool->release(ptr); });
+    return std::make_unique<RecycledMemoryRegion>(std::move(buffer), size);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,18 +27,94 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Log.h"
 #include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/SchedulerTracer.h"
 
 #include "src/common/cpuinfo/CpuInfo.h"
 #include "src/runtime/SchedulerUtils.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
 namespace arm_compute
 {
+/** Queue of kernels executed one after the other by a dedicated dispatch thread */
+struct IScheduler::AsyncQueue
+{
+    AsyncQueue() : _thread(&AsyncQueue::dispatch_thread, this)
+    {
+    }
+    ~AsyncQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            _stop = true;
+        }
+        _cv.notify_all();
+        _thread.join();
+    }
+    void push(std::packaged_task<void()> &&task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            _tasks.push_back(std::move(task));
+            ++_pending;
+        }
+        _cv.notify_all();
+    }
+    void wait_idle()
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _idle_cv.wait(lock, [&] { return _pending == 0; });
+    }
+    void dispatch_thread()
+    {
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(_m);
+            _cv.wait(lock, [&] { return _stop || !_tasks.empty(); });
+            if (_tasks.empty())
+            {
+                return;
+            }
+            std::packaged_task<void()> task = std::move(_tasks.front());
+            _tasks.pop_front();
+            lock.unlock();
+
+            // Any exception thrown by the kernel is stored in the task's future
+            task();
+
+            lock.lock();
+            if (--_pending == 0)
+            {
+                _idle_cv.notify_all();
+            }
+        }
+    }
+
+    std::mutex                             _m{};
+    std::condition_variable                _cv{};
+    std::condition_variable                _idle_cv{};
+    std::deque<std::packaged_task<void()>> _tasks{};
+    unsigned int                           _pending{0};
+    bool                                   _stop{false};
+    std::thread                            _thread; // Must be the last member to start after the state is initialised
+};
+
 IScheduler::IScheduler()
 {
     // Work out the best possible number of execution threads
     _num_threads_hint = cpuinfo::num_threads_hint();
 }
 
+IScheduler::~IScheduler() = default;
+
+std::shared_ptr<const std::vector<float>> IScheduler::thread_capacities() const
+{
+    return nullptr;
+}
+
 CPUInfo &IScheduler::cpu_info()
 {
     return CPUInfo::get();
@@ -115,7 +191,7 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
                     });
             }
         }
-        run_workloads(workloads);
+        run_traced_workloads(workloads, kernel->name(), &max_window);
     }
     else
     {
@@ -127,8 +203,14 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             return;
         }
 
-        if (!kernel->is_parallelisable() || num_threads == 1)
+        if (hints.has_cost() && kernel->is_parallelisable() && this->num_threads() > 1)
+        {
+            schedule_partitioned(kernel, hints, max_window, tensors);
+        }
+        else if (!kernel->is_parallelisable() || num_threads == 1)
         {
+            scheduler_utils::ScopedKernelTrace trace(this, *kernel, max_window);
+
             ThreadInfo info;
             info.cpu_info = &cpu_info();
             if (tensors.empty())
@@ -162,13 +244,21 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             // Make sure the smallest window is larger than minimum workload size
             num_windows = adjust_num_of_windows(max_window, hints.split_dimension(), num_windows, *kernel, cpu_info());
 
+            // One window per thread: size each of them according to the capacity of the thread which runs it first
+            const std::shared_ptr<const std::vector<float>> capacities =
+                hints.strategy() == StrategyHint::STATIC ? thread_capacities() : nullptr;
+            const bool weighted = capacities != nullptr && capacities->size() == num_windows;
+
             std::vector<IScheduler::Workload> workloads(num_windows);
             for (unsigned int t = 0; t < num_windows; ++t)
             {
-                //Capture 't' by copy, all the other variables by reference:
-                workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo &info)
+                //Capture 't' and 'weighted' by copy, all the other variables by reference:
+                workloads[t] = [t, weighted, &hints, &max_window, &num_windows, &capacities, &kernel,
+                                &tensors](const ThreadInfo &info)
                 {
-                    Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
+                    Window win = weighted ? scheduler_utils::split_window_weighted(max_window, hints.split_dimension(),
+                                                                                   *capacities, t)
+                                          : max_window.split_window(hints.split_dimension(), t, num_windows);
                     win.validate();
 
                     if (tensors.empty())
@@ -181,18 +271,138 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
                     }
                 };
             }
-            run_workloads(workloads);
+            run_traced_workloads(workloads, kernel->name(), &max_window);
+        }
+    }
+#else  /* !BARE_METAL */
+    ARM_COMPUTE_UNUSED(kernel, hints, window, tensors);
+#endif /* !BARE_METAL */
+}
+
+void IScheduler::schedule_partitioned(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
+{
+#ifndef BARE_METAL
+    const unsigned int num_windows = scheduler_utils::num_windows_for_cost(hints.cost(), this->num_threads());
+    const scheduler_utils::WindowPartition partition =
+        scheduler_utils::partition_window(window, hints.split_dimension(), hints.cost().granule, num_windows);
+
+    if (partition.num_windows() == 1)
+    {
+        scheduler_utils::ScopedKernelTrace trace(this, *kernel, window);
+
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        if (tensors.empty())
+        {
+            kernel->run(window, info);
+        }
+        else
+        {
+            kernel->run_op(tensors, window, info);
         }
+        return;
     }
+
+    std::vector<IScheduler::Workload> workloads(partition.num_windows());
+    for (unsigned int t = 0; t < partition.num_windows(); ++t)
+    {
+        workloads[t] = [t, &partition, &window, &kernel, &tensors](const ThreadInfo &info)
+        {
+            Window win = scheduler_utils::get_partition_window(window, partition, t);
+            win.validate();
+
+            if (tensors.empty())
+            {
+                kernel->run(win, info);
+            }
+            else
+            {
+                kernel->run_op(tensors, win, info);
+            }
+        };
+    }
+    run_traced_workloads(workloads, kernel->name(), &window);
 #else  /* !BARE_METAL */
     ARM_COMPUTE_UNUSED(kernel, hints, window, tensors);
 #endif /* !BARE_METAL */
 }
 
+std::future<void>
+IScheduler::schedule_op_async(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    // Hints, window and tensor pack are copied as the caller's objects might go out of scope before execution
+    std::packaged_task<void()> task(
+        [this, kernel, hints, window, tensors]() mutable { schedule_op(kernel, hints, window, tensors); });
+    std::future<void> future = task.get_future();
+#ifndef BARE_METAL
+    {
+        std::lock_guard<std::mutex> lock(_async_queue_mutex);
+        if (_async_queue == nullptr)
+        {
+            _async_queue = std::make_unique<AsyncQueue>();
+        }
+    }
+    _async_queue->push(std::move(task));
+#else  /* !BARE_METAL */
+    // No threads available: run the kernel synchronously
+    task();
+#endif /* !BARE_METAL */
+    return future;
+}
+
+void IScheduler::sync()
+{
+    AsyncQueue *async_queue = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_async_queue_mutex);
+        async_queue = _async_queue.get();
+    }
+    if (async_queue != nullptr)
+    {
+        async_queue->wait_idle();
+    }
+}
+
 void IScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
 {
-    ARM_COMPUTE_UNUSED(tag);
-    run_workloads(workloads);
+    run_traced_workloads(workloads, tag);
+}
+
+void IScheduler::run_traced_workloads(std::vector<Workload> &workloads, const char *tag, const Window *window)
+{
+    SchedulerTracer &tracer = SchedulerTracer::get();
+    if (!tracer.is_enabled() || workloads.empty())
+    {
+        run_workloads(workloads);
+        return;
+    }
+
+    SchedulerTracer::KernelRecord record;
+    record.scheduler   = this;
+    record.name        = tag != nullptr ? tag : "workloads";
+    record.window      = window != nullptr ? scheduler_utils::window_shape(*window) : std::string();
+    record.num_threads = std::max(1U, std::min(num_threads(), static_cast<unsigned int>(workloads.size())));
+    record.workloads.resize(workloads.size());
+
+    // Wrap the workloads to time them on the thread which runs them, each wrapper writes to its own record
+    std::vector<Workload> traced_workloads(workloads.size());
+    for (std::size_t i = 0; i < workloads.size(); ++i)
+    {
+        traced_workloads[i] = [i, &workloads, &record](const ThreadInfo &info)
+        {
+            SchedulerTracer::WorkloadRecord &workload_record = record.workloads[i];
+            workload_record.thread_id                        = static_cast<unsigned int>(info.thread_id);
+            workload_record.start_ns                         = SchedulerTracer::now_ns();
+            workloads[i](info);
+            workload_record.end_ns = SchedulerTracer::now_ns();
+        };
+    }
+    record.start_ns = SchedulerTracer::now_ns();
+    run_workloads(traced_workloads);
+    record.end_ns = SchedulerTracer::now_ns();
+    tracer.add_record(std::move(record));
 }
 
 std::size_t IScheduler::adjust_num_of_windows(const Window     &window,
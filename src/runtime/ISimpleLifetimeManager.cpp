@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,15 +32,33 @@
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <numeric>
 #include <vector>
 
 namespace arm_compute
 {
 ISimpleLifetimeManager::ISimpleLifetimeManager()
-    : _active_group(nullptr), _active_elements(), _free_blobs(), _occupied_blobs(), _finalized_groups()
+    : _active_group(nullptr),
+      _active_elements(),
+      _free_blobs(),
+      _occupied_blobs(),
+      _managed_size(0),
+      _finalized_groups()
 {
 }
 
+size_t ISimpleLifetimeManager::managed_size() const
+{
+    return _managed_size;
+}
+
+size_t ISimpleLifetimeManager::pool_size() const
+{
+    const auto   add_size  = [](size_t size, const Blob &blob) { return size + blob.max_size; };
+    const size_t free_size = std::accumulate(std::begin(_free_blobs), std::end(_free_blobs), size_t(0), add_size);
+    return std::accumulate(std::begin(_occupied_blobs), std::end(_occupied_blobs), free_size, add_size);
+}
+
 void ISimpleLifetimeManager::register_group(IMemoryGroup *group)
 {
     if (_active_group == nullptr)
@@ -99,6 +117,7 @@ void ISimpleLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t
     el.size      = size;
     el.alignment = alignment;
     el.status    = true;
+    _managed_size += size;
 
     // Find object in the occupied lists
     auto occupied_blob_it = std::find_if(std::begin(_occupied_blobs), std::end(_occupied_blobs),
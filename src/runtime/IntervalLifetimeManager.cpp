@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/IntervalLifetimeManager.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+#include "arm_compute/runtime/OffsetMemoryPool.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+size_t align_offset(size_t offset, size_t alignment)
+{
+    const size_t remainder = (alignment != 0U) ? offset % alignment : 0U;
+    return (remainder != 0U) ? offset + (alignment - remainder) : offset;
+}
+
+/** Object to place in the blob */
+struct PlanElement
+{
+    IMemory *handle;
+    void    *id;
+    size_t   size;
+    size_t   alignment;
+    size_t   start;
+    size_t   end;
+};
+
+bool overlap(const PlanElement &a, const PlanElement &b)
+{
+    return a.start < b.end && b.start < a.end;
+}
+
+/** Assign an offset to each element, in the given order, with a best-fit policy
+ *
+ * @param[in]  elements Elements to place
+ * @param[in]  order    Order in which to place the elements
+ * @param[out] offsets  Offset of each element
+ *
+ * @return Size of the blob needed by the plan
+ */
+size_t plan_best_fit(const std::vector<PlanElement> &elements,
+                     const std::vector<size_t>      &order,
+                     std::vector<size_t>            &offsets)
+{
+    offsets.assign(elements.size(), 0);
+    std::vector<size_t> placed;
+    std::vector<size_t> conflicts;
+    size_t              blob_size = 0;
+    for (const size_t idx : order)
+    {
+        const PlanElement &element = elements[idx];
+
+        // Elements alive at the same time, sorted by offset
+        conflicts.clear();
+        std::copy_if(placed.begin(), placed.end(), std::back_inserter(conflicts),
+                     [&](size_t p) { return overlap(element, elements[p]); });
+        std::sort(conflicts.begin(), conflicts.end(), [&](size_t a, size_t b) { return offsets[a] < offsets[b]; });
+
+        // Find the smallest gap the element fits in, or place it after all the conflicting elements
+        size_t best_offset = std::numeric_limits<size_t>::max();
+        size_t best_gap    = std::numeric_limits<size_t>::max();
+        size_t cursor      = 0;
+        for (const size_t c : conflicts)
+        {
+            const size_t offset = align_offset(cursor, element.alignment);
+            if (offset + element.size <= offsets[c] && offsets[c] - cursor < best_gap)
+            {
+                best_offset = offset;
+                best_gap    = offsets[c] - cursor;
+            }
+            cursor = std::max(cursor, offsets[c] + elements[c].size);
+        }
+        if (best_offset == std::numeric_limits<size_t>::max())
+        {
+            best_offset = align_offset(cursor, element.alignment);
+        }
+
+        offsets[idx] = best_offset;
+        blob_size    = std::max(blob_size, best_offset + element.size);
+        placed.push_back(idx);
+    }
+    return blob_size;
+}
+
+/** Memory group only used to collect the mappings of the lifetime managers replaying a group */
+class ReplayMemoryGroup final : public IMemoryGroup
+{
+public:
+    void manage(IMemoryManageable *obj) override
+    {
+        ARM_COMPUTE_UNUSED(obj);
+    }
+    void finalize_memory(IMemoryManageable *obj, IMemory &obj_memory, size_t size, size_t alignment) override
+    {
+        ARM_COMPUTE_UNUSED(obj, obj_memory, size, alignment);
+    }
+    void acquire() override
+    {
+    }
+    void release() override
+    {
+    }
+    MemoryMappings &mappings() override
+    {
+        return _mappings;
+    }
+
+private:
+    MemoryMappings _mappings{};
+};
+
+/** Replay the lifetime events of a group into another lifetime manager
+ *
+ * @param[in]     elements Elements of the group
+ * @param[in,out] manager  Lifetime manager to replay the events into
+ * @param[out]    group    Group receiving the mappings of @p manager
+ */
+void replay(const std::vector<PlanElement> &elements, ILifetimeManager &manager, IMemoryGroup &group)
+{
+    // Each event is identified by its time, starts and ends having distinct times
+    std::map<size_t, std::pair<const PlanElement *, bool>> events;
+    for (const auto &element : elements)
+    {
+        events[element.start] = std::make_pair(&element, true);
+        events[element.end]   = std::make_pair(&element, false);
+    }
+
+    manager.register_group(&group);
+    for (const auto &event : events)
+    {
+        const PlanElement &element = *event.second.first;
+        if (event.second.second)
+        {
+            manager.start_lifetime(element.id);
+        }
+        else
+        {
+            manager.end_lifetime(element.id, *element.handle, element.size, element.alignment);
+        }
+    }
+}
+} // namespace
+
+IntervalLifetimeManager::IntervalLifetimeManager()
+    : _blob(0),
+      _footprint(),
+      _intervals(),
+      _clock(0),
+      _blob_reference(std::make_unique<BlobLifetimeManager>()),
+      _offset_reference(std::make_unique<OffsetLifetimeManager>())
+{
+}
+
+IntervalLifetimeManager::~IntervalLifetimeManager() = default;
+
+IntervalLifetimeManager::IntervalLifetimeManager(IntervalLifetimeManager &&) = default;
+
+IntervalLifetimeManager &IntervalLifetimeManager::operator=(IntervalLifetimeManager &&) = default;
+
+const IntervalLifetimeManager::info_type &IntervalLifetimeManager::info() const
+{
+    return _blob;
+}
+
+const IntervalLifetimeManager::Footprint &IntervalLifetimeManager::footprint() const
+{
+    return _footprint;
+}
+
+void IntervalLifetimeManager::start_lifetime(void *obj)
+{
+    _intervals[obj] = Interval{_clock++, 0};
+    ISimpleLifetimeManager::start_lifetime(obj);
+}
+
+void IntervalLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment)
+{
+    // Must be recorded before the base class finalizes the group
+    ARM_COMPUTE_ERROR_ON(_intervals.find(obj) == std::end(_intervals));
+    _intervals[obj].end = _clock++;
+    ISimpleLifetimeManager::end_lifetime(obj, obj_memory, size, alignment);
+}
+
+size_t IntervalLifetimeManager::pool_size() const
+{
+    return _blob.size;
+}
+
+std::unique_ptr<IMemoryPool> IntervalLifetimeManager::create_pool(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON(allocator == nullptr);
+    return std::make_unique<OffsetMemoryPool>(allocator, _blob);
+}
+
+MappingType IntervalLifetimeManager::mapping_type() const
+{
+    return MappingType::OFFSETS;
+}
+
+void IntervalLifetimeManager::update_blobs_and_mappings()
+{
+    ARM_COMPUTE_ERROR_ON(!are_all_finalized());
+    ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
+
+    std::vector<PlanElement> elements;
+    elements.reserve(_active_elements.size());
+    for (const auto &active_element : _active_elements)
+    {
+        const Element  &element  = active_element.second;
+        const Interval &interval = _intervals[active_element.first];
+        elements.push_back(
+            PlanElement{element.handle, element.id, element.size, element.alignment, interval.start, interval.end});
+        _blob.alignment = std::max(_blob.alignment, element.alignment);
+    }
+
+    // Peak live size and number of objects alive at the same time
+    std::map<size_t, std::pair<int64_t, int>> deltas;
+    for (const auto &element : elements)
+    {
+        deltas[element.start] = std::make_pair(static_cast<int64_t>(element.size), 1);
+        deltas[element.end]   = std::make_pair(-static_cast<int64_t>(element.size), -1);
+    }
+    int64_t live_size  = 0;
+    int     live_count = 0;
+    for (const auto &delta : deltas)
+    {
+        live_size += delta.second.first;
+        live_count += delta.second.second;
+        _footprint.peak_live = std::max(_footprint.peak_live, static_cast<size_t>(live_size));
+        _blob.owners         = std::max(_blob.owners, static_cast<size_t>(live_count));
+    }
+
+    // Best-fit placement, largest elements first then in order of appearance
+    std::vector<size_t> order(elements.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<size_t> by_size(order);
+    std::stable_sort(by_size.begin(), by_size.end(),
+                     [&](size_t a, size_t b) { return elements[a].size > elements[b].size; });
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return elements[a].start < elements[b].start; });
+
+    std::vector<size_t> offsets;
+    std::vector<size_t> offsets_in_order;
+    size_t              planned_size = plan_best_fit(elements, by_size, offsets);
+    const size_t        size_in_order = plan_best_fit(elements, order, offsets_in_order);
+    if (size_in_order < planned_size)
+    {
+        planned_size = size_in_order;
+        offsets.swap(offsets_in_order);
+    }
+
+    // Replay the group into the other lifetime managers to compare the plans
+    ReplayMemoryGroup offset_group;
+    ReplayMemoryGroup blob_group;
+    replay(elements, *_offset_reference, offset_group);
+    replay(elements, *_blob_reference, blob_group);
+
+    // Keep the plan of the offset manager if it is smaller
+    size_t offset_size = 0;
+    for (const auto &element : elements)
+    {
+        offset_size = std::max(offset_size, offset_group.mappings()[element.handle] + element.size);
+    }
+    auto &group_mappings = _active_group->mappings();
+    for (size_t i = 0; i < elements.size(); ++i)
+    {
+        group_mappings[elements[i].handle] =
+            offset_size < planned_size ? offset_group.mappings()[elements[i].handle] : offsets[i];
+    }
+    _blob.size = std::max(_blob.size, std::min(planned_size, offset_size));
+
+    _offset_reference->release_group(&offset_group);
+    _blob_reference->release_group(&blob_group);
+
+    _footprint.planned = _blob.size;
+    _footprint.offset  = _offset_reference->info().size;
+    _footprint.blob    = std::accumulate(_blob_reference->info().begin(), _blob_reference->info().end(), size_t(0),
+                                         [](size_t sum, const BlobInfo &b) { return sum + b.size; });
+
+    // Reset the lifetimes of the group
+    _intervals.clear();
+    _clock = 0;
+}
+} // namespace arm_compute
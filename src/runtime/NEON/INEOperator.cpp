@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited.
+ * Copyright (c) 2020-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,9 +24,9 @@
 #include "arm_compute/runtime/NEON/INEOperator.h"
 
 #include "arm_compute/core/Window.h"
-#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/core/NEON/INEKernel.h"
+#include "src/runtime/Utils.h"
 
 namespace arm_compute
 {
@@ -50,7 +50,7 @@ void INEOperator::run(ITensorPack &tensors)
 
 void INEOperator::run(ITensorPack &tensors, const Window &window)
 {
-    NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, window, tensors);
+    utils::schedule_op_on_ctx(_ctx, _kernel.get(), Window::DimY, window, tensors);
 }
 
 void INEOperator::prepare(ITensorPack &constants)
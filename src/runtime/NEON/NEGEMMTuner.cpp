@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Log.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <unistd.h>
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
+namespace arm_compute
+{
+namespace
+{
+/** Identifier of the process, 0 where processes aren't supported */
+long process_id()
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    return static_cast<long>(::getpid());
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
+    return 0;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+}
+
+/** Read the "gemm_id;kernel_name" rows of a tuning file into a table
+ *
+ * Malformed rows are skipped with a warning, so that a damaged file doesn't prevent the remaining rows from being used.
+ *
+ * @param[in]  filename File to read
+ * @param[out] table    Table to add the rows to. Rows override existing entries with the same GEMM identifier.
+ *
+ * @return false if the file couldn't be opened
+ */
+bool read_table(const std::string &filename, std::unordered_map<std::string, std::string> &table)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        return false;
+    }
+
+    std::string line;
+    while (!std::getline(fs, line).fail())
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        const size_t pos = line.find(';');
+        if (pos == std::string::npos || pos == 0 || pos + 1 == line.size())
+        {
+            ARM_COMPUTE_LOG_MSG_WITH_FORMAT_CORE(arm_compute::logging::LogLevel::WARN,
+                                                 "Skipping malformed row '%s' in %s", line.c_str(), filename.c_str());
+            continue;
+        }
+        table[line.substr(0, pos)] = line.substr(pos + 1);
+    }
+    return true;
+}
+} // namespace
+
+NEGEMMTuner::NEGEMMTuner()
+{
+    set_tuning_file(utility::getenv("ARM_COMPUTE_GEMM_TUNING_FILE"));
+    set_tune_new_kernels(utility::getenv("ARM_COMPUTE_GEMM_TUNE") == "1");
+}
+
+NEGEMMTuner &NEGEMMTuner::get()
+{
+    static NEGEMMTuner tuner;
+    return tuner;
+}
+
+void NEGEMMTuner::update_enabled()
+{
+    _enabled.store(_tune_new_kernels || !_tuning_params_table.empty(), std::memory_order_relaxed);
+}
+
+void NEGEMMTuner::set_tune_new_kernels(bool tune_new_kernels)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _tune_new_kernels = tune_new_kernels;
+    update_enabled();
+}
+
+bool NEGEMMTuner::tune_new_kernels() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _tune_new_kernels;
+}
+
+void NEGEMMTuner::set_num_iterations(unsigned int num_iterations)
+{
+    ARM_COMPUTE_ERROR_ON(num_iterations == 0);
+    std::lock_guard<std::mutex> lock(_mtx);
+    _num_iterations = std::max(num_iterations, 1U);
+}
+
+unsigned int NEGEMMTuner::num_iterations() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _num_iterations;
+}
+
+void NEGEMMTuner::set_tuning_file(const std::string &filename)
+{
+    if (!filename.empty())
+    {
+        std::ifstream fs(filename);
+        if (fs.is_open())
+        {
+            fs.close();
+            load_from_file(filename);
+        }
+    }
+    std::lock_guard<std::mutex> lock(_mtx);
+    _tuning_file = filename;
+}
+
+std::string NEGEMMTuner::tuning_file() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _tuning_file;
+}
+
+void NEGEMMTuner::add_tuning_params(const std::string &gemm_id, const std::string &kernel_name)
+{
+    ARM_COMPUTE_ERROR_ON(gemm_id.empty() || kernel_name.empty());
+    ARM_COMPUTE_ERROR_ON(gemm_id.find(';') != std::string::npos);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    _tuning_params_table[gemm_id] = kernel_name;
+    update_enabled();
+    if (!_tuning_file.empty())
+    {
+        save_table(_tuning_file);
+    }
+}
+
+bool NEGEMMTuner::find_tuning_params(const std::string &gemm_id, std::string &kernel_name) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    const auto                  it = _tuning_params_table.find(gemm_id);
+    if (it == _tuning_params_table.end())
+    {
+        return false;
+    }
+    kernel_name = it->second;
+    return true;
+}
+
+void NEGEMMTuner::import_tuning_params(const std::unordered_map<std::string, std::string> &tuning_params_table)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    for (const auto &params : tuning_params_table)
+    {
+        _tuning_params_table[params.first] = params.second;
+    }
+    update_enabled();
+}
+
+std::unordered_map<std::string, std::string> NEGEMMTuner::tuning_params_table() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _tuning_params_table;
+}
+
+void NEGEMMTuner::clear()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _tuning_params_table.clear();
+    update_enabled();
+}
+
+void NEGEMMTuner::load_from_file(const std::string &filename)
+{
+    std::unordered_map<std::string, std::string> table;
+    if (!read_table(filename, table))
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    import_tuning_params(table);
+}
+
+bool NEGEMMTuner::save_to_file(const std::string &filename) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return save_table(filename);
+}
+
+bool NEGEMMTuner::save_table(const std::string &filename) const
+{
+    if (_tuning_params_table.empty() || filename.empty())
+    {
+        return false;
+    }
+
+    // Another process may have added rows since this one loaded the file: merge them in rather than dropping them.
+    // The entries of this process take precedence.
+    std::unordered_map<std::string, std::string> table;
+    read_table(filename, table);
+    for (const auto &params : _tuning_params_table)
+    {
+        table[params.first] = params.second;
+    }
+
+    // Write under a temporary name and rename, so that a process loading the file never reads a partial table.
+    // The name is unique to the process and the call, as several processes may tune GEMMs with the same file.
+    static std::atomic<unsigned int> num_saves{0};
+    const std::string                tmp_filename =
+        filename + ".tmp" + std::to_string(process_id()) + "_" + std::to_string(num_saves.fetch_add(1));
+    {
+        std::ofstream fs(tmp_filename, std::ios::out | std::ios::trunc);
+        if (!fs.is_open())
+        {
+            return false;
+        }
+        for (const auto &params : table)
+        {
+            fs << params.first << ";" << params.second << std::endl;
+        }
+        if (fs.fail())
+        {
+            std::remove(tmp_filename.c_str());
+            return false;
+        }
+    }
+    return std::rename(tmp_filename.c_str(), filename.c_str()) == 0;
+}
+} // namespace arm_compute
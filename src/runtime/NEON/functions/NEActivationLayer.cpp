@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,8 +24,10 @@
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/IRuntimeContext.h"
 
 #include "src/cpu/operators/CpuActivation.h"
+#include "src/runtime/Utils.h"
 
 namespace arm_compute
 {
@@ -68,6 +70,8 @@ void NEActivationLayer::run()
     ITensorPack pack;
     pack.add_tensor(TensorType::ACL_SRC, _impl->src);
     pack.add_tensor(TensorType::ACL_DST, _impl->dst);
+
+    utils::ThreadSchedulerScope scope(_impl->ctx != nullptr ? _impl->ctx->scheduler() : nullptr);
     _impl->op->run(pack);
 }
 } // namespace arm_compute
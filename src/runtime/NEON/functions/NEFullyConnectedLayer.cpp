@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,6 +51,7 @@ struct NEFullyConnectedLayer::Impl
 
     bool is_prepared{false};
     bool dynamic_weights{false};
+    bool is_dynamic{false};
 };
 
 NEFullyConnectedLayer::~NEFullyConnectedLayer() = default;
@@ -96,6 +97,7 @@ void NEFullyConnectedLayer::configure(const ITensor          *input,
 
     _impl->dynamic_weights = !weights->info()->are_values_constant() && fc_info.transpose_weights &&
                              !fc_info.are_weights_reshaped && !fc_info.retain_internal_weights;
+    _impl->is_dynamic      = input->info()->is_dynamic() || output->info()->is_dynamic();
 }
 
 Status NEFullyConnectedLayer::has_opt_impl(arm_compute::WeightFormat     &expected_weight_format,
@@ -117,7 +119,7 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo      *input,
                                        FullyConnectedLayerInfo fc_info,
                                        const WeightsInfo      &weights_info)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, biases, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(weights, biases);
     return cpu::CpuFullyConnected::validate(input, weights, biases, output, fc_info, weights_info);
 }
 
@@ -128,6 +130,13 @@ void NEFullyConnectedLayer::run()
         prepare();
     }
 
+    if (_impl->is_dynamic)
+    {
+        // The prepared weights don't depend on the shapes, only the temporary buffers are resized
+        _impl->aux_mem_req = _impl->op->workspace_dynamic(_impl->run_pack);
+        reallocate_temporaries(_impl->aux_mem_req, _impl->workspace);
+    }
+
     MemoryGroupResourceScope scope_mg(_impl->memory_group);
     _impl->op->run(_impl->run_pack);
 }
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEGEMMBatched.h"
+
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuGemmBatched.h"
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+struct NEGEMMBatched::Impl
+{
+    MemoryGroup                          memory_group{};
+    std::unique_ptr<cpu::CpuGemmBatched> op{nullptr};
+
+    const ITensor *original_b{nullptr};
+    bool           is_prepared{false};
+
+    ITensorPack                      run_pack{};
+    ITensorPack                      prep_pack{};
+    WorkspaceData<Tensor>            workspace{};
+    experimental::MemoryRequirements aux_mem_req{};
+};
+
+NEGEMMBatched::NEGEMMBatched(std::shared_ptr<IMemoryManager> memory_manager) : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+NEGEMMBatched::~NEGEMMBatched() = default;
+
+void NEGEMMBatched::configure(const ITensor                         *a,
+                              const ITensor                         *b,
+                              const ITensor                         *c,
+                              ITensor                               *d,
+                              const std::vector<GEMMBatchedProblem> &problems,
+                              const GEMMInfo                        &gemm_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(NEGEMMBatched::validate(a->info(), b->info(), (c != nullptr) ? c->info() : nullptr,
+                                                       d->info(), problems, gemm_info));
+
+    // The B matrices are packed on each run unless they are constant
+    auto b_info_to_use = b->info()->clone();
+    if (!gemm_info.reshape_b_only_on_first_run())
+    {
+        b_info_to_use->set_are_values_constant(false);
+    }
+
+    _impl->is_prepared = false;
+    _impl->original_b  = b;
+    _impl->op          = std::make_unique<cpu::CpuGemmBatched>();
+    _impl->op->configure(a->info(), b_info_to_use.get(), (c != nullptr) ? c->info() : nullptr, d->info(), problems,
+                         gemm_info);
+
+    _impl->run_pack    = {{ACL_SRC_0, a}, {ACL_SRC_1, b}, {ACL_SRC_2, c}, {ACL_DST, d}};
+    _impl->prep_pack   = {{ACL_SRC_1, b}};
+    _impl->aux_mem_req = _impl->op->workspace();
+    _impl->workspace   = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack,
+                                                  _impl->prep_pack, /* allocate_now */ false);
+}
+
+Status NEGEMMBatched::validate(const ITensorInfo                     *a,
+                               const ITensorInfo                     *b,
+                               const ITensorInfo                     *c,
+                               const ITensorInfo                     *d,
+                               const std::vector<GEMMBatchedProblem> &problems,
+                               const GEMMInfo                        &gemm_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
+
+    auto b_to_use = b->clone();
+    if (!gemm_info.reshape_b_only_on_first_run())
+    {
+        b_to_use->set_are_values_constant(false);
+    }
+
+    return cpu::CpuGemmBatched::validate(a, b_to_use.get(), c, d, problems, gemm_info);
+}
+
+void NEGEMMBatched::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+void NEGEMMBatched::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        allocate_tensors(_impl->aux_mem_req, _impl->workspace);
+        _impl->op->prepare(_impl->prep_pack);
+
+        auto has_reshape =
+            std::find_if(_impl->aux_mem_req.begin(), _impl->aux_mem_req.end(),
+                         [](const MemoryInfo &m) -> bool { return m.lifetime == MemoryLifetime::Persistent; });
+
+        if (has_reshape != std::end(_impl->aux_mem_req))
+        {
+            _impl->original_b->mark_as_unused();
+        }
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+        _impl->is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,6 +45,7 @@ struct NEGEMMConvolutionLayer::Impl
     MemoryRequirements                  aux_mem_req{};
     WorkspaceData<Tensor>               workspace_tensors{};
     bool                                is_prepared{false};
+    bool                                is_dynamic{false};
 };
 
 NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager,
@@ -70,6 +71,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor             *input,
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
 
     _impl->is_prepared = false;
+    _impl->is_dynamic  = input->info()->is_dynamic() || output->info()->is_dynamic();
     _impl->weights     = weights;
     _impl->op          = std::make_unique<cpu::CpuGemmConv2d>();
     _impl->op->configure(input->info(), weights->info(), (biases != nullptr ? biases->info() : nullptr), output->info(),
@@ -95,7 +97,7 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo         *input,
                                         bool                       enable_fast_math,
                                         unsigned int               num_groups)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, biases, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(weights, biases);
     return cpu::CpuGemmConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
                                         enable_fast_math, num_groups);
 }
@@ -118,6 +120,12 @@ Status NEGEMMConvolutionLayer::has_opt_impl(arm_compute::WeightFormat &expected_
 void NEGEMMConvolutionLayer::run()
 {
     prepare();
+    if (_impl->is_dynamic)
+    {
+        // The prepared weights don't depend on the shapes, only the temporary buffers are resized
+        _impl->aux_mem_req = _impl->op->workspace_dynamic(_impl->run_pack);
+        reallocate_temporaries(_impl->aux_mem_req, _impl->workspace_tensors);
+    }
     MemoryGroupResourceScope scope_mg(_impl->memory_group);
     _impl->op->run(_impl->run_pack);
 }
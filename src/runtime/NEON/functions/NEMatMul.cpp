@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025 Arm Limited.
+ * Copyright (c) 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -83,4 +83,9 @@ void NEMatMul::run()
     MemoryGroupResourceScope scope_mg(_impl->memory_group);
     _impl->op->run(_impl->run_pack);
 }
+
+void NEMatMul::prepare()
+{
+    _impl->op->prepare(_impl->run_pack);
+}
 } // namespace arm_compute
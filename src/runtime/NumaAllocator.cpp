@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NumaAllocator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#if defined(__linux__) && !defined(BARE_METAL)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define ARM_COMPUTE_NUMA_SUPPORTED
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+
+namespace arm_compute
+{
+namespace
+{
+#ifdef ARM_COMPUTE_NUMA_SUPPORTED
+// Memory policies from linux/mempolicy.h
+constexpr int mpol_preferred  = 1;
+constexpr int mpol_interleave = 3;
+
+/** Parse a list of ids in the sysfs format, e.g. "0-3,8,10-11"
+ *
+ * @param[in] list List to parse
+ *
+ * @return The ids of the list
+ */
+std::vector<int> parse_id_list(const std::string &list)
+{
+    std::vector<int>  ids;
+    std::stringstream ss(list);
+    std::string       range;
+    while (std::getline(ss, range, ','))
+    {
+        if (range.empty() || range == "\n")
+        {
+            continue;
+        }
+        const size_t dash  = range.find('-');
+        const int    first = std::stoi(range.substr(0, dash));
+        const int    last  = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int id = first; id <= last; ++id)
+        {
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
+
+/** Read the list of ids in a sysfs file
+ *
+ * @param[in] path Path of the file
+ *
+ * @return The ids of the list, empty if the file can't be read
+ */
+std::vector<int> read_id_list(const std::string &path)
+{
+    std::ifstream file(path);
+    std::string   list;
+    if (!file.is_open() || !std::getline(file, list))
+    {
+        return {};
+    }
+    return parse_id_list(list);
+}
+
+size_t page_size()
+{
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+size_t round_to_pages(size_t size)
+{
+    const size_t page = page_size();
+    return ((size + page - 1) / page) * page;
+}
+
+/** Map anonymous pages
+ *
+ * @param[in] size       Size to map, a multiple of the page size
+ * @param[in] huge_pages Align the buffers of at least 2 MiB and ask for them to be backed by transparent huge pages
+ *
+ * @return Pointer to the first page
+ */
+void *map_pages(size_t size, bool huge_pages)
+{
+    constexpr size_t huge_page_size = 2 * 1024 * 1024;
+    constexpr int    prot           = PROT_READ | PROT_WRITE;
+    constexpr int    flags          = MAP_PRIVATE | MAP_ANONYMOUS;
+    if (!huge_pages || size < huge_page_size)
+    {
+        void *ptr = mmap(nullptr, size, prot, flags, -1, 0);
+        if (ptr == MAP_FAILED)
+        {
+            ARM_COMPUTE_ERROR("Failed to allocate NUMA memory");
+        }
+        return ptr;
+    }
+
+    // Only the 2 MiB-aligned ranges can be backed by huge pages
+    const size_t mapped_size = size + huge_page_size;
+    void        *mapped      = mmap(nullptr, mapped_size, prot, flags, -1, 0);
+    if (mapped == MAP_FAILED)
+    {
+        ARM_COMPUTE_ERROR("Failed to allocate NUMA memory");
+    }
+    const uintptr_t address = reinterpret_cast<uintptr_t>(mapped);
+    const uintptr_t aligned = ((address + huge_page_size - 1) / huge_page_size) * huge_page_size;
+    uint8_t        *ptr     = static_cast<uint8_t *>(mapped) + (aligned - address);
+    if (aligned != address)
+    {
+        munmap(mapped, aligned - address);
+    }
+    munmap(ptr + size, mapped_size - size - (aligned - address));
+#ifdef MADV_HUGEPAGE
+    // Failures are ignored: the memory stays usable with regular pages
+    madvise(ptr, size, MADV_HUGEPAGE);
+#endif /* MADV_HUGEPAGE */
+    return ptr;
+}
+
+/** Bind pages to a node, or interleave them over all the nodes if node is negative
+ *
+ * @note Failures are ignored: the memory stays usable with the default placement.
+ */
+void bind_pages(void *ptr, size_t size, int node)
+{
+    const unsigned int num_nodes = numa::num_nodes();
+    if (num_nodes <= 1)
+    {
+        return;
+    }
+
+    constexpr size_t           bits_per_word = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> mask((num_nodes + bits_per_word - 1) / bits_per_word, 0UL);
+    for (unsigned int n = 0; n < num_nodes; ++n)
+    {
+        if (node < 0 || static_cast<unsigned int>(node) == n)
+        {
+            mask[n / bits_per_word] |= 1UL << (n % bits_per_word);
+        }
+    }
+    const int mode = node < 0 ? mpol_interleave : mpol_preferred;
+    syscall(SYS_mbind, ptr, size, mode, mask.data(), mask.size() * bits_per_word + 1, 0);
+}
+
+/** Memory region owning pages mapped by a @ref NumaAllocator */
+class NumaMemoryRegion final : public IMemoryRegion
+{
+public:
+    NumaMemoryRegion(void *ptr, size_t size, size_t mapped_size)
+        : IMemoryRegion(size), _ptr(ptr), _mapped_size(mapped_size)
+    {
+    }
+    ~NumaMemoryRegion()
+    {
+        if (_ptr != nullptr)
+        {
+            munmap(_ptr, _mapped_size);
+        }
+    }
+    NumaMemoryRegion(const NumaMemoryRegion &)            = delete;
+    NumaMemoryRegion &operator=(const NumaMemoryRegion &) = delete;
+
+    void *buffer() override
+    {
+        return _ptr;
+    }
+    const void *buffer() const override
+    {
+        return _ptr;
+    }
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) override
+    {
+        if (_ptr != nullptr && (offset < _size) && (_size - offset >= size))
+        {
+            return std::make_unique<MemoryRegion>(static_cast<uint8_t *>(_ptr) + offset, size);
+        }
+        return nullptr;
+    }
+
+private:
+    void  *_ptr;
+    size_t _mapped_size;
+};
+#endif /* ARM_COMPUTE_NUMA_SUPPORTED */
+} // namespace
+
+namespace numa
+{
+unsigned int num_nodes()
+{
+#ifdef ARM_COMPUTE_NUMA_SUPPORTED
+    static const unsigned int nodes = []()
+    {
+        const std::vector<int> online = read_id_list("/sys/devices/system/node/online");
+        return online.empty() ? 1U : static_cast<unsigned int>(*std::max_element(online.begin(), online.end()) + 1);
+    }();
+    return nodes;
+#else  /* ARM_COMPUTE_NUMA_SUPPORTED */
+    return 1;
+#endif /* ARM_COMPUTE_NUMA_SUPPORTED */
+}
+
+std::vector<int> node_cpus(unsigned int node)
+{
+#ifdef ARM_COMPUTE_NUMA_SUPPORTED
+    const std::vector<int> node_list =
+        read_id_list("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    if (!node_list.empty() || num_nodes() > 1)
+    {
+        return node_list;
+    }
+#else  /* ARM_COMPUTE_NUMA_SUPPORTED */
+    ARM_COMPUTE_UNUSED(node);
+#endif /* ARM_COMPUTE_NUMA_SUPPORTED */
+    // No topology information: all the CPUs belong to a single node
+    std::vector<int> cpus(std::max(1U, std::thread::hardware_concurrency()));
+    for (size_t i = 0; i < cpus.size(); ++i)
+    {
+        cpus[i] = static_cast<int>(i);
+    }
+    return cpus;
+}
+
+unsigned int cpu_node(int cpu)
+{
+    for (unsigned int node = 0; node < num_nodes(); ++node)
+    {
+        const std::vector<int> cpus = node_cpus(node);
+        if (std::find(cpus.begin(), cpus.end(), cpu) != cpus.end())
+        {
+            return node;
+        }
+    }
+    return 0;
+}
+
+IScheduler::BindFunc make_bind_func(BindPolicy policy, int node)
+{
+    std::vector<int> order;
+    if (node >= 0)
+    {
+        order = node_cpus(static_cast<unsigned int>(node));
+    }
+    else
+    {
+        std::vector<std::vector<int>> cpus_per_node;
+        size_t                        max_cpus = 0;
+        for (unsigned int n = 0; n < num_nodes(); ++n)
+        {
+            cpus_per_node.push_back(node_cpus(n));
+            max_cpus = std::max(max_cpus, cpus_per_node.back().size());
+        }
+        switch (policy)
+        {
+            case BindPolicy::Scatter:
+                for (size_t i = 0; i < max_cpus; ++i)
+                {
+                    for (const auto &cpus : cpus_per_node)
+                    {
+                        if (i < cpus.size())
+                        {
+                            order.push_back(cpus[i]);
+                        }
+                    }
+                }
+                break;
+            case BindPolicy::Compact:
+            default:
+                for (const auto &cpus : cpus_per_node)
+                {
+                    order.insert(order.end(), cpus.begin(), cpus.end());
+                }
+                break;
+        }
+    }
+
+    return [order](int thread_index, int)
+    { return order.empty() ? -1 : order[static_cast<size_t>(thread_index) % order.size()]; };
+}
+} // namespace numa
+
+NumaAllocator::NumaAllocator(int node, bool huge_pages) : _node(node), _huge_pages(huge_pages)
+{
+}
+
+NumaAllocator::~NumaAllocator()
+{
+#ifdef ARM_COMPUTE_NUMA_SUPPORTED
+    for (const auto &allocation : _sizes)
+    {
+        munmap(allocation.first, allocation.second);
+    }
+#endif /* ARM_COMPUTE_NUMA_SUPPORTED */
+}
+
+int NumaAllocator::node() const
+{
+    return _node;
+}
+
+bool NumaAllocator::huge_pages() const
+{
+    return _huge_pages;
+}
+
+void *NumaAllocator::allocate(size_t size, size_t alignment)
+{
+#ifdef ARM_COMPUTE_NUMA_SUPPORTED
+    if (alignment > page_size())
+    {
+        ARM_COMPUTE_ERROR("Alignment larger than a page is not supported");
+    }
+    if (size == 0)
+    {
+        return nullptr;
+    }
+    const size_t mapped_size = round_to_pages(size);
+    void        *ptr         = map_pages(mapped_size, _huge_pages);
+    bind_pages(ptr, mapped_size, _node);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    _sizes[ptr] = mapped_size;
+    return ptr;
+#else  /* ARM_COMPUTE_NUMA_SUPPORTED */
+    ARM_COMPUTE_UNUSED(alignment);
+    return ::operator new(size);
+#endif /* ARM_COMPUTE_NUMA_SUPPORTED */
+}
+
+void NumaAllocator::free(void *ptr)
+{
+#ifdef ARM_COMPUTE_NUMA_SUPPORTED
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    size_t mapped_size = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        auto                        it = _sizes.find(ptr);
+        ARM_COMPUTE_ERROR_ON_MSG(it == _sizes.end(), "Memory wasn't allocated by this allocator");
+        mapped_size = it->second;
+        _sizes.erase(it);
+    }
+    munmap(ptr, mapped_size);
+#else  /* ARM_COMPUTE_NUMA_SUPPORTED */
+    ::operator delete(ptr);
+#endif /* ARM_COMPUTE_NUMA_SUPPORTED */
+}
+
+std::unique_ptr<IMemoryRegion> NumaAllocator::make_region(size_t size, size_t alignment)
+{
+#ifdef ARM_COMPUTE_NUMA_SUPPORTED
+    if (alignment > page_size())
+    {
+        ARM_COMPUTE_ERROR("Alignment larger than a page is not supported");
+    }
+    if (size == 0)
+    {
+        return std::make_unique<MemoryRegion>(nullptr, 0);
+    }
+    // The region owns its pages, so that it can outlive the allocator
+    const size_t mapped_size = round_to_pages(size);
+    void        *ptr         = map_pages(mapped_size, _huge_pages);
+    bind_pages(ptr, mapped_size, _node);
+    return std::make_unique<NumaMemoryRegion>(ptr, size, mapped_size);
+#else  /* ARM_COMPUTE_NUMA_SUPPORTED */
+    return std::make_unique<MemoryRegion>(size, alignment);
+#endif /* ARM_COMPUTE_NUMA_SUPPORTED */
+}
+} // namespace arm_compute
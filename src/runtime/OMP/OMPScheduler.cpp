@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
 
+#include "src/runtime/SchedulerUtils.h"
+
 #include <omp.h>
 
 namespace arm_compute
@@ -48,6 +50,12 @@ OMPScheduler::OMPScheduler() // NOLINT
 #endif /* !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && \
     (defined(__arm__) || defined(__aarch64__)) && defined(__ANDROID__)*/
 
+OMPScheduler::~OMPScheduler()
+{
+    // Asynchronous kernels must not outlive the scheduler
+    sync();
+}
+
 unsigned int OMPScheduler::num_threads() const
 {
     return _num_threads;
@@ -98,6 +106,8 @@ void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Win
 
     if (!kernel->is_parallelisable() || num_threads == 1)
     {
+        scheduler_utils::ScopedKernelTrace trace(this, *kernel, max_window);
+
         ThreadInfo info;
         info.cpu_info = &cpu_info();
         kernel->run_op(tensors, max_window, info);
@@ -116,7 +126,7 @@ void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Win
                 kernel->run_op(tensors, win, info);
             };
         }
-        run_workloads(workloads);
+        run_traced_workloads(workloads, kernel->name(), &max_window);
     }
 }
 #ifndef DOXYGEN_SKIP_THIS
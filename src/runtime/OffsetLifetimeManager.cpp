@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,6 +52,11 @@ const OffsetLifetimeManager::info_type &OffsetLifetimeManager::info() const
     return _blob;
 }
 
+size_t OffsetLifetimeManager::pool_size() const
+{
+    return _blob.size;
+}
+
 std::unique_ptr<IMemoryPool> OffsetLifetimeManager::create_pool(IAllocator *allocator)
 {
     ARM_COMPUTE_ERROR_ON(allocator == nullptr);
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/PreparedWeightsCache.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Window.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__aarch64__) && defined(__linux__)
+#include <sys/prctl.h>
+#endif // defined(__aarch64__) && defined(__linux__)
+#define ARM_COMPUTE_PREPARED_WEIGHTS_CACHE_SUPPORTED
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
+namespace arm_compute
+{
+namespace
+{
+constexpr char     file_magic[8]     = {'A', 'C', 'L', 'P', 'W', 'C', '0', '1'};
+constexpr uint64_t data_alignment    = 4096;
+constexpr size_t   shared_alignment  = 128;
+constexpr uint64_t hash_prime        = 0x9e3779b97f4a7c15ULL;
+constexpr size_t   hash_num_lanes    = 4;
+constexpr uint64_t hash_lane_seed[4] = {0x243f6a8885a308d3ULL, 0x13198a2e03707344ULL, 0xa4093822299f31d0ULL,
+                                        0x082efa98ec4e6c89ULL};
+
+/** Header of a cache file, followed by the key and, at the next multiple of data_alignment, the prepared weights */
+struct FileHeader
+{
+    char     magic[8];
+    uint64_t key_size;
+    uint64_t data_size;
+    uint64_t data_offset;
+};
+
+uint64_t mix(uint64_t h, uint64_t word)
+{
+    h = (h ^ word) * hash_prime;
+    return h ^ (h >> 29);
+}
+
+/** Hash a buffer with independent lanes, so the multiplications of consecutive words overlap */
+void hash_bytes(const uint8_t *data, size_t size, uint64_t (&lanes)[hash_num_lanes])
+{
+    size_t i = 0;
+    for (; i + hash_num_lanes * sizeof(uint64_t) <= size; i += hash_num_lanes * sizeof(uint64_t))
+    {
+        for (size_t l = 0; l < hash_num_lanes; ++l)
+        {
+            uint64_t word;
+            std::memcpy(&word, data + i + l * sizeof(uint64_t), sizeof(uint64_t));
+            lanes[l] = mix(lanes[l], word);
+        }
+    }
+    for (; i < size; ++i)
+    {
+        lanes[0] = mix(lanes[0], data[i]);
+    }
+}
+
+/** Name of the file storing the prepared weights of a key */
+std::string file_name(const std::string &directory, const std::string &key)
+{
+    uint64_t lanes[hash_num_lanes] = {hash_lane_seed[0], hash_lane_seed[1], hash_lane_seed[2], hash_lane_seed[3]};
+    hash_bytes(reinterpret_cast<const uint8_t *>(key.data()), key.size(), lanes);
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.aclpw", static_cast<unsigned long long>(mix(lanes[0], lanes[1] ^ lanes[2])));
+    return directory + "/" + name;
+}
+
+/** Features of the CPU the layout of the prepared weights depends on */
+std::string isa_string()
+{
+    const CPUInfo     &cpu_info = CPUInfo::get();
+    std::stringstream  ss;
+    ss << "fp16:" << cpu_info.has_fp16() << ",bf16:" << cpu_info.has_bf16() << ",dot:" << cpu_info.has_dotprod()
+       << ",i8mm:" << cpu_info.has_i8mm() << ",sve:" << cpu_info.has_sve() << ",sve2:" << cpu_info.has_sve2()
+       << ",svebf16:" << cpu_info.has_svebf16() << ",svei8mm:" << cpu_info.has_svei8mm()
+       << ",svef32mm:" << cpu_info.has_svef32mm() << ",sme:" << cpu_info.has_sme() << ",sme2:" << cpu_info.has_sme2()
+       << ",smevl:" << cpu_info.get_sme2_vector_length_in_bytes();
+#if defined(__aarch64__) && defined(__linux__) && defined(PR_SVE_GET_VL)
+    if (cpu_info.has_sve())
+    {
+        ss << ",svevl:" << (prctl(PR_SVE_GET_VL) & PR_SVE_VL_LEN_MASK);
+    }
+#endif // defined(__aarch64__) && defined(__linux__) && defined(PR_SVE_GET_VL)
+    return ss.str();
+}
+} // namespace
+
+PreparedWeightsCache::PreparedWeightsCache()
+{
+    set_directory(utility::getenv("ARM_COMPUTE_PREPARED_WEIGHTS_CACHE"));
+}
+
+PreparedWeightsCache &PreparedWeightsCache::get()
+{
+    static PreparedWeightsCache cache;
+    return cache;
+}
+
+void PreparedWeightsCache::set_directory(const std::string &directory)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+#ifdef ARM_COMPUTE_PREPARED_WEIGHTS_CACHE_SUPPORTED
+    _directory = directory;
+#endif // ARM_COMPUTE_PREPARED_WEIGHTS_CACHE_SUPPORTED
+    _stats = Stats{};
+    _enabled.store(!_directory.empty(), std::memory_order_relaxed);
+}
+
+void PreparedWeightsCache::set_sharing(bool enable)
+{
+    _sharing.store(enable, std::memory_order_relaxed);
+}
+
+std::string PreparedWeightsCache::directory() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _directory;
+}
+
+PreparedWeightsCache::Stats PreparedWeightsCache::stats() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _stats;
+}
+
+uint64_t PreparedWeightsCache::hash(const ITensor &tensor)
+{
+    const ITensorInfo &info = *tensor.info();
+    ARM_COMPUTE_ERROR_ON(tensor.buffer() == nullptr);
+
+    uint64_t lanes[hash_num_lanes] = {hash_lane_seed[0], hash_lane_seed[1], hash_lane_seed[2], hash_lane_seed[3]};
+
+    // Hash the tensor row by row to skip the padding
+    const size_t row_size = info.dimension(0) * info.element_size();
+    Window       win;
+    win.use_tensor_dimensions(info.tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator it(&tensor, win);
+    execute_window_loop(
+        win, [&](const Coordinates &) { hash_bytes(it.ptr(), row_size, lanes); }, it);
+
+    uint64_t h = mix(info.tensor_shape().total_size(), static_cast<uint64_t>(info.data_type()));
+    for (const uint64_t lane : lanes)
+    {
+        h = mix(h, lane);
+    }
+    return h;
+}
+
+std::string PreparedWeightsCache::make_key(const std::string &op_name, uint64_t weights_hash, const std::string &config)
+{
+    std::stringstream ss;
+    ss << op_name << ";" << std::hex << weights_hash << std::dec << ";" << config << ";" << isa_string();
+    return ss.str();
+}
+
+std::shared_ptr<const uint8_t> PreparedWeightsCache::load(const std::string &key, size_t size)
+{
+#ifdef ARM_COMPUTE_PREPARED_WEIGHTS_CACHE_SUPPORTED
+    const std::string directory = this->directory();
+    if (directory.empty())
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<const uint8_t> data{nullptr};
+    const int                      fd = ::open(file_name(directory, key).c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0)
+    {
+        struct stat st; // NOLINT
+        if (::fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(FileHeader))
+        {
+            const size_t file_size = st.st_size;
+            void        *base      = ::mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (base != MAP_FAILED)
+            {
+                std::shared_ptr<const uint8_t> mapping(static_cast<const uint8_t *>(base),
+                                                       [file_size](const uint8_t *ptr)
+                                                       { ::munmap(const_cast<uint8_t *>(ptr), file_size); });
+
+                // Check that the file holds the weights of this key, and not of another key with the same file name
+                FileHeader header;
+                std::memcpy(&header, base, sizeof(header));
+                const bool valid = std::memcmp(header.magic, file_magic, sizeof(file_magic)) == 0 &&
+                                   header.key_size == key.size() && header.data_size == size &&
+                                   header.data_offset >= sizeof(FileHeader) + header.key_size &&
+                                   header.data_offset + header.data_size <= file_size &&
+                                   std::memcmp(mapping.get() + sizeof(FileHeader), key.data(), key.size()) == 0;
+                if (valid)
+                {
+                    // Alias the mapping, so the file stays mapped as long as the weights are used
+                    data = std::shared_ptr<const uint8_t>(mapping, mapping.get() + header.data_offset);
+                }
+            }
+        }
+        ::close(fd);
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    ++(data != nullptr ? _stats.hits : _stats.misses);
+    return data;
+#else  // ARM_COMPUTE_PREPARED_WEIGHTS_CACHE_SUPPORTED
+    ARM_COMPUTE_UNUSED(key, size);
+    return nullptr;
+#endif // ARM_COMPUTE_PREPARED_WEIGHTS_CACHE_SUPPORTED
+}
+
+bool PreparedWeightsCache::store(const std::string &key, const uint8_t *data, size_t size)
+{
+#ifdef ARM_COMPUTE_PREPARED_WEIGHTS_CACHE_SUPPORTED
+    const std::string directory = this->directory();
+    if (directory.empty() || data == nullptr)
+    {
+        return false;
+    }
+
+    FileHeader header;
+    std::memcpy(header.magic, file_magic, sizeof(file_magic));
+    header.key_size    = key.size();
+    header.data_size   = size;
+    header.data_offset = ((sizeof(FileHeader) + key.size() + data_alignment - 1) / data_alignment) * data_alignment;
+
+    const std::string filename = file_name(directory, key);
+    // The temporary name is unique to the process and the call, as several operators may store the same weights
+    static std::atomic<unsigned int> num_stores{0};
+    const std::string                tmp_name =
+        filename + ".tmp" + std::to_string(::getpid()) + "_" + std::to_string(num_stores.fetch_add(1));
+    bool              written  = false;
+    {
+        std::ofstream file(tmp_name, std::ios::binary | std::ios::trunc);
+        if (file.is_open())
+        {
+            const std::string padding(header.data_offset - sizeof(FileHeader) - key.size(), '\0');
+            file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            file.write(key.data(), key.size());
+            file.write(padding.data(), padding.size());
+            file.write(reinterpret_cast<const char *>(data), size);
+            written = file.good();
+        }
+    }
+    written = written && std::rename(tmp_name.c_str(), filename.c_str()) == 0;
+    if (!written)
+    {
+        std::remove(tmp_name.c_str());
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    ++_stats.stores;
+    return true;
+#else  // ARM_COMPUTE_PREPARED_WEIGHTS_CACHE_SUPPORTED
+    ARM_COMPUTE_UNUSED(key, data, size);
+    return false;
+#endif // ARM_COMPUTE_PREPARED_WEIGHTS_CACHE_SUPPORTED
+}
+
+std::shared_ptr<const uint8_t> PreparedWeightsCache::find_shared(const std::string &key, size_t size)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    const auto                  it = _shared.find(key);
+    if (it == _shared.end() || it->second.size != size)
+    {
+        return nullptr;
+    }
+    std::shared_ptr<const uint8_t> data = it->second.data.lock();
+    if (data != nullptr)
+    {
+        ++_stats.shares;
+    }
+    return data;
+}
+
+std::shared_ptr<const uint8_t> PreparedWeightsCache::share(const std::string &key, const uint8_t *data, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(data == nullptr);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // Forget the weights whose operators have all been destroyed
+    for (auto it = _shared.begin(); it != _shared.end();)
+    {
+        it = it->second.data.expired() ? _shared.erase(it) : std::next(it);
+    }
+
+    SharedWeights &shared = _shared[key];
+    if (shared.size == size)
+    {
+        std::shared_ptr<const uint8_t> existing = shared.data.lock();
+        if (existing != nullptr)
+        {
+            ++_stats.shares;
+            return existing;
+        }
+    }
+
+    std::shared_ptr<uint8_t> storage(new uint8_t[size + shared_alignment], std::default_delete<uint8_t[]>());
+    const uintptr_t          misalignment = reinterpret_cast<uintptr_t>(storage.get()) % shared_alignment;
+    uint8_t                 *aligned      = storage.get() + (shared_alignment - misalignment) % shared_alignment;
+    std::memcpy(aligned, data, size);
+
+    // Alias the storage, so it's released with the last operator using the weights
+    std::shared_ptr<const uint8_t> weights(storage, aligned);
+    shared.size = size;
+    shared.data = weights;
+    return weights;
+}
+} // namespace arm_compute
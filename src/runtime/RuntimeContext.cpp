@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021 Arm Limited.
+ * Copyright (c) 2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,11 @@ RuntimeContext::RuntimeContext() : _owned_scheduler(SchedulerFactory::create()),
 {
 }
 
+RuntimeContext::RuntimeContext(const std::vector<int> &cpu_ids)
+    : _owned_scheduler(SchedulerFactory::create(cpu_ids)), _scheduler(_owned_scheduler.get())
+{
+}
+
 void RuntimeContext::set_scheduler(IScheduler *scheduler)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(scheduler);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2024 Arm Limited.
+ * Copyright (c) 2017-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,6 +53,10 @@ std::shared_ptr<IScheduler> Scheduler::_custom_scheduler = nullptr;
 std::shared_ptr<IScheduler> thread_local Scheduler::_custom_scheduler = nullptr;
 #endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
 
+#ifndef BARE_METAL
+thread_local IScheduler *Scheduler::_thread_override = nullptr;
+#endif // BARE_METAL
+
 namespace
 {
 std::map<Scheduler::Type, std::unique_ptr<IScheduler>> init()
@@ -97,6 +101,13 @@ Scheduler::Type Scheduler::get_type()
 
 IScheduler &Scheduler::get()
 {
+#ifndef BARE_METAL
+    if (_thread_override != nullptr)
+    {
+        return *_thread_override;
+    }
+#endif // BARE_METAL
+
     if (_scheduler_type == Type::CUSTOM)
     {
         if (_custom_scheduler == nullptr)
@@ -133,3 +144,21 @@ void Scheduler::set(std::shared_ptr<IScheduler> scheduler)
     _custom_scheduler = std::move(scheduler);
     set(Type::CUSTOM);
 }
+
+void Scheduler::set_thread_override(IScheduler *scheduler)
+{
+#ifndef BARE_METAL
+    _thread_override = scheduler;
+#else  // BARE_METAL
+    ARM_COMPUTE_UNUSED(scheduler);
+#endif // BARE_METAL
+}
+
+IScheduler *Scheduler::get_thread_override()
+{
+#ifndef BARE_METAL
+    return _thread_override;
+#else  // BARE_METAL
+    return nullptr;
+#endif // BARE_METAL
+}
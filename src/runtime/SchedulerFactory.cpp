@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -77,4 +77,28 @@ std::unique_ptr<IScheduler> SchedulerFactory::create(Type type)
     }
     ARM_COMPUTE_ERROR("Invalid Scheduler type");
 }
+
+std::unique_ptr<IScheduler> SchedulerFactory::create(const std::vector<int> &cpu_ids, Type type)
+{
+    // Checked in release builds as well: the OpenMP runtime owns its threads and would silently ignore the set
+    if (cpu_ids.empty())
+    {
+        ARM_COMPUTE_ERROR("The CPU set must not be empty");
+    }
+    if (type == Type::OMP)
+    {
+        ARM_COMPUTE_ERROR("CPU sets are only supported by the C++11 scheduler");
+    }
+
+    std::unique_ptr<IScheduler> scheduler = create(type);
+    if (type == Type::CPP)
+    {
+        // The calling thread is not owned by the scheduler: leave its affinity untouched and give every CPU of the
+        // set its own worker thread
+        const IScheduler::BindFunc bind = [cpu_ids](int thread_index, int)
+        { return thread_index == 0 ? -1 : cpu_ids[(thread_index - 1) % cpu_ids.size()]; };
+        scheduler->set_num_threads_with_affinity(cpu_ids.size() + 1, bind);
+    }
+    return scheduler;
+}
 } // namespace arm_compute
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/SchedulerTracer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <set>
+
+namespace arm_compute
+{
+namespace
+{
+/** Escape a string to be written as a JSON string */
+std::string escape_json(const std::string &str)
+{
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (const char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+            escaped += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            escaped += ' ';
+        }
+        else
+        {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+/** Default maximum number of records kept by the tracer */
+constexpr size_t default_capacity = 1 << 16;
+
+/** Get the capacity of the tracer from ARM_COMPUTE_SCHEDULER_TRACE_CAPACITY */
+size_t capacity_from_env()
+{
+    const std::string capacity = utility::getenv("ARM_COMPUTE_SCHEDULER_TRACE_CAPACITY");
+    if (!capacity.empty())
+    {
+        const unsigned long value = std::strtoul(capacity.c_str(), nullptr, 10);
+        if (value > 0)
+        {
+            return static_cast<size_t>(value);
+        }
+    }
+    return default_capacity;
+}
+
+/** Convert a time in ns relative to the origin of the trace to the us expected by the Chrome trace format */
+double to_us(int64_t time_ns, int64_t origin_ns)
+{
+    return static_cast<double>(time_ns - origin_ns) / 1000.;
+}
+} // namespace
+
+SchedulerTracer::SchedulerTracer()
+    : _capacity(capacity_from_env()), _trace_file(utility::getenv("ARM_COMPUTE_SCHEDULER_TRACE"))
+{
+    if (!_trace_file.empty())
+    {
+        set_enabled(true);
+    }
+}
+
+SchedulerTracer::~SchedulerTracer()
+{
+    if (!_trace_file.empty())
+    {
+        save_chrome_trace(_trace_file);
+    }
+}
+
+SchedulerTracer &SchedulerTracer::get()
+{
+    static SchedulerTracer tracer;
+    return tracer;
+}
+
+void SchedulerTracer::set_enabled(bool enable)
+{
+    _enabled.store(enable, std::memory_order_relaxed);
+}
+
+void SchedulerTracer::clear()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _records.clear();
+    _next    = 0;
+    _dropped = 0;
+}
+
+void SchedulerTracer::set_capacity(size_t capacity)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(capacity == 0, "The capacity of the tracer must be greater than 0");
+    std::lock_guard<std::mutex> lock(_mtx);
+    std::vector<KernelRecord>   records = ordered_records();
+    if (records.size() > capacity)
+    {
+        _dropped += records.size() - capacity;
+        records.erase(records.begin(), records.end() - capacity);
+    }
+    _records  = std::move(records);
+    _capacity = capacity;
+    _next     = 0;
+}
+
+size_t SchedulerTracer::capacity() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _capacity;
+}
+
+size_t SchedulerTracer::num_dropped() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _dropped;
+}
+
+std::vector<SchedulerTracer::KernelRecord> SchedulerTracer::records() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return ordered_records();
+}
+
+std::vector<SchedulerTracer::KernelRecord> SchedulerTracer::ordered_records() const
+{
+    std::vector<KernelRecord> records;
+    records.reserve(_records.size());
+    records.insert(records.end(), _records.begin() + _next, _records.end());
+    records.insert(records.end(), _records.begin(), _records.begin() + _next);
+    return records;
+}
+
+void SchedulerTracer::add_record(KernelRecord &&record)
+{
+    if (!is_enabled())
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (_records.size() < _capacity)
+    {
+        _records.push_back(std::move(record));
+    }
+    else
+    {
+        // Overwrite the oldest record
+        _records[_next] = std::move(record);
+        _next           = (_next + 1) % _capacity;
+        ++_dropped;
+    }
+}
+
+void SchedulerTracer::write_chrome_trace(std::ostream &os) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // The order of the events doesn't matter in a Chrome trace: walk the ring buffer as is
+    int64_t origin_ns = _records.empty() ? 0 : _records.front().start_ns;
+    for (const auto &record : _records)
+    {
+        origin_ns = std::min(origin_ns, record.start_ns);
+    }
+
+    // Each scheduler is a process: track 0 shows the kernels, track t + 1 the workloads run by thread t
+    std::map<const IScheduler *, unsigned int> pids;
+    std::map<unsigned int, std::set<unsigned int>> tids;
+
+    os << std::fixed << std::setprecision(3);
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first_event = true;
+    auto begin_event = [&]()
+    {
+        os << (first_event ? "\n" : ",\n");
+        first_event = false;
+    };
+
+    for (const auto &record : _records)
+    {
+        const auto         pid_it = pids.emplace(record.scheduler, static_cast<unsigned int>(pids.size())).first;
+        const unsigned int pid    = pid_it->second;
+        const std::string  name   = escape_json(record.name);
+
+        // Busy time of each thread during the kernel, the remainder of the kernel's duration being idle time
+        std::vector<int64_t> busy_ns(record.num_threads, 0);
+        for (const auto &workload : record.workloads)
+        {
+            if (workload.thread_id >= busy_ns.size())
+            {
+                busy_ns.resize(workload.thread_id + 1, 0);
+            }
+            busy_ns[workload.thread_id] += workload.end_ns - workload.start_ns;
+            tids[pid].insert(workload.thread_id + 1);
+
+            begin_event();
+            os << "{\"name\":\"" << name << "\",\"cat\":\"workload\",\"ph\":\"X\",\"pid\":" << pid
+               << ",\"tid\":" << workload.thread_id + 1 << ",\"ts\":" << to_us(workload.start_ns, origin_ns)
+               << ",\"dur\":" << to_us(workload.end_ns, workload.start_ns) << "}";
+        }
+
+        const int64_t duration_ns = record.end_ns - record.start_ns;
+        int64_t       total_busy  = 0;
+        int64_t       total_idle  = 0;
+        int64_t       max_busy    = 0;
+        for (const auto busy : busy_ns)
+        {
+            total_busy += busy;
+            total_idle += std::max<int64_t>(duration_ns - busy, 0);
+            max_busy = std::max(max_busy, busy);
+        }
+        const double mean_busy = static_cast<double>(total_busy) / busy_ns.size();
+        const double imbalance = mean_busy > 0. ? max_busy / mean_busy : 1.;
+
+        tids[pid].insert(0);
+        begin_event();
+        os << "{\"name\":\"" << name << "\",\"cat\":\"kernel\",\"ph\":\"X\",\"pid\":" << pid << ",\"tid\":0"
+           << ",\"ts\":" << to_us(record.start_ns, origin_ns) << ",\"dur\":" << to_us(record.end_ns, record.start_ns)
+           << ",\"args\":{\"window\":\"" << escape_json(record.window) << "\",\"workloads\":" << record.workloads.size()
+           << ",\"threads\":" << busy_ns.size() << ",\"busy_us\":" << to_us(total_busy, 0)
+           << ",\"idle_us\":" << to_us(total_idle, 0) << ",\"imbalance\":" << imbalance << "}}";
+    }
+
+    for (const auto &pid_tids : tids)
+    {
+        begin_event();
+        os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid_tids.first << ",\"args\":{\"name\":\"Scheduler "
+           << pid_tids.first << "\"}}";
+        for (const auto tid : pid_tids.second)
+        {
+            begin_event();
+            os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid_tids.first << ",\"tid\":" << tid
+               << ",\"args\":{\"name\":\"";
+            if (tid == 0)
+            {
+                os << "Kernels";
+            }
+            else
+            {
+                os << "Thread " << tid - 1;
+            }
+            os << "\"}}";
+        }
+    }
+    os << "\n]}\n";
+}
+
+bool SchedulerTracer::save_chrome_trace(const std::string &filename) const
+{
+    std::ofstream fs(filename, std::ios::out);
+    if (!fs.is_open())
+    {
+        return false;
+    }
+    write_chrome_trace(fs);
+    return fs.good();
+}
+
+int64_t SchedulerTracer::now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,8 +23,12 @@
  */
 #include "src/runtime/SchedulerUtils.h"
 
+#include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/math/Math.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 
 namespace arm_compute
@@ -32,6 +36,38 @@ namespace arm_compute
 namespace scheduler_utils
 {
 #ifndef BARE_METAL
+namespace
+{
+// Rough throughput of one core used to convert a workload cost into cycles
+constexpr uint64_t macs_per_cycle  = 8;
+constexpr uint64_t bytes_per_cycle = 8;
+// Number of cycles a workload must last to amortise the cost of waking up a thread and feeding it
+constexpr uint64_t min_cycles_per_window = 10000;
+
+std::size_t num_chunks(const Window &window, std::size_t dim, unsigned int granule)
+{
+    return DIV_CEIL(window.num_iterations(dim), static_cast<std::size_t>(granule));
+}
+
+Window::Dimension split_dimension(const Window::Dimension &dim,
+                                  std::size_t              num_iterations,
+                                  unsigned int             granule,
+                                  unsigned int             id,
+                                  unsigned int             num_splits)
+{
+    // Split the granules as evenly as possible
+    const std::size_t chunks     = DIV_CEIL(num_iterations, static_cast<std::size_t>(granule));
+    const std::size_t chunk_from = chunks * id / num_splits;
+    const std::size_t chunk_to   = chunks * (id + 1) / num_splits;
+    const std::size_t it_from    = chunk_from * granule;
+    const std::size_t it_to      = std::min(num_iterations, chunk_to * granule);
+
+    const int start = dim.start() + static_cast<int>(it_from) * dim.step();
+    const int end   = std::min(dim.end(), dim.start() + static_cast<int>(it_to) * dim.step());
+    return Window::Dimension(start, end, dim.step());
+}
+} // namespace
+
 std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std::size_t n)
 {
     /*
@@ -77,6 +113,168 @@ std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std:
         return {1, std::min<unsigned>(n, max_threads)};
     }
 }
+
+Window split_window_weighted(const Window &window, std::size_t dim, const std::vector<float> &weights, unsigned int id)
+{
+    const std::size_t num_parts      = weights.size();
+    const std::size_t num_iterations = window.num_iterations(dim);
+    ARM_COMPUTE_ERROR_ON(id >= num_parts);
+    ARM_COMPUTE_ERROR_ON(num_parts > num_iterations);
+
+    double total_weight = 0.;
+    for (const float w : weights)
+    {
+        total_weight += w;
+    }
+
+    // Boundaries (in iterations) of the parts, adjusted so that every part gets at least one iteration
+    std::vector<std::size_t> bounds(num_parts + 1);
+    bounds[0]         = 0;
+    bounds[num_parts] = num_iterations;
+    double cumulative = 0.;
+    for (std::size_t i = 1; i < num_parts; ++i)
+    {
+        cumulative += weights[i - 1];
+        bounds[i] = static_cast<std::size_t>(std::lround(num_iterations * cumulative / total_weight));
+        bounds[i] = std::max(bounds[i], bounds[i - 1] + 1);
+    }
+    for (std::size_t i = num_parts - 1; i > 0; --i)
+    {
+        bounds[i] = std::min(bounds[i], bounds[i + 1] - 1);
+    }
+
+    const Window::Dimension &d = window[dim];
+    Window                   win(window);
+    win.set(dim, Window::Dimension(d.start() + static_cast<int>(bounds[id]) * d.step(),
+                                   std::min(d.end(), d.start() + static_cast<int>(bounds[id + 1]) * d.step()), d.step()));
+    return win;
+}
+
+unsigned int num_windows_for_cost(const IScheduler::WorkloadCost &cost, unsigned int max_windows)
+{
+    const uint64_t cycles               = cost.macs / macs_per_cycle + cost.bytes / bytes_per_cycle;
+    const uint64_t max_windows_for_cost = std::max<uint64_t>(1, cycles / min_cycles_per_window);
+    return static_cast<unsigned int>(std::min<uint64_t>(std::max(1U, max_windows), max_windows_for_cost));
+}
+
+WindowPartition
+partition_window(const Window &window, std::size_t hinted_dim, unsigned int granule, unsigned int num_windows)
+{
+    ARM_COMPUTE_ERROR_ON(hinted_dim >= Coordinates::num_max_dimensions);
+    granule = std::max(1U, granule);
+
+    WindowPartition partition{};
+    partition.dim0     = hinted_dim;
+    partition.granule0 = granule;
+
+    const std::size_t hinted_chunks = num_chunks(window, hinted_dim, granule);
+    if (hinted_chunks >= num_windows)
+    {
+        partition.num_splits0 = num_windows;
+        return partition;
+    }
+
+    // Rank the dimensions by number of iterations, the hinted one being measured in granules
+    std::array<std::pair<std::size_t, std::size_t>, Coordinates::num_max_dimensions> ranking{};
+    for (std::size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
+    {
+        ranking[d] = std::make_pair(num_chunks(window, d, d == hinted_dim ? granule : 1), d);
+    }
+    std::stable_sort(ranking.begin(), ranking.end(),
+                     [](const std::pair<std::size_t, std::size_t> &a, const std::pair<std::size_t, std::size_t> &b)
+                     { return a.first > b.first; });
+    const std::size_t c0 = ranking[0].first;
+    const std::size_t d0 = ranking[0].second;
+    const std::size_t c1 = ranking[1].first;
+    const std::size_t d1 = ranking[1].second;
+
+    partition.dim0     = d0;
+    partition.granule0 = d0 == hinted_dim ? granule : 1;
+    if (c0 >= num_windows || c1 <= 1)
+    {
+        partition.num_splits0 = static_cast<unsigned int>(std::min<std::size_t>(c0, num_windows));
+        return partition;
+    }
+
+    // Tile the two largest dimensions: pick the grid with the most tiles fitting in num_windows, and among those the
+    // one closest to the proportions of the window
+    const auto skew = [&](unsigned int n0, unsigned int n1)
+    { return std::abs(static_cast<double>(n0) * c1 - static_cast<double>(n1) * c0); };
+
+    unsigned int best0 = 1;
+    unsigned int best1 = 1;
+    for (unsigned int n0 = 1; n0 <= std::min<std::size_t>(c0, num_windows); ++n0)
+    {
+        const unsigned int n1 = static_cast<unsigned int>(std::min<std::size_t>(c1, num_windows / n0));
+        if (n0 * n1 > best0 * best1 || (n0 * n1 == best0 * best1 && skew(n0, n1) < skew(best0, best1)))
+        {
+            best0 = n0;
+            best1 = n1;
+        }
+    }
+    partition.num_splits0 = best0;
+    partition.dim1        = d1;
+    partition.num_splits1 = best1;
+    return partition;
+}
+
+Window get_partition_window(const Window &window, const WindowPartition &partition, unsigned int id)
+{
+    ARM_COMPUTE_ERROR_ON(id >= partition.num_windows());
+
+    const unsigned int id0 = id % partition.num_splits0;
+    const unsigned int id1 = id / partition.num_splits0;
+
+    Window win(window);
+    win.set(partition.dim0, split_dimension(window[partition.dim0], window.num_iterations(partition.dim0),
+                                            partition.granule0, id0, partition.num_splits0));
+    if (partition.num_splits1 > 1)
+    {
+        win.set(partition.dim1, split_dimension(window[partition.dim1], window.num_iterations(partition.dim1), 1,
+                                                id1, partition.num_splits1));
+    }
+    return win;
+}
 #endif /* #ifndef BARE_METAL */
+
+std::string window_shape(const Window &window)
+{
+    std::size_t num_dims = 1;
+    for (std::size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
+    {
+        if (window.num_iterations(d) != 1)
+        {
+            num_dims = d + 1;
+        }
+    }
+    std::string shape = std::to_string(window.num_iterations(0));
+    for (std::size_t d = 1; d < num_dims; ++d)
+    {
+        shape += "x" + std::to_string(window.num_iterations(d));
+    }
+    return shape;
+}
+
+ScopedKernelTrace::ScopedKernelTrace(const IScheduler *scheduler, const ICPPKernel &kernel, const Window &window)
+    : _enabled(SchedulerTracer::get().is_enabled())
+{
+    if (_enabled)
+    {
+        _record.scheduler = scheduler;
+        _record.name      = kernel.name();
+        _record.window    = window_shape(window);
+        _record.start_ns  = SchedulerTracer::now_ns();
+    }
+}
+
+ScopedKernelTrace::~ScopedKernelTrace()
+{
+    if (_enabled)
+    {
+        _record.end_ns = SchedulerTracer::now_ns();
+        _record.workloads.push_back({0, _record.start_ns, _record.end_ns});
+        SchedulerTracer::get().add_record(std::move(_record));
+    }
+}
 } // namespace scheduler_utils
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,8 +24,14 @@
 #ifndef SRC_COMPUTE_SCHEDULER_UTILS_H
 #define SRC_COMPUTE_SCHEDULER_UTILS_H
 
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/SchedulerTracer.h"
+
 #include <cstddef>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -40,6 +46,103 @@ namespace scheduler_utils
  * @returns [m_nthreads, n_nthreads] A pair of the threads that should be used in each dimension
  */
 std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std::size_t n);
+
+/** Split a window along one dimension in parts proportional to a set of weights
+ *
+ * Each part contains at least one iteration.
+ *
+ * @param[in] window  Window to split
+ * @param[in] dim     Dimension to split
+ * @param[in] weights Relative weight of each part. There must be at most as many parts as iterations in @p dim.
+ * @param[in] id      Index of the part to return
+ *
+ * @return The sub-window of the part @p id
+ */
+Window split_window_weighted(const Window &window, std::size_t dim, const std::vector<float> &weights, unsigned int id);
+
+/** Partition of a window in a grid of sub-windows along at most two dimensions */
+struct WindowPartition
+{
+    std::size_t  dim0{0};       /**< First split dimension */
+    unsigned int num_splits0{1}; /**< Number of splits along the first dimension */
+    unsigned int granule0{1};    /**< Number of iterations each split along the first dimension is a multiple of */
+    std::size_t  dim1{0};       /**< Second split dimension */
+    unsigned int num_splits1{1}; /**< Number of splits along the second dimension */
+
+    /** Total number of sub-windows in the partition
+     *
+     * @return The number of sub-windows
+     */
+    unsigned int num_windows() const
+    {
+        return num_splits0 * num_splits1;
+    }
+};
+
+/** Calculate how many workloads the given cost can keep busy without the scheduling overhead dominating
+ *
+ * @param[in] cost        Estimated cost of the whole workload
+ * @param[in] max_windows Upper bound on the number of workloads (usually the number of threads)
+ *
+ * @return The number of workloads to create, at least 1
+ */
+unsigned int num_windows_for_cost(const IScheduler::WorkloadCost &cost, unsigned int max_windows);
+
+/** Partition a window in a given number of sub-windows
+ *
+ * The hinted dimension is split alone if it has enough granules, otherwise the dimension with the most iterations
+ * is used instead. If no single dimension is large enough, the two largest dimensions are tiled.
+ *
+ * @param[in] window      Window to partition
+ * @param[in] hinted_dim  Dimension preferred for the split
+ * @param[in] granule     Number of iterations each split along the hinted dimension should be a multiple of
+ * @param[in] num_windows Desired number of sub-windows
+ *
+ * @return The partition, which may contain fewer sub-windows than requested if the window is too small
+ */
+WindowPartition
+partition_window(const Window &window, std::size_t hinted_dim, unsigned int granule, unsigned int num_windows);
+
+/** Return the sub-window of a partition
+ *
+ * @param[in] window    Partitioned window
+ * @param[in] partition Partition returned by @ref partition_window
+ * @param[in] id        Index of the sub-window, in [0, partition.num_windows())
+ *
+ * @return The sub-window
+ */
+Window get_partition_window(const Window &window, const WindowPartition &partition, unsigned int id);
+
+/** Format the number of iterations of each dimension of a window, e.g. "64x32x3"
+ *
+ * @param[in] window Window to format
+ *
+ * @return The shape of the window, trailing dimensions of one iteration are omitted
+ */
+std::string window_shape(const Window &window);
+
+/** Record in the @ref SchedulerTracer the execution of a kernel on the calling thread, from construction to destruction */
+class ScopedKernelTrace
+{
+public:
+    /** Constructor
+     *
+     * @param[in] scheduler Scheduler running the kernel
+     * @param[in] kernel    Kernel being run
+     * @param[in] window    Window the kernel is run on
+     */
+    ScopedKernelTrace(const IScheduler *scheduler, const ICPPKernel &kernel, const Window &window);
+    /** Destructor: add the record to the tracer */
+    ~ScopedKernelTrace();
+    /** Prevent instances of this class from being copied */
+    ScopedKernelTrace(const ScopedKernelTrace &) = delete;
+    /** Prevent instances of this class from being copied */
+    ScopedKernelTrace &operator=(const ScopedKernelTrace &) = delete;
+
+private:
+    bool                          _enabled;
+    SchedulerTracer::KernelRecord _record{};
+};
 } // namespace scheduler_utils
 } // namespace arm_compute
 #endif /* SRC_COMPUTE_SCHEDULER_UTILS_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2020, 2024 Arm Limited.
+ * Copyright (c) 2016-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,10 @@
 
 using namespace arm_compute;
 
+#ifndef BARE_METAL
+thread_local IAllocator *TensorAllocator::_thread_allocator = nullptr;
+#endif // BARE_METAL
+
 namespace
 {
 bool validate_subtensor_shape(const TensorInfo &parent_info, const TensorInfo &child_info, const Coordinates &coords)
@@ -136,7 +140,15 @@ void TensorAllocator::allocate()
     const size_t alignment_to_use = (alignment() != 0) ? alignment() : 64;
     if (_associated_memory_group == nullptr)
     {
-        _memory.set_owned_region(std::make_unique<MemoryRegion>(info().total_size(), alignment_to_use));
+        IAllocator *allocator = thread_allocator();
+        if (allocator != nullptr)
+        {
+            _memory.set_owned_region(allocator->make_region(info().total_size(), alignment_to_use));
+        }
+        else
+        {
+            _memory.set_owned_region(std::make_unique<MemoryRegion>(info().total_size(), alignment_to_use));
+        }
     }
     else
     {
@@ -151,6 +163,24 @@ void TensorAllocator::free()
     info().set_is_resizable(true);
 }
 
+void TensorAllocator::set_thread_allocator(IAllocator *allocator)
+{
+#ifndef BARE_METAL
+    _thread_allocator = allocator;
+#else  // BARE_METAL
+    ARM_COMPUTE_UNUSED(allocator);
+#endif // BARE_METAL
+}
+
+IAllocator *TensorAllocator::thread_allocator()
+{
+#ifndef BARE_METAL
+    return _thread_allocator;
+#else  // BARE_METAL
+    return nullptr;
+#endif // BARE_METAL
+}
+
 bool TensorAllocator::is_allocated() const
 {
     return _memory.region() != nullptr;
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/TrackingAllocator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace arm_compute
+{
+struct TrackingAllocator::Counters
+{
+    /** Account an allocation to a tag */
+    void add(size_t tag, size_t size)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        held[tag] += size;
+        total += size;
+    }
+    /** Remove an allocation from the bytes held by a tag */
+    void remove(size_t tag, size_t size)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        held[tag] -= size;
+        total -= size;
+    }
+
+    std::atomic<size_t>                                   tag{no_tag};
+    mutable std::mutex                                    mtx{};
+    std::unordered_map<void *, std::pair<size_t, size_t>> allocations{}; /**< Tag and size of the raw allocations */
+    std::map<size_t, size_t>                              held{};        /**< Bytes held per tag */
+    size_t                                                total{0};      /**< Bytes held */
+};
+
+namespace
+{
+/** Memory region accounting the region it wraps to a tag until it's destroyed */
+class TrackedMemoryRegion final : public IMemoryRegion
+{
+public:
+    using RemoveFunction = std::function<void()>;
+
+    TrackedMemoryRegion(std::unique_ptr<IMemoryRegion> region, RemoveFunction remove)
+        : IMemoryRegion(region->size()), _region(std::move(region)), _remove(std::move(remove))
+    {
+    }
+    ~TrackedMemoryRegion()
+    {
+        _remove();
+    }
+    TrackedMemoryRegion(const TrackedMemoryRegion &)            = delete;
+    TrackedMemoryRegion &operator=(const TrackedMemoryRegion &) = delete;
+
+    void *buffer() override
+    {
+        return _region->buffer();
+    }
+    const void *buffer() const override
+    {
+        return _region->buffer();
+    }
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) override
+    {
+        return _region->extract_subregion(offset, size);
+    }
+
+private:
+    std::unique_ptr<IMemoryRegion> _region;
+    RemoveFunction                 _remove;
+};
+} // namespace
+
+constexpr size_t TrackingAllocator::no_tag;
+
+TrackingAllocator::TrackingAllocator(IAllocator *allocator)
+    : _allocator(allocator), _counters(std::make_shared<Counters>())
+{
+}
+
+TrackingAllocator::~TrackingAllocator() = default;
+
+void TrackingAllocator::set_tag(size_t tag)
+{
+    _counters->tag.store(tag);
+}
+
+size_t TrackingAllocator::bytes_held(size_t tag) const
+{
+    std::lock_guard<std::mutex> lock(_counters->mtx);
+    const auto                  it = _counters->held.find(tag);
+    return it != _counters->held.end() ? it->second : 0;
+}
+
+size_t TrackingAllocator::bytes_held() const
+{
+    std::lock_guard<std::mutex> lock(_counters->mtx);
+    return _counters->total;
+}
+
+void *TrackingAllocator::allocate(size_t size, size_t alignment)
+{
+    void *ptr = _allocator != nullptr ? _allocator->allocate(size, alignment) : ::operator new(size);
+    if (ptr != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(_counters->mtx);
+        const size_t                tag = _counters->tag.load();
+        _counters->allocations[ptr]     = std::make_pair(tag, size);
+        _counters->held[tag] += size;
+        _counters->total += size;
+    }
+    return ptr;
+}
+
+void TrackingAllocator::free(void *ptr)
+{
+    if (ptr != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(_counters->mtx);
+        auto                        it = _counters->allocations.find(ptr);
+        ARM_COMPUTE_ERROR_ON_MSG(it == _counters->allocations.end(), "Memory wasn't allocated by this allocator");
+        _counters->held[it->second.first] -= it->second.second;
+        _counters->total -= it->second.second;
+        _counters->allocations.erase(it);
+    }
+    if (_allocator != nullptr)
+    {
+        _allocator->free(ptr);
+    }
+    else
+    {
+        ::operator delete(ptr);
+    }
+}
+
+std::unique_ptr<IMemoryRegion> TrackingAllocator::make_region(size_t size, size_t alignment)
+{
+    std::unique_ptr<IMemoryRegion> region = _allocator != nullptr ? _allocator->make_region(size, alignment)
+                                                                  : std::make_unique<MemoryRegion>(size, alignment);
+    std::shared_ptr<Counters> counters = _counters;
+    const size_t              tag      = counters->tag.load();
+    counters->add(tag, size);
+    return std::make_unique<TrackedMemoryRegion>(std::move(region),
+                                                 [counters, tag, size]() { counters->remove(tag, size); });
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,52 @@ const std::string &string_from_scheduler_type(Scheduler::Type t);
  */
 void schedule_kernel_on_ctx(IRuntimeContext *ctx, ICPPKernel *kernel, const IScheduler::Hints &hints);
 
+/** Schedules an operator kernel using the context if not nullptr else uses the legacy scheduling flow.
+ *
+ * @param[in] ctx     Context to use.
+ * @param[in] kernel  Kernel to schedule.
+ * @param[in] hints   Hints to use.
+ * @param[in] window  Window to use for kernel execution.
+ * @param[in] tensors Vector containing the tensors to operate on.
+ */
+void schedule_op_on_ctx(IRuntimeContext         *ctx,
+                        ICPPKernel              *kernel,
+                        const IScheduler::Hints &hints,
+                        const Window            &window,
+                        ITensorPack             &tensors);
+
+/** Make a scheduler the active scheduler of the calling thread for the lifetime of the object
+ *
+ * Functions scheduling their kernels through @ref Scheduler::get() then run them on the given scheduler.
+ */
+class ThreadSchedulerScope
+{
+public:
+    /** Constructor
+     *
+     * @param[in] scheduler Scheduler to activate. If nullptr, the active scheduler is left unchanged.
+     */
+    explicit ThreadSchedulerScope(IScheduler *scheduler) : _previous(Scheduler::get_thread_override())
+    {
+        if (scheduler != nullptr)
+        {
+            Scheduler::set_thread_override(scheduler);
+        }
+    }
+    /** Prevent instances of this class from being copied */
+    ThreadSchedulerScope(const ThreadSchedulerScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    ThreadSchedulerScope &operator=(const ThreadSchedulerScope &) = delete;
+    /** Destructor: restores the previously active scheduler */
+    ~ThreadSchedulerScope()
+    {
+        Scheduler::set_thread_override(_previous);
+    }
+
+private:
+    IScheduler *_previous;
+};
+
 /** Calculate number of stages for parallel implementations
  *
  * @param[in] input_x_dimension input tensor x dimension
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/experimental/WorkspaceArena.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Allocator.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace experimental
+{
+namespace
+{
+size_t align_up(size_t value, size_t alignment)
+{
+    return alignment > 1 ? ((value + alignment - 1) / alignment) * alignment : value;
+}
+} // namespace
+
+WorkspaceArena::WorkspaceArena() : _operators(), _region(nullptr), _persistent_size(0), _shared_size(0), _alignment(64)
+{
+}
+
+WorkspaceArena::~WorkspaceArena() = default;
+
+unsigned int WorkspaceArena::add_operator(const MemoryRequirements &mem_reqs)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_region != nullptr, "Operators can't be added once the arena is allocated");
+
+    std::vector<Slot> slots;
+    for (const auto &req : mem_reqs)
+    {
+        if (req.size == 0)
+        {
+            continue;
+        }
+        Slot slot;
+        slot.info = req;
+        slots.emplace_back(std::move(slot));
+    }
+    _operators.emplace_back(std::move(slots));
+
+    return static_cast<unsigned int>(_operators.size() - 1);
+}
+
+void WorkspaceArena::allocate(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_region != nullptr, "The arena is already allocated");
+
+    // Persistent tensors live as long as the arena, so they are laid out one after the other
+    _persistent_size = 0;
+    for (auto &slots : _operators)
+    {
+        for (auto &slot : slots)
+        {
+            _alignment = std::max(_alignment, slot.info.alignment);
+            if (slot.info.lifetime == MemoryLifetime::Persistent)
+            {
+                slot.offset      = align_up(_persistent_size, slot.info.alignment);
+                _persistent_size = slot.offset + slot.info.size;
+            }
+        }
+    }
+
+    // Only one operator prepares or runs at a time: the Temporary and Prepare tensors of each operator are laid out
+    // from the start of the shared region
+    const size_t shared_offset = align_up(_persistent_size, _alignment);
+    _shared_size               = 0;
+    for (auto &slots : _operators)
+    {
+        size_t operator_size = 0;
+        for (auto &slot : slots)
+        {
+            if (slot.info.lifetime != MemoryLifetime::Persistent)
+            {
+                slot.offset   = align_up(operator_size, slot.info.alignment);
+                operator_size = slot.offset + slot.info.size;
+                slot.offset += shared_offset;
+            }
+        }
+        _shared_size = std::max(_shared_size, operator_size);
+    }
+
+    const size_t total_size = size();
+    if (total_size == 0)
+    {
+        return;
+    }
+
+    Allocator default_allocator;
+    _region       = (allocator != nullptr ? allocator : &default_allocator)->make_region(total_size, _alignment);
+    uint8_t *base = static_cast<uint8_t *>(_region->buffer());
+    ARM_COMPUTE_ERROR_ON_NULLPTR(base);
+
+    for (auto &slots : _operators)
+    {
+        for (auto &slot : slots)
+        {
+            slot.tensor = std::make_unique<Tensor>();
+            slot.tensor->allocator()->init(TensorInfo(TensorShape(slot.info.size), 1, DataType::U8),
+                                           slot.info.alignment);
+            const Status status = slot.tensor->allocator()->import_memory(base + slot.offset);
+            ARM_COMPUTE_UNUSED(status);
+            ARM_COMPUTE_ERROR_THROW_ON(status);
+        }
+    }
+}
+
+void WorkspaceArena::add_workspace(unsigned int id, ITensorPack &run_pack, ITensorPack &prep_pack)
+{
+    ARM_COMPUTE_ERROR_ON(id >= _operators.size());
+
+    for (auto &slot : _operators[id])
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(slot.tensor == nullptr, "The arena must be allocated first");
+        if (slot.info.lifetime != MemoryLifetime::Temporary)
+        {
+            prep_pack.add_tensor(slot.info.slot, slot.tensor.get());
+        }
+        run_pack.add_tensor(slot.info.slot, slot.tensor.get());
+    }
+}
+
+size_t WorkspaceArena::size() const
+{
+    return _shared_size > 0 ? align_up(_persistent_size, _alignment) + _shared_size : _persistent_size;
+}
+
+size_t WorkspaceArena::persistent_size() const
+{
+    return _persistent_size;
+}
+
+size_t WorkspaceArena::unshared_size() const
+{
+    size_t total = 0;
+    for (const auto &slots : _operators)
+    {
+        for (const auto &slot : slots)
+        {
+            total += slot.info.size;
+        }
+    }
+    return total;
+}
+} // namespace experimental
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023, 2025 Arm Limited.
+ * Copyright (c) 2017-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <cstdio>
 #include <limits>
 #include <memory>
 #include <random>
@@ -51,6 +52,12 @@
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
 #include "arm_compute/runtime/RuntimeContext.h"
 
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
 namespace arm_compute
 {
 #ifdef ARM_COMPUTE_CL
@@ -629,6 +636,62 @@ void set_tensor_static(TensorType &t)
     t.info()->set_tensor_dims_state(construct_static_dims_state());
 }
 
+#if !defined(_WIN64) && !defined(BARE_METAL)
+/** Temporary directory removed with its files when the object goes out of scope */
+class TemporaryDirectory
+{
+public:
+    /** Constructor
+     *
+     * @param[in] prefix Prefix of the path of the directory, a unique suffix is appended to it
+     */
+    explicit TemporaryDirectory(const std::string &prefix)
+    {
+        std::vector<char> path(prefix.begin(), prefix.end());
+        const std::string suffix = "XXXXXX";
+        path.insert(path.end(), suffix.begin(), suffix.end());
+        path.push_back('\0');
+        if (mkdtemp(path.data()) == nullptr)
+        {
+            ARM_COMPUTE_ERROR("Failed to create a temporary directory");
+        }
+        _path = path.data();
+    }
+    /** Prevent instances of this class from being copied */
+    TemporaryDirectory(const TemporaryDirectory &) = delete;
+    /** Prevent instances of this class from being copied */
+    TemporaryDirectory &operator=(const TemporaryDirectory &) = delete;
+    /** Destructor: remove the files of the directory and the directory */
+    ~TemporaryDirectory()
+    {
+        DIR *dir = opendir(_path.c_str());
+        if (dir != nullptr)
+        {
+            for (const dirent *entry = readdir(dir); entry != nullptr; entry = readdir(dir))
+            {
+                const std::string name(entry->d_name);
+                if (name != "." && name != "..")
+                {
+                    std::remove((_path + "/" + name).c_str());
+                }
+            }
+            closedir(dir);
+        }
+        rmdir(_path.c_str());
+    }
+    /** Path of the directory
+     *
+     * @return The path of the directory
+     */
+    const std::string &path() const
+    {
+        return _path;
+    }
+
+private:
+    std::string _path{};
+};
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
 } // namespace test
 } // namespace arm_compute
 #endif // ACL_TESTS_UTILS_H
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "tests/benchmark/fixtures/GEMMBatchedFixture.h"
+#include "tests/benchmark/fixtures/GEMMCacheBlockingFixture.h"
+#include "tests/benchmark/fixtures/GEMMSparseFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+/** GEMMs whose operands don't fit in the L2 cache, as found in the fully connected and convolution layers of networks */
+const auto large_gemms = zip(zip(framework::dataset::make("M", {1024u, 3136u, 4096u}),
+                                 framework::dataset::make("N", {1024u, 256u, 1024u})),
+                             framework::dataset::make("K", {1024u, 2304u, 4096u}));
+const auto data_types  = framework::dataset::make("DataType", {DataType::F32});
+
+/** GEMMs of fully connected layers, from a matrix-vector product to a batch of 64 */
+const auto sparse_gemms =
+    zip(zip(framework::dataset::make("M", {1u, 64u}), framework::dataset::make("N", {4096u, 1024u})),
+        framework::dataset::make("K", {4096u, 4096u}));
+/** Dense baseline, block-sparse weights with 50%, 75% and 90% of zero blocks, and 2:4 structured weights */
+const auto sparsity_levels = concat(
+    concat(combine(framework::dataset::make("Sparsity", WeightsSparsity::DENSE),
+                   framework::dataset::make("ZeroBlocksRatio", 0.f)),
+           combine(framework::dataset::make("Sparsity", WeightsSparsity::BLOCK_4X4),
+                   framework::dataset::make("ZeroBlocksRatio", {0.5f, 0.75f, 0.9f}))),
+    combine(framework::dataset::make("Sparsity", WeightsSparsity::STRUCTURED_2_4),
+            framework::dataset::make("ZeroBlocksRatio", 0.f)));
+
+/** Many small products, as found in grouped convolutions and in the heads of attention layers */
+const auto batched_gemms = zip(zip(zip(framework::dataset::make("NumProblems", {64u, 512u, 4096u}),
+                                       framework::dataset::make("M", {64u, 16u, 4u})),
+                                   framework::dataset::make("N", {32u, 16u, 8u})),
+                               framework::dataset::make("K", {32u, 16u, 8u}));
+} // namespace
+
+using NEGEMMDetectedCachesFixture = GEMMCacheBlockingFixture<true>;
+using NEGEMMDefaultCachesFixture  = GEMMCacheBlockingFixture<false>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(GEMM)
+TEST_SUITE(CacheBlocking)
+REGISTER_FIXTURE_DATA_TEST_CASE(DetectedCaches,
+                                NEGEMMDetectedCachesFixture,
+                                framework::DatasetMode::ALL,
+                                combine(large_gemms, data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(DefaultCaches,
+                                NEGEMMDefaultCachesFixture,
+                                framework::DatasetMode::ALL,
+                                combine(large_gemms, data_types));
+TEST_SUITE_END() // CacheBlocking
+TEST_SUITE(Sparse)
+REGISTER_FIXTURE_DATA_TEST_CASE(SparseWeights,
+                                GEMMSparseFixture,
+                                framework::DatasetMode::ALL,
+                                combine(sparse_gemms, sparsity_levels, data_types));
+TEST_SUITE_END() // Sparse
+TEST_SUITE(Batched)
+REGISTER_FIXTURE_DATA_TEST_CASE(SmallProducts,
+                                GEMMBatchedFixture,
+                                framework::DatasetMode::ALL,
+                                combine(batched_gemms, framework::dataset::make("Batched", {false, true}), data_types));
+TEST_SUITE_END() // Batched
+TEST_SUITE_END() // GEMM
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
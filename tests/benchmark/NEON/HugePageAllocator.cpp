@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/HugePageAllocator.h"
+#include "tests/benchmark/fixtures/GEMMChainFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+// Activations of the 1x1 convolutions of the first stages of ResNet-50 (56x56x256) and MobileNet (112x112x128)
+const auto gemm_chain_dataset = combine(combine(framework::dataset::make("Shape",
+                                                                          {TensorShape(256U, 3136U),
+                                                                           TensorShape(128U, 12544U)}),
+                                                framework::dataset::make("NumLayers", {4})),
+                                        framework::dataset::make("DataType", {DataType::F32}));
+} // namespace
+
+using NEGEMMChainFixture         = GEMMChainFixture<Allocator>;
+using NEGEMMChainHugePageFixture = GEMMChainFixture<HugePageAllocator>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(HugePageAllocator)
+REGISTER_FIXTURE_DATA_TEST_CASE(GEMMChain, NEGEMMChainFixture, framework::DatasetMode::ALL, gemm_chain_dataset);
+REGISTER_FIXTURE_DATA_TEST_CASE(GEMMChainHugePages,
+                                NEGEMMChainHugePageFixture,
+                                framework::DatasetMode::ALL,
+                                gemm_chain_dataset);
+TEST_SUITE_END() // HugePageAllocator
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/AffinityPoolManager.h"
+#include "arm_compute/runtime/PoolManager.h"
+#include "tests/benchmark/fixtures/PoolManagerFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto num_tensors = framework::dataset::make("NumTensors", {1, 16, 64});
+} // namespace
+
+using NEPoolManagerFixture         = PoolManagerFixture<PoolManager>;
+using NEAffinityPoolManagerFixture = PoolManagerFixture<AffinityPoolManager>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(PoolManager)
+REGISTER_FIXTURE_DATA_TEST_CASE(AcquireRelease, NEPoolManagerFixture, framework::DatasetMode::ALL, num_tensors);
+TEST_SUITE_END() // PoolManager
+
+TEST_SUITE(AffinityPoolManager)
+REGISTER_FIXTURE_DATA_TEST_CASE(AcquireRelease, NEAffinityPoolManagerFixture, framework::DatasetMode::ALL, num_tensors);
+TEST_SUITE_END() // AffinityPoolManager
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
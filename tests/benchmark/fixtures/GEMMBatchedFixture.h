@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_GEMMBATCHEDFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_GEMMBATCHEDFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/GEMMBatchedInfo.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMBatched.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Fixture.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture running many independent small matrix products
+ *
+ * The products either run in a single batched GEMM, or through one GEMM function per product as a baseline.
+ */
+class GEMMBatchedFixture : public framework::Fixture
+{
+public:
+    void setup(
+        unsigned int num_problems, unsigned int m, unsigned int n, unsigned int k, bool batched, DataType data_type)
+    {
+        _batched = batched;
+        if (batched)
+        {
+            std::vector<GEMMBatchedProblem> problems;
+            for (size_t i = 0; i < num_problems; ++i)
+            {
+                problems.emplace_back(m, n, k, i * m * k, i * k * n, i * m * n);
+            }
+
+            a.allocator()->init(TensorInfo(TensorShape(num_problems * m * k), 1, data_type));
+            b.allocator()->init(TensorInfo(TensorShape(num_problems * k * n), 1, data_type));
+            d.allocator()->init(TensorInfo(TensorShape(num_problems * m * n), 1, data_type));
+            gemm_batched.configure(&a, &b, nullptr, &d, problems);
+
+            a.allocator()->allocate();
+            b.allocator()->allocate();
+            d.allocator()->allocate();
+            library->fill_tensor_uniform(Accessor(a), 0);
+            library->fill_tensor_uniform(Accessor(b), 1);
+        }
+        else
+        {
+            as.resize(num_problems);
+            bs.resize(num_problems);
+            ds.resize(num_problems);
+            gemms.resize(num_problems);
+            for (size_t i = 0; i < num_problems; ++i)
+            {
+                as[i].allocator()->init(TensorInfo(TensorShape(k, m), 1, data_type));
+                bs[i].allocator()->init(TensorInfo(TensorShape(n, k), 1, data_type));
+                ds[i].allocator()->init(TensorInfo(TensorShape(n, m), 1, data_type));
+
+                gemms[i] = std::make_unique<NEGEMM>();
+                gemms[i]->configure(&as[i], &bs[i], nullptr, &ds[i], 1.f, 0.f);
+
+                as[i].allocator()->allocate();
+                bs[i].allocator()->allocate();
+                ds[i].allocator()->allocate();
+                library->fill_tensor_uniform(Accessor(as[i]), 0);
+                library->fill_tensor_uniform(Accessor(bs[i]), 1);
+            }
+        }
+
+        // Run once to prepare the B matrices
+        run();
+    }
+
+    void run()
+    {
+        if (_batched)
+        {
+            gemm_batched.run();
+        }
+        else
+        {
+            for (auto &gemm : gemms)
+            {
+                gemm->run();
+            }
+        }
+    }
+
+    void sync()
+    {
+    }
+
+    void teardown()
+    {
+        a.allocator()->free();
+        b.allocator()->free();
+        d.allocator()->free();
+        for (size_t i = 0; i < gemms.size(); ++i)
+        {
+            as[i].allocator()->free();
+            bs[i].allocator()->free();
+            ds[i].allocator()->free();
+        }
+    }
+
+private:
+    bool          _batched{false};
+    Tensor        a{};
+    Tensor        b{};
+    Tensor        d{};
+    NEGEMMBatched gemm_batched{};
+
+    std::vector<Tensor>                  as{};
+    std::vector<Tensor>                  bs{};
+    std::vector<Tensor>                  ds{};
+    std::vector<std::unique_ptr<NEGEMM>> gemms{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_GEMMBATCHEDFIXTURE_H
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_GEMMCACHEBLOCKINGFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_GEMMCACHEBLOCKINGFIXTURE_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture running a large GEMM blocked either for the detected caches or for the fixed default cache sizes used when
+ * the caches can't be detected
+ */
+template <bool DetectedCaches>
+class GEMMCacheBlockingFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int m, unsigned int n, unsigned int k, DataType data_type)
+    {
+        src.allocator()->init(TensorInfo(TensorShape(k, m), 1, data_type));
+        weights.allocator()->init(TensorInfo(TensorShape(n, k), 1, data_type));
+        dst.allocator()->init(TensorInfo(TensorShape(n, m), 1, data_type));
+
+        // The blocking is chosen when the function is configured
+        CPUInfo           &cpu_info = CPUInfo::get();
+        const unsigned int L1_size  = cpu_info.get_L1_cache_size();
+        const unsigned int L2_size  = cpu_info.get_L2_cache_size();
+        const unsigned int L3_size  = cpu_info.get_L3_cache_size();
+        const unsigned int L3_cpus  = cpu_info.get_L3_cache_shared_cpus();
+        if (!DetectedCaches)
+        {
+            cpu_info.set_cache_sizes(32768, 262144, 0, 0);
+        }
+        gemm.configure(&src, &weights, nullptr, &dst, 1.f, 0.f);
+        cpu_info.set_cache_sizes(L1_size, L2_size, L3_size, L3_cpus);
+
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        dst.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(weights), 1);
+
+        // Run once to prepare the weights
+        gemm.run();
+    }
+
+    void run()
+    {
+        gemm.run();
+    }
+
+    void sync()
+    {
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    Tensor src{};
+    Tensor weights{};
+    Tensor dst{};
+    NEGEMM gemm{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_GEMMCACHEBLOCKINGFIXTURE_H
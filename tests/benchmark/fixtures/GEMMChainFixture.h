@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_GEMMCHAINFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_GEMMCHAINFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/PoolManager.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Fixture.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture running a chain of GEMMs whose weights, activations and workspaces are backed by a given allocator, as the
+ * fully connected and 1x1 convolution layers of a graph are
+ */
+template <typename AllocatorType>
+class GEMMChainFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, unsigned int num_layers, DataType data_type)
+    {
+        // The weights aren't memory managed, they are allocated by the allocator of the thread
+        IAllocator *const previous_allocator = TensorAllocator::thread_allocator();
+        TensorAllocator::set_thread_allocator(&allocator);
+
+        auto lifetime_mgr = std::make_shared<BlobLifetimeManager>();
+        auto pool_mgr     = std::make_shared<PoolManager>();
+        memory_mgr        = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+        memory_group      = std::make_unique<MemoryGroup>(memory_mgr);
+
+        // Square weights, so that all the layers have the shape of the input
+        const unsigned int k = shape[0];
+        src.allocator()->init(TensorInfo(shape, 1, data_type));
+        weights.resize(num_layers);
+        dsts.resize(num_layers);
+        gemms.resize(num_layers);
+        for (unsigned int i = 0; i < num_layers; ++i)
+        {
+            weights[i].allocator()->init(TensorInfo(TensorShape(k, k), 1, data_type));
+            dsts[i].allocator()->init(TensorInfo(shape, 1, data_type));
+            if (i + 1 < num_layers)
+            {
+                memory_group->manage(&dsts[i]);
+            }
+            gemms[i] = std::make_unique<NEGEMM>(memory_mgr);
+            gemms[i]->configure(i == 0 ? &src : &dsts[i - 1], &weights[i], nullptr, &dsts[i], 1.f, 0.f);
+            if (i > 0)
+            {
+                dsts[i - 1].allocator()->allocate();
+            }
+        }
+
+        src.allocator()->allocate();
+        dsts.back().allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(src), 0);
+        for (auto &w : weights)
+        {
+            w.allocator()->allocate();
+            library->fill_tensor_uniform(Accessor(w), 1);
+        }
+        memory_mgr->populate(allocator, 1);
+        TensorAllocator::set_thread_allocator(previous_allocator);
+
+        // Run once to prepare the weights
+        run();
+    }
+
+    void run()
+    {
+        MemoryGroupResourceScope scope_mg(*memory_group);
+        for (auto &gemm : gemms)
+        {
+            gemm->run();
+        }
+    }
+
+    void sync()
+    {
+    }
+
+    void teardown()
+    {
+        gemms.clear();
+        memory_group.reset();
+        memory_mgr->clear();
+        dsts.clear();
+        weights.clear();
+        src.allocator()->free();
+    }
+
+private:
+    AllocatorType                          allocator{};
+    std::shared_ptr<MemoryManagerOnDemand> memory_mgr{nullptr};
+    std::unique_ptr<MemoryGroup>           memory_group{nullptr};
+    Tensor                                 src{};
+    std::vector<Tensor>                    weights{};
+    std::vector<Tensor>                    dsts{};
+    std::vector<std::unique_ptr<NEGEMM>>   gemms{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_GEMMCHAINFIXTURE_H
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_GEMMSPARSEFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_GEMMSPARSEFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Fixture.h"
+
+#include <algorithm>
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture running a GEMM with sparse weights
+ *
+ * Block-sparse weights have the given ratio of 4x4 blocks set to zero and 2:4 structured weights have 2 zeros in each
+ * group of 4 values along K. With WeightsSparsity::DENSE, the same weights run through the dense GEMM as a baseline.
+ */
+class GEMMSparseFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int    m,
+               unsigned int    n,
+               unsigned int    k,
+               WeightsSparsity sparsity,
+               float           zero_blocks_ratio,
+               DataType        data_type)
+    {
+        src.allocator()->init(TensorInfo(TensorShape(k, m), 1, data_type));
+        weights.allocator()->init(TensorInfo(TensorShape(n, k), 1, data_type));
+        dst.allocator()->init(TensorInfo(TensorShape(n, m), 1, data_type));
+
+        GEMMInfo gemm_info;
+        gemm_info.set_weights_sparsity(sparsity);
+        gemm.configure(&src, &weights, nullptr, &dst, 1.f, 0.f, gemm_info);
+
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        dst.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(weights), 1);
+
+        // Zero the blocks of 4x4 values, or 2 values of each group of 4 along K for the 2:4 pattern
+        std::mt19937                          gen(library->seed());
+        std::uniform_real_distribution<float> ratio_dist(0.f, 1.f);
+        Accessor                              weights_accessor(weights);
+        for (unsigned int k0 = 0; k0 < k; k0 += 4)
+        {
+            for (unsigned int n0 = 0; n0 < n; n0 += 4)
+            {
+                const bool zero_block = ratio_dist(gen) < zero_blocks_ratio;
+                for (unsigned int kk = k0; kk < std::min(k0 + 4, k); ++kk)
+                {
+                    auto *row = static_cast<float *>(weights_accessor(Coordinates(0, kk)));
+                    for (unsigned int col = n0; col < std::min(n0 + 4, n); ++col)
+                    {
+                        if (zero_block || (sparsity == WeightsSparsity::STRUCTURED_2_4 && ((kk + col) % 4) < 2))
+                        {
+                            row[col] = 0.f;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Run once to prepare the weights
+        gemm.run();
+    }
+
+    void run()
+    {
+        gemm.run();
+    }
+
+    void sync()
+    {
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    Tensor src{};
+    Tensor weights{};
+    Tensor dst{};
+    NEGEMM gemm{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_GEMMSPARSEFIXTURE_H
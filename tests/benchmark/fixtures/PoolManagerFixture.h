@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_POOLMANAGERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_POOLMANAGERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/framework/Fixture.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture measuring the cost of acquiring and releasing the memory of a memory group, as done for each run of a
+ * function or graph using a memory manager
+ */
+template <typename PoolManagerType>
+class PoolManagerFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int num_tensors)
+    {
+        auto lifetime_mgr = std::make_shared<BlobLifetimeManager>();
+        auto pool_mgr     = std::make_shared<PoolManagerType>();
+        memory_mgr        = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+        memory_group      = std::make_unique<MemoryGroup>(memory_mgr);
+
+        tensors.resize(num_tensors);
+        for (auto &tensor : tensors)
+        {
+            tensor.allocator()->init(TensorInfo(TensorShape(64U, 64U), 1, DataType::F32));
+            memory_group->manage(&tensor);
+        }
+        for (auto &tensor : tensors)
+        {
+            tensor.allocator()->allocate();
+        }
+        memory_mgr->populate(allocator, 1);
+    }
+
+    void run()
+    {
+        // A single acquire/release pair is too short to be timed on its own
+        for (unsigned int i = 0; i < num_iterations; ++i)
+        {
+            memory_group->acquire();
+            memory_group->release();
+        }
+    }
+
+    void sync()
+    {
+    }
+
+    void teardown()
+    {
+        tensors.clear();
+        memory_group.reset();
+        memory_mgr->clear();
+    }
+
+private:
+    static constexpr unsigned int num_iterations = 1000;
+
+    Allocator                              allocator{};
+    std::shared_ptr<MemoryManagerOnDemand> memory_mgr{nullptr};
+    std::unique_ptr<MemoryGroup>           memory_group{nullptr};
+    std::vector<Tensor>                    tensors{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_POOLMANAGERFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <tuple>
 
 namespace arm_compute
@@ -607,6 +608,137 @@ bool cpu_supports_dtypes(const std::initializer_list<DataType> &types)
            !(config_has_bf16 && (!cpu_has_bf16 || !bf16_enabled));
 }
 
+Int4Weights generate_int4_weights(size_t                          k,
+                                  size_t                          n,
+                                  const Int4WeightsInfo          &int4_info,
+                                  std::random_device::result_type seed)
+{
+    const size_t num_groups = (k + int4_info.group_size - 1) / int4_info.group_size;
+
+    std::mt19937                          gen(seed);
+    std::uniform_int_distribution<int>    value_dist(-8, 7);
+    std::uniform_int_distribution<int>    zero_point_dist(-4, 3);
+    std::uniform_real_distribution<float> scale_dist(0.01f, 0.1f);
+
+    Int4Weights weights;
+    weights.k          = k;
+    weights.n          = n;
+    weights.group_size = int4_info.group_size;
+    weights.values.assign(n * num_groups * int4_info.group_size, 0);
+    weights.scales.resize(n * num_groups);
+    weights.zero_points.assign(n * num_groups, 0);
+
+    for(size_t col = 0; col < n; ++col)
+    {
+        for(size_t g = 0; g < num_groups; ++g)
+        {
+            // Keep the scale as stored, so that the reference dequantizes exactly as the target
+            const float scale                    = scale_dist(gen);
+            weights.scales[col * num_groups + g] =
+                (int4_info.scale_data_type == DataType::F16) ? static_cast<float>(static_cast<half>(scale)) : scale;
+            if(int4_info.has_zero_points)
+            {
+                weights.zero_points[col * num_groups + g] = static_cast<int8_t>(zero_point_dist(gen));
+            }
+            int8_t *values = weights.values.data() + (col * num_groups + g) * int4_info.group_size;
+            for(size_t i = 0; i < int4_info.group_size && g * int4_info.group_size + i < k; ++i)
+            {
+                values[i] = static_cast<int8_t>(value_dist(gen));
+            }
+        }
+    }
+
+    return weights;
+}
+
+void pack_int4_weights(const Int4Weights &weights, const Int4WeightsInfo &int4_info, IAccessor &dst)
+{
+    const size_t num_groups = (weights.k + int4_info.group_size - 1) / int4_info.group_size;
+
+    for(size_t col = 0; col < weights.n; ++col)
+    {
+        auto *row = static_cast<uint8_t *>(dst(Coordinates(0, col)));
+        for(size_t g = 0; g < num_groups; ++g)
+        {
+            const size_t group = col * num_groups + g;
+            uint8_t     *block = row + g * int4_info.block_size();
+            if(int4_info.scale_data_type == DataType::F16)
+            {
+                const half scale = static_cast<half>(weights.scales[group]);
+                std::memcpy(block, &scale, sizeof(scale));
+                block += sizeof(scale);
+            }
+            else
+            {
+                std::memcpy(block, &weights.scales[group], sizeof(float));
+                block += sizeof(float);
+            }
+            if(int4_info.has_zero_points)
+            {
+                *block++ = static_cast<uint8_t>(weights.zero_points[group]);
+            }
+
+            // Two values per byte, the first one in the low nibble
+            const int8_t *values = weights.values.data() + group * int4_info.group_size;
+            for(size_t i = 0; i < int4_info.group_size / 2; ++i)
+            {
+                block[i] = static_cast<uint8_t>((values[2 * i] & 0xF) | ((values[2 * i + 1] & 0xF) << 4));
+            }
+        }
+    }
+}
+
+SimpleTensor<float> generate_sparse_weights(size_t                          k,
+                                            size_t                          n,
+                                            WeightsSparsity                 sparsity,
+                                            float                           zero_blocks_ratio,
+                                            std::random_device::result_type seed)
+{
+    std::mt19937                          gen(seed);
+    std::uniform_real_distribution<float> value_dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> ratio_dist(0.0f, 1.0f);
+    std::uniform_int_distribution<int>    position_dist(0, 3);
+
+    SimpleTensor<float> weights{ TensorShape(n, k), DataType::F32 };
+    std::generate_n(weights.data(), weights.num_elements(), [&]() { return value_dist(gen); });
+
+    for(size_t k0 = 0; k0 < k; k0 += 4)
+    {
+        const size_t k1 = std::min<size_t>(k0 + 4, k);
+        if(sparsity == WeightsSparsity::BLOCK_4X4)
+        {
+            for(size_t n0 = 0; n0 < n; n0 += 4)
+            {
+                if(ratio_dist(gen) < zero_blocks_ratio)
+                {
+                    for(size_t kk = k0; kk < k1; ++kk)
+                    {
+                        std::fill_n(weights.data() + kk * n + n0, std::min<size_t>(4, n - n0), 0.f);
+                    }
+                }
+            }
+        }
+        else if(sparsity == WeightsSparsity::STRUCTURED_2_4)
+        {
+            // Keep 2 random positions of each group, sometimes the same one to have groups with 3 zeros
+            for(size_t col = 0; col < n; ++col)
+            {
+                const size_t first  = k0 + position_dist(gen);
+                const size_t second = k0 + position_dist(gen);
+                for(size_t kk = k0; kk < k1; ++kk)
+                {
+                    if(kk != first && kk != second)
+                    {
+                        weights[kk * n + col] = 0.f;
+                    }
+                }
+            }
+        }
+    }
+
+    return weights;
+}
+
 template void get_tile(const SimpleTensor<float> &in, SimpleTensor<float> &roi, const Coordinates &coord);
 template void get_tile(const SimpleTensor<half> &in, SimpleTensor<half> &roi, const Coordinates &coord);
 template void get_tile(const SimpleTensor<int> &in, SimpleTensor<int> &roi, const Coordinates &coord);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,9 +27,11 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/function_info/ActivationLayerInfo.h"
+#include "arm_compute/function_info/GEMMInfo.h"
 
 #include "support/Half.h"
 #include "tests/Globals.h"
+#include "tests/IAccessor.h"
 #include "tests/SimpleTensor.h"
 
 #include <cmath>
@@ -38,6 +40,7 @@
 #include <random>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -319,6 +322,58 @@ QuantizationHint suggest_mac_dst_q_info_and_bias(const QuantizationInfo &lhs_q_i
                                                  float                   bias_fraction,
                                                  int                     num_sd = 2);
 
+/** Signed 4-bit weights quantized in groups along K, as described by @ref Int4WeightsInfo */
+struct Int4Weights
+{
+    size_t              k{0};          /**< Number of values per output column */
+    size_t              n{0};          /**< Number of output columns */
+    size_t              group_size{0}; /**< Number of consecutive values sharing a scale and a zero point */
+    std::vector<int8_t> values{};      /**< Values in [-8, 7] of each column, padded with zeros to full groups */
+    std::vector<float>  scales{};      /**< Scale of each group of each column, rounded to the stored data type */
+    std::vector<int8_t> zero_points{}; /**< Zero point of each group of each column, 0 without zero points */
+};
+
+/** Generate random block-quantized signed 4-bit weights
+ *
+ * @param[in] k         Number of values per output column
+ * @param[in] n         Number of output columns
+ * @param[in] int4_info Layout of the weights
+ * @param[in] seed      Seed of the random values, scales and zero points
+ *
+ * @return The weights
+ */
+Int4Weights generate_int4_weights(size_t                          k,
+                                  size_t                          n,
+                                  const Int4WeightsInfo          &int4_info,
+                                  std::random_device::result_type seed);
+
+/** Pack block-quantized signed 4-bit weights in a U8 tensor of shape [Int4WeightsInfo::row_size(k), n]
+ *
+ * @param[in]  weights   Weights to pack
+ * @param[in]  int4_info Layout of the weights, as used to generate them
+ * @param[out] dst       Accessor of the destination tensor
+ */
+void pack_int4_weights(const Int4Weights &weights, const Int4WeightsInfo &int4_info, IAccessor &dst);
+
+/** Generate random dense F32 weights with explicit zeros following a sparsity pattern
+ *
+ * With WeightsSparsity::STRUCTURED_2_4, each group of 4 values along K has 2 or 3 zeros. With
+ * WeightsSparsity::BLOCK_4X4, whole blocks of 4 values along K by 4 columns are set to zero.
+ *
+ * @param[in] k                 Number of values of the K dimension
+ * @param[in] n                 Number of output columns
+ * @param[in] sparsity          Sparsity pattern of the weights
+ * @param[in] zero_blocks_ratio Ratio of the blocks set to zero with WeightsSparsity::BLOCK_4X4
+ * @param[in] seed              Seed of the random values and zeros
+ *
+ * @return The weights, of shape [N, K]
+ */
+SimpleTensor<float> generate_sparse_weights(size_t                          k,
+                                            size_t                          n,
+                                            WeightsSparsity                 sparsity,
+                                            float                           zero_blocks_ratio,
+                                            std::random_device::result_type seed);
+
 /** Check if Cpu supports the vectoral operations for the data types in the parameters
  *
  * @param[in] types an initializeer list that contain data types
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #include "arm_compute/core/utils/misc/Traits.h"
 #include "arm_compute/core/utils/StringUtils.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/RuntimeContext.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -106,6 +107,37 @@ void test_float_sqrt_boundary_value()
 
     validate(Accessor(src), reference_dst, tolerance_float_sqrt);
 }
+
+/** Run an in-place quantized activation on a padded tensor with few rows
+ *
+ * The padding prevents the window from being squashed, so the scheduler splits the rows along X between the threads:
+ * each element must still be activated exactly once.
+ */
+template <typename T>
+void test_quantized_in_place_split_x(DataType data_type, const QuantizationInfo &qinfo)
+{
+    const auto shape = TensorShape{ 65536U, 2U };
+    const auto info  = ActivationLayerInfo{ ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f };
+
+    auto src = create_tensor<Tensor>(shape, data_type, 1, qinfo);
+    src.info()->extend_padding(PaddingSize(0, 4, 0, 0));
+
+    auto act = NEActivationLayer{};
+    act.configure(&src, nullptr, info);
+    src.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0);
+
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+    NEScheduler::get().set_num_threads(4);
+    act.run();
+    NEScheduler::get().set_num_threads(num_threads);
+
+    auto reference_src = SimpleTensor<T> { shape, data_type, 1, qinfo };
+    library->fill_tensor_uniform(reference_src, 0);
+    auto reference_dst = reference::activation_layer<T>(reference_src, info, qinfo);
+
+    validate(Accessor(src), reference_dst, helper::tolerance_qasymm8(info.activation()));
+}
 } // namespace
 
 TEST_SUITE(NEON)
@@ -270,6 +302,10 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEActivationLayerQuantizedFixture<uint8_t>, fra
     // Validate output
     validate(Accessor(_target), _reference, helper::tolerance_qasymm8(_function));
 }
+TEST_CASE(InPlaceSplitX, framework::DatasetMode::ALL)
+{
+    test_quantized_in_place_split_x<uint8_t>(DataType::QASYMM8, QuantizationInfo(0.1f, 128));
+}
 TEST_SUITE_END() // QASYMM8
 
 TEST_SUITE(QASYMM8_SIGNED)
@@ -281,6 +317,10 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEActivationLayerQuantizedFixture<int8_t>, fram
     // Validate output
     validate(Accessor(_target), _reference, helper::tolerance_qasymm8(_function));
 }
+TEST_CASE(InPlaceSplitX, framework::DatasetMode::ALL)
+{
+    test_quantized_in_place_split_x<int8_t>(DataType::QASYMM8_SIGNED, QuantizationInfo(0.5f, 10));
+}
 TEST_SUITE_END() // QASYMM8_SIGNED
 
 /** Input data sets. */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/ConsumeWeights.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMConv2d.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
@@ -44,6 +45,8 @@
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/ConvolutionLayerFixture.h"
 #include "tests/validation/fixtures/WinogradConvolutionLayerFixture.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/reference/Permute.h"
 
 namespace arm_compute
 {
@@ -341,6 +344,65 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for the consume weights mode of @ref cpu::CpuWinogradConv2d.
+ *
+ * Checks performed in order:
+ * - The weights are still used after prepare when the mode is disabled
+ * - The weights are marked as unused after prepare when the mode is enabled
+ * - Both configurations compute the same output
+ */
+TEST_CASE(ConsumeWeights, framework::DatasetMode::ALL)
+{
+    const auto          src_info = TensorInfo(TensorShape(8U, 8U, 32U), 1, DataType::F32);
+    const auto          w_info   = TensorInfo(TensorShape(1U), 1, DataType::F32);
+    const auto          b_info   = TensorInfo(TensorShape(1U, 3U, 32U, 1U), 1, DataType::F32);
+    auto                dst_info = TensorInfo(TensorShape(8U, 6U, 1U), 1, DataType::F32);
+    const PadStrideInfo pad_info{};
+
+    auto run_conv = [&](bool consume, bool &weights_used) -> Tensor
+    {
+        set_consume_weights(consume);
+        auto winograd = std::make_unique<cpu::CpuWinogradConv2d>();
+        winograd->configure(&src_info, &b_info, &w_info, &dst_info, pad_info);
+
+        auto a   = create_tensor<Tensor>(src_info);
+        auto b   = create_tensor<Tensor>(b_info);
+        auto c   = create_tensor<Tensor>(w_info);
+        auto dst = create_tensor<Tensor>(dst_info);
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        c.allocator()->allocate();
+        dst.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(a), 0);
+        library->fill_tensor_uniform(Accessor(b), 1);
+        library->fill_tensor_uniform(Accessor(c), 2);
+
+        ITensorPack run_pack{ { TensorType::ACL_SRC_0, &a }, { TensorType::ACL_SRC_1, &b }, { TensorType::ACL_SRC_2, &c }, { TensorType::ACL_DST, &dst } };
+        ITensorPack prep_pack{ { TensorType::ACL_SRC_1, &b }, { TensorType::ACL_SRC_2, &c } };
+
+        auto mg = MemoryGroup{};
+        auto ws = manage_workspace<Tensor>(winograd->workspace(), mg, run_pack, prep_pack);
+        winograd->prepare(prep_pack);
+        weights_used = b.is_used();
+        winograd->run(run_pack);
+        return dst;
+    };
+
+    const bool previous_consume = consume_weights();
+    bool       reference_weights_used{ false };
+    bool       result_weights_used{ true };
+    auto       reference = run_conv(false, reference_weights_used);
+    auto       result    = run_conv(true, result_weights_used);
+    set_consume_weights(previous_consume);
+
+    ARM_COMPUTE_EXPECT(reference_weights_used, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!result_weights_used, framework::LogLevel::ERRORS);
+    for(size_t i = 0; i < reference.info()->tensor_shape().total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(reinterpret_cast<float *>(reference.buffer())[i] == reinterpret_cast<float *>(result.buffer())[i], framework::LogLevel::ERRORS);
+    }
+}
+
 DATA_TEST_CASE(SupportedKernels, framework::DatasetMode::ALL, zip(
                    make("WeightsInfo",
 {
@@ -1263,6 +1325,222 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for the consume weights mode of @ref NEGEMMConvolutionLayer.
+ *
+ * Checks performed in order:
+ * - The weights are still used after prepare when the mode is disabled
+ * - The weights are marked as unused after prepare when the mode is enabled
+ * - Both configurations compute the same output
+ */
+TEST_CASE(ConsumeWeights, framework::DatasetMode::ALL)
+{
+    const auto src_info    = TensorInfo(TensorShape(9U, 9U, 16U), 1, DataType::F32, DataLayout::NCHW);
+    const auto weight_info = TensorInfo(TensorShape(3U, 3U, 16U, 8U), 1, DataType::F32, DataLayout::NCHW);
+    const auto bias_info   = TensorInfo(TensorShape(8U), 1, DataType::F32, DataLayout::NCHW);
+    const auto dst_info    = TensorInfo(TensorShape(9U, 9U, 8U), 1, DataType::F32, DataLayout::NCHW);
+    const auto conv_info   = PadStrideInfo(1, 1, 1, 1);
+    auto       run_conv    = [&](bool consume, bool &weights_used) -> Tensor
+    {
+        set_consume_weights(consume);
+        NEGEMMConvolutionLayer conv;
+        auto                   src    = create_tensor<Tensor>(src_info);
+        auto                   weight = create_tensor<Tensor>(weight_info);
+        auto                   bias   = create_tensor<Tensor>(bias_info);
+        auto                   dst    = create_tensor<Tensor>(dst_info);
+        conv.configure(&src, &weight, &bias, &dst, conv_info);
+        src.allocator()->allocate();
+        weight.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(weight), 1);
+        library->fill_tensor_uniform(Accessor(bias), 2);
+        conv.run();
+        weights_used = weight.is_used();
+        return dst;
+    };
+
+    const bool previous_consume = consume_weights();
+    bool       reference_weights_used{ false };
+    bool       result_weights_used{ true };
+    auto       reference = run_conv(false, reference_weights_used);
+    auto       result    = run_conv(true, result_weights_used);
+    set_consume_weights(previous_consume);
+
+    ARM_COMPUTE_EXPECT(reference_weights_used, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!result_weights_used, framework::LogLevel::ERRORS);
+    for(size_t i = 0; i < reference.info()->tensor_shape().total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(reinterpret_cast<float *>(reference.buffer())[i] == reinterpret_cast<float *>(result.buffer())[i], framework::LogLevel::ERRORS);
+    }
+}
+
+#ifdef __aarch64__
+namespace
+{
+/** Permute a NCHW shape to @p data_layout */
+TensorShape shape_in_layout(TensorShape shape, DataLayout data_layout)
+{
+    if(data_layout == DataLayout::NHWC)
+    {
+        permute(shape, PermutationVector(2U, 0U, 1U));
+    }
+    return shape;
+}
+
+/** Permute a tensor in @p data_layout to NCHW */
+template <typename T>
+SimpleTensor<T> to_nchw(const SimpleTensor<T> &tensor, DataLayout data_layout)
+{
+    return data_layout == DataLayout::NHWC ? reference::permute(tensor, PermutationVector(1U, 2U, 0U)) : tensor;
+}
+
+/** Fill a tensor with uniform values, the S32 biases of the quantized types being kept small */
+template <typename U>
+void fill_dynamic_shapes_tensor(U &&tensor, std::random_device::result_type seed_offset)
+{
+    if(tensor.data_type() == DataType::S32)
+    {
+        library->fill_tensor_uniform(tensor, seed_offset, -100, 100);
+    }
+    else
+    {
+        library->fill_tensor_uniform(tensor, seed_offset);
+    }
+}
+
+/** Configure @ref NEGEMMConvolutionLayer once with dynamic src and dst, then run it with several spatial sizes and
+ *  batch sizes
+ *
+ * @param[in] data_type      Data type of src, weights and dst
+ * @param[in] data_layout    Data layout of src, weights and dst
+ * @param[in] src_qinfo      Quantization info of src, ignored by the float types
+ * @param[in] weights_qinfo  Quantization info of weights, ignored by the float types
+ * @param[in] dst_qinfo      Quantization info of dst, ignored by the float types
+ * @param[in] validate_run   Callable validating dst against the reference of each run
+ */
+template <typename T, typename TB, typename V>
+void run_dynamic_shapes(DataType         data_type,
+                        DataLayout       data_layout,
+                        QuantizationInfo src_qinfo,
+                        QuantizationInfo weights_qinfo,
+                        QuantizationInfo dst_qinfo,
+                        V              &&validate_run)
+{
+    const DataType      bias_type = is_data_type_quantized_asymmetric(data_type) ? DataType::S32 : data_type;
+    const TensorShape   bias_shape(8U);
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+
+    const TensorShape src_shape    = shape_in_layout(TensorShape(9U, 9U, 16U), data_layout);
+    const TensorShape weight_shape = shape_in_layout(TensorShape(3U, 3U, 16U, 8U), data_layout);
+    const TensorShape dst_shape    = shape_in_layout(TensorShape(9U, 9U, 8U), data_layout);
+
+    auto src    = create_tensor<Tensor>(src_shape, data_type, 1, src_qinfo, data_layout);
+    auto weight = create_tensor<Tensor>(weight_shape, data_type, 1, weights_qinfo, data_layout);
+    auto bias   = create_tensor<Tensor>(bias_shape, bias_type, 1, QuantizationInfo(), data_layout);
+    auto dst    = create_tensor<Tensor>(dst_shape, data_type, 1, dst_qinfo, data_layout);
+    src.info()->set_dynamic(true);
+    dst.info()->set_dynamic(true);
+
+    NEGEMMConvolutionLayer conv;
+    conv.configure(&src, &weight, &bias, &dst, conv_info);
+    weight.allocator()->allocate();
+    bias.allocator()->allocate();
+    fill_dynamic_shapes_tensor(Accessor(weight), 1);
+    fill_dynamic_shapes_tensor(Accessor(bias), 2);
+
+    // The reference tensors are filled in the layout of the function, then permuted to NCHW
+    SimpleTensor<T>  ref_weight{ weight_shape, data_type, 1, weights_qinfo, data_layout };
+    SimpleTensor<TB> ref_bias{ bias_shape, bias_type };
+    fill_dynamic_shapes_tensor(ref_weight, 1);
+    fill_dynamic_shapes_tensor(ref_bias, 2);
+    ref_weight = to_nchw(ref_weight, data_layout);
+
+    const std::vector<TensorShape> src_shapes{ TensorShape(9U, 9U, 16U), TensorShape(5U, 7U, 16U, 2U),
+                                               TensorShape(12U, 10U, 16U) };
+    for(unsigned int i = 0; i < src_shapes.size(); ++i)
+    {
+        TensorShape run_dst_shape = src_shapes[i];
+        run_dst_shape.set(2, 8U);
+
+        src.allocator()->free();
+        dst.allocator()->free();
+        src.info()->set_tensor_shape(shape_in_layout(src_shapes[i], data_layout));
+        dst.info()->set_tensor_shape(shape_in_layout(run_dst_shape, data_layout));
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+        fill_dynamic_shapes_tensor(Accessor(src), i);
+
+        conv.run();
+
+        SimpleTensor<T> ref_src{ shape_in_layout(src_shapes[i], data_layout), data_type, 1, src_qinfo, data_layout };
+        fill_dynamic_shapes_tensor(ref_src, i);
+        SimpleTensor<T> reference = reference::convolution_layer<T>(to_nchw(ref_src, data_layout), ref_weight,
+                                                                    ref_bias, run_dst_shape, conv_info, Size2D(1U, 1U),
+                                                                    1, dst_qinfo);
+        if(data_layout == DataLayout::NHWC)
+        {
+            reference = reference::permute(reference, PermutationVector(2U, 0U, 1U));
+        }
+        validate_run(dst, reference);
+    }
+}
+
+const auto DynamicShapesDataLayouts = make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC });
+} // namespace
+
+/** Test cases for @ref NEGEMMConvolutionLayer with dynamic shapes.
+ *
+ * Configure the function once with dynamic src and dst and run it with several spatial sizes and batch sizes. The NHWC
+ * runs write the GEMM output directly to dst, without col2im.
+ *
+ * Checks performed in order:
+ * - Each run matches the reference for its shape
+ */
+TEST_SUITE(DynamicShapes)
+DATA_TEST_CASE(FP32, framework::DatasetMode::ALL, DynamicShapesDataLayouts, data_layout)
+{
+    const auto validate_run = [](Tensor &dst, const SimpleTensor<float> &reference)
+    {
+        validate(Accessor(dst), reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+    };
+    run_dynamic_shapes<float, float>(DataType::F32, data_layout, QuantizationInfo(), QuantizationInfo(),
+                                     QuantizationInfo(), validate_run);
+}
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+DATA_TEST_CASE(FP16, framework::DatasetMode::ALL, DynamicShapesDataLayouts, data_layout)
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        const auto validate_run = [](Tensor &dst, const SimpleTensor<half> &reference)
+        {
+            validate(Accessor(dst), reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+        };
+        run_dynamic_shapes<half, half>(DataType::F16, data_layout, QuantizationInfo(), QuantizationInfo(),
+                                       QuantizationInfo(), validate_run);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+DATA_TEST_CASE(QASYMM8, framework::DatasetMode::ALL, DynamicShapesDataLayouts, data_layout)
+{
+    const auto validate_run = [](Tensor &dst, const SimpleTensor<uint8_t> &reference)
+    {
+        validate(Accessor(dst), reference, tolerance_qasymm8);
+    };
+    run_dynamic_shapes<uint8_t, int32_t>(DataType::QASYMM8, data_layout, QuantizationInfo(1.f / 255.f, 10),
+                                         QuantizationInfo(1.f / 255.f, 127), QuantizationInfo(0.05f, 128),
+                                         validate_run);
+}
+TEST_SUITE_END() // DynamicShapes
+#endif // __aarch64__
+
 TEST_SUITE(Float)
 #if defined(ARM_COMPUTE_ENABLE_BF16)
 TEST_SUITE(BFLOAT16)
@@ -1355,6 +1633,25 @@ FIXTURE_DATA_TEST_CASE(RunVeryLarge, NEGEMMConvolutionLayerFixture<float>, frame
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
 }
 
+/** Grouped pointwise convolutions, computed with one batched GEMM for all the groups */
+TEST_SUITE(Grouped1x1)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerFixture<float>, framework::DatasetMode::ALL,
+    combine(zip(framework::dataset::make("Input", { TensorShape(17U, 13U, 8U, 2U), TensorShape(9U, 9U, 12U), TensorShape(5U, 7U, 16U, 3U), TensorShape(33U, 31U, 6U) }),
+                framework::dataset::make("Weights", { TensorShape(1U, 1U, 4U, 6U), TensorShape(1U, 1U, 3U, 8U), TensorShape(1U, 1U, 1U, 16U), TensorShape(1U, 1U, 2U, 9U) }),
+                framework::dataset::make("Bias", { TensorShape(6U), TensorShape(8U), TensorShape(16U), TensorShape(9U) }),
+                framework::dataset::make("Output", { TensorShape(17U, 13U, 6U, 2U), TensorShape(9U, 9U, 8U), TensorShape(5U, 7U, 16U, 3U), TensorShape(33U, 31U, 9U) })),
+        framework::dataset::make("PadStrideInfo", PadStrideInfo(1, 1, 0, 0)),
+        framework::dataset::make("Dilation", Size2D(1, 1)),
+        framework::dataset::make("ReshapeWeights", { true }),
+        framework::dataset::make("DataType", DataType::F32),
+        framework::dataset::make("DataLayout", { DataLayout::NHWC }),
+        ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // Grouped1x1
+
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 
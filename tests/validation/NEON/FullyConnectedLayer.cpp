@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/PreparedWeightsCache.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "src/core/helpers/MemoryHelpers.h"
@@ -197,6 +198,204 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+#if !defined(_WIN64) && !defined(BARE_METAL)
+/** Test case for @ref NEFullyConnectedLayer using the prepared weights cache.
+ *
+ * Checks performed in order:
+ * - The runs storing the prepared weights to the cache and mapping them back compute the same output as the run
+ *   without cache
+ * - The second configuration maps the weights prepared by the first one
+ */
+TEST_CASE(UsePreparedWeightsCache, framework::DatasetMode::ALL)
+{
+    const TemporaryDirectory directory("/tmp/acl_fc_prepared_weights_");
+
+    const auto src_info    = TensorInfo(TensorShape(67U, 9U), 1, DataType::F32);
+    const auto weight_info = TensorInfo(TensorShape(67U, 45U), 1, DataType::F32);
+    const auto bias_info   = TensorInfo(TensorShape(45U), 1, DataType::F32);
+    const auto dst_info    = TensorInfo(TensorShape(45U, 9U), 1, DataType::F32);
+    auto       run_fc      = [&]()
+    {
+        NEFullyConnectedLayer fc;
+        auto                  src    = create_tensor<Tensor>(src_info);
+        auto                  weight = create_tensor<Tensor>(weight_info);
+        auto                  bias   = create_tensor<Tensor>(bias_info);
+        auto                  dst    = create_tensor<Tensor>(dst_info);
+        fc.configure(&src, &weight, &bias, &dst, FullyConnectedLayerInfo{});
+        src.allocator()->allocate();
+        weight.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(weight), 1);
+        library->fill_tensor_uniform(Accessor(bias), 2);
+        fc.run();
+        return dst;
+    };
+
+    PreparedWeightsCache &cache              = PreparedWeightsCache::get();
+    const std::string     previous_directory = cache.directory();
+    cache.set_directory("");
+    auto reference = run_fc();
+
+    cache.set_directory(directory.path());
+    auto                              result_0 = run_fc();
+    const PreparedWeightsCache::Stats stats_0  = cache.stats();
+    auto                              result_1 = run_fc();
+    const PreparedWeightsCache::Stats stats_1  = cache.stats();
+    cache.set_directory(previous_directory);
+
+    for(size_t i = 0; i < reference.info()->tensor_shape().total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(((float *)reference.buffer())[i] == ((float *)result_0.buffer())[i], framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(((float *)reference.buffer())[i] == ((float *)result_1.buffer())[i], framework::LogLevel::ERRORS);
+    }
+    // The first run stores the prepared weights, the second one maps them back
+    ARM_COMPUTE_EXPECT(stats_0.stores > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats_0.hits == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats_1.hits > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats_1.stores == stats_0.stores, framework::LogLevel::ERRORS);
+}
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
+#ifdef __aarch64__
+namespace
+{
+/** Fill a tensor with uniform values, the S32 biases of the quantized types being kept small */
+template <typename U>
+void fill_dynamic_shapes_tensor(U &&tensor, std::random_device::result_type seed_offset)
+{
+    if(tensor.data_type() == DataType::S32)
+    {
+        library->fill_tensor_uniform(tensor, seed_offset, -100, 100);
+    }
+    else
+    {
+        library->fill_tensor_uniform(tensor, seed_offset);
+    }
+}
+
+/** Configure @ref NEFullyConnectedLayer once with dynamic src and dst, then run it with several batch sizes
+ *
+ * @param[in] data_type     Data type of src, weights and dst
+ * @param[in] sample_shape  Shape of a sample of src. Samples with more than one dimension are flattened
+ * @param[in] src_qinfo     Quantization info of src, ignored by the float types
+ * @param[in] weights_qinfo Quantization info of weights, ignored by the float types
+ * @param[in] dst_qinfo     Quantization info of dst, ignored by the float types
+ * @param[in] validate_run  Callable validating dst against the reference of each run
+ */
+template <typename T, typename TB, typename V>
+void run_dynamic_shapes(DataType           data_type,
+                        const TensorShape &sample_shape,
+                        QuantizationInfo   src_qinfo,
+                        QuantizationInfo   weights_qinfo,
+                        QuantizationInfo   dst_qinfo,
+                        V                &&validate_run)
+{
+    const DataType    bias_type = is_data_type_quantized_asymmetric(data_type) ? DataType::S32 : data_type;
+    const TensorShape weight_shape(sample_shape.total_size(), 45U);
+    const TensorShape bias_shape(45U);
+
+    // Shape of src for a number of samples
+    const auto batched_shape = [&sample_shape](unsigned int batches)
+    {
+        TensorShape shape = sample_shape;
+        shape.set(sample_shape.num_dimensions(), batches);
+        return shape;
+    };
+
+    auto src    = create_tensor<Tensor>(batched_shape(9U), data_type, 1, src_qinfo);
+    auto weight = create_tensor<Tensor>(weight_shape, data_type, 1, weights_qinfo);
+    auto bias   = create_tensor<Tensor>(bias_shape, bias_type);
+    auto dst    = create_tensor<Tensor>(TensorShape(45U, 9U), data_type, 1, dst_qinfo);
+    src.info()->set_dynamic(true);
+    dst.info()->set_dynamic(true);
+
+    NEFullyConnectedLayer fc;
+    fc.configure(&src, &weight, &bias, &dst, FullyConnectedLayerInfo{});
+    weight.allocator()->allocate();
+    bias.allocator()->allocate();
+    fill_dynamic_shapes_tensor(Accessor(weight), 1);
+    fill_dynamic_shapes_tensor(Accessor(bias), 2);
+
+    SimpleTensor<T>  ref_weight{ weight_shape, data_type, 1, weights_qinfo };
+    SimpleTensor<TB> ref_bias{ bias_shape, bias_type };
+    fill_dynamic_shapes_tensor(ref_weight, 1);
+    fill_dynamic_shapes_tensor(ref_bias, 2);
+
+    for(unsigned int batches : { 9U, 4U, 1U, 13U })
+    {
+        src.allocator()->free();
+        dst.allocator()->free();
+        src.info()->set_tensor_shape(batched_shape(batches));
+        dst.info()->set_tensor_shape(TensorShape(45U, batches));
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+        fill_dynamic_shapes_tensor(Accessor(src), batches);
+
+        fc.run();
+
+        SimpleTensor<T> ref_src{ src.info()->tensor_shape(), data_type, 1, src_qinfo };
+        fill_dynamic_shapes_tensor(ref_src, batches);
+        validate_run(dst, reference::fully_connected_layer<T>(ref_src, ref_weight, ref_bias, dst.info()->tensor_shape(),
+                                                              dst_qinfo));
+    }
+}
+} // namespace
+
+/** Test cases for @ref NEFullyConnectedLayer with dynamic shapes.
+ *
+ * Configure the function once with dynamic src and dst and run it with several batch sizes. The 3D samples go through
+ * the flatten of the fully connected layer following a convolution.
+ *
+ * Checks performed in order:
+ * - Each run matches the reference for its batch size
+ */
+TEST_SUITE(DynamicShapes)
+DATA_TEST_CASE(FP32, framework::DatasetMode::ALL, make("SampleShape", { TensorShape(67U), TensorShape(4U, 3U, 5U) }),
+               sample_shape)
+{
+    const auto validate_run = [](Tensor &dst, const SimpleTensor<float> &reference)
+    {
+        validate(Accessor(dst), reference, rel_tolerance_f32, 0, abs_tolerance_f32);
+    };
+    run_dynamic_shapes<float, float>(DataType::F32, sample_shape, QuantizationInfo(), QuantizationInfo(),
+                                     QuantizationInfo(), validate_run);
+}
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_CASE(FP16, framework::DatasetMode::ALL)
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        const auto validate_run = [](Tensor &dst, const SimpleTensor<half> &reference)
+        {
+            validate(Accessor(dst), reference, rel_tolerance_f16, tolerance_num_f16, abs_tolerance_f16);
+        };
+        run_dynamic_shapes<half, half>(DataType::F16, TensorShape(67U), QuantizationInfo(), QuantizationInfo(),
+                                       QuantizationInfo(), validate_run);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+TEST_CASE(QASYMM8, framework::DatasetMode::ALL)
+{
+    const auto validate_run = [](Tensor &dst, const SimpleTensor<uint8_t> &reference)
+    {
+        validate(Accessor(dst), reference, tolerance_qasymm8);
+    };
+    run_dynamic_shapes<uint8_t, int32_t>(DataType::QASYMM8, TensorShape(67U), QuantizationInfo(1.f / 255.f, 10),
+                                         QuantizationInfo(1.f / 255.f, 127), QuantizationInfo(0.05f, 128),
+                                         validate_run);
+}
+TEST_SUITE_END() // DynamicShapes
+#endif // __aarch64__
+
 /** Unit test for @ref cpu::CpuFullyConnected with quantized multipler > 1
  *
  * Tests output correctness.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,15 +21,18 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/StringUtils.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/kernels/CpuGemmInterleave4x4Kernel.h"
 #include "src/cpu/kernels/CpuGemmMatrixMultiplyKernel.h"
 #include "src/cpu/kernels/CpuGemmTranspose1xWKernel.h"
+#include "src/cpu/kernels/assembly/arm_gemm.hpp"
 #include "src/cpu/operators/CpuDynamicGemm.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "tests/NEON/Accessor.h"
@@ -45,6 +48,15 @@
 #include "tests/validation/fixtures/GEMMFixture.h"
 #include "tests/validation/fixtures/GEMMInterleave4x4Fixture.h"
 #include "tests/validation/fixtures/GEMMTranspose1xWFixture.h"
+#include "tests/validation/reference/GEMM.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <unistd.h>
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
 
 namespace arm_compute
 {
@@ -204,6 +216,175 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+#ifdef __aarch64__
+#if !defined(_WIN64) && !defined(BARE_METAL)
+/** Test case for the kernel selection of @ref NEGEMMTuner.
+ *
+ * Checks performed in order:
+ * - The GEMM tuned when it is configured computes the correct output
+ * - The selected kernel is stored in the tuning table and the tuning file
+ * - The tuning table reloaded from the file selects a kernel computing the correct output
+ * - Saving the table keeps the rows added to the file by another process and drops the malformed ones
+ */
+TEST_CASE(Tuner, framework::DatasetMode::ALL)
+{
+    char directory[] = "/tmp/acl_gemm_tuner_XXXXXX";
+    ARM_COMPUTE_ASSERT(mkdtemp(directory) != nullptr);
+    const std::string tuning_file = std::string(directory) + "/tuning.csv";
+
+    NEGEMMTuner      &tuner              = NEGEMMTuner::get();
+    const auto        previous_table     = tuner.tuning_params_table();
+    const std::string previous_file      = tuner.tuning_file();
+    const bool        previous_tune      = tuner.tune_new_kernels();
+    const unsigned    previous_num_iters = tuner.num_iterations();
+    tuner.set_tuning_file("");
+    tuner.clear();
+    tuner.set_tuning_file(tuning_file);
+    tuner.set_tune_new_kernels(true);
+    tuner.set_num_iterations(1);
+
+    const TensorShape lhs_shape(37U, 21U);
+    const TensorShape rhs_shape(29U, 37U);
+    const TensorShape dst_shape(29U, 21U);
+    auto              run_gemm = [&]()
+    {
+        auto lhs = create_tensor<Tensor>(lhs_shape, DataType::F32);
+        auto rhs = create_tensor<Tensor>(rhs_shape, DataType::F32);
+        auto dst = create_tensor<Tensor>(dst_shape, DataType::F32);
+
+        NEGEMM gemm;
+        gemm.configure(&lhs, &rhs, nullptr, &dst, 1.f, 0.f, GEMMInfo{});
+        lhs.allocator()->allocate();
+        rhs.allocator()->allocate();
+        dst.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(lhs), 0);
+        library->fill_tensor_uniform(Accessor(rhs), 1);
+        gemm.run();
+
+        SimpleTensor<float> ref_lhs{ lhs_shape, DataType::F32 };
+        SimpleTensor<float> ref_rhs{ rhs_shape, DataType::F32 };
+        SimpleTensor<float> ref_c{ dst_shape, DataType::F32 };
+        library->fill_tensor_uniform(ref_lhs, 0);
+        library->fill_tensor_uniform(ref_rhs, 1);
+        library->fill_tensor_value(ref_c, 0.f);
+        validate(Accessor(dst), reference::gemm<float>(ref_lhs, ref_rhs, ref_c, 1.f, 0.f), tolerance_f);
+    };
+
+    // Tune the GEMM
+    run_gemm();
+    const auto tuned_table = tuner.tuning_params_table();
+    ARM_COMPUTE_EXPECT(tuned_table.size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!tuned_table.empty() && tuned_table.begin()->first.find("cpus:") != std::string::npos,
+                       framework::LogLevel::ERRORS);
+
+    // Reload the kernel from the tuning file
+    tuner.set_tune_new_kernels(false);
+    tuner.set_tuning_file("");
+    tuner.clear();
+    tuner.load_from_file(tuning_file);
+    ARM_COMPUTE_EXPECT(tuner.tuning_params_table() == tuned_table, framework::LogLevel::ERRORS);
+    run_gemm();
+
+    // Rows written by another process
+    {
+        std::ofstream fs(tuning_file, std::ios::out | std::ios::app);
+        fs << "malformed_row" << std::endl;
+        fs << "other_gemm;other_kernel" << std::endl;
+    }
+    ARM_COMPUTE_EXPECT(tuner.save_to_file(tuning_file), framework::LogLevel::ERRORS);
+    tuner.clear();
+    tuner.load_from_file(tuning_file);
+    auto merged_table          = tuned_table;
+    merged_table["other_gemm"] = "other_kernel";
+    ARM_COMPUTE_EXPECT(tuner.tuning_params_table() == merged_table, framework::LogLevel::ERRORS);
+
+    tuner.clear();
+    tuner.import_tuning_params(previous_table);
+    tuner.set_tuning_file(previous_file);
+    tuner.set_tune_new_kernels(previous_tune);
+    tuner.set_num_iterations(previous_num_iters);
+    std::remove(tuning_file.c_str());
+    rmdir(directory);
+}
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
+/** Test case for the blocking of the GEMM rows for the cache beyond L2.
+ *
+ * Checks performed in order:
+ * - The interleaved kernel configured with small cache sizes splits the rows into blocks sized for the L3 cache
+ * - The blocked GEMM computes the correct output
+ */
+TEST_CASE(L3Blocking, framework::DatasetMode::ALL)
+{
+    // Small caches, so that the rows of the GEMM are processed in several blocks sized for the L3 cache. The
+    // interleaved kernel is the one blocking the rows, so it is used directly, with all the rows run by one thread.
+    constexpr unsigned int M = 600;
+    constexpr unsigned int N = 240;
+    constexpr unsigned int K = 256;
+
+    CPUInfo           &cpu_info = CPUInfo::get();
+    const unsigned int L1_size  = cpu_info.get_L1_cache_size();
+    const unsigned int L2_size  = cpu_info.get_L2_cache_size();
+    const unsigned int L3_size  = cpu_info.get_L3_cache_size();
+    const unsigned int L3_cpus  = cpu_info.get_L3_cache_shared_cpus();
+    cpu_info.set_cache_sizes(32768, 32768, 262144, 1);
+
+    arm_gemm::GemmConfig cfg(arm_gemm::GemmMethod::GEMM_INTERLEAVED);
+    cfg.filter = "a64_sgemm_8x12";
+    const arm_gemm::GemmArgs args(&cpu_info, M, N, K, 1, 1, 1, false, arm_gemm::Activation(), 1, false, false, false,
+                                  &cfg);
+    auto gemm = arm_gemm::gemm<float, float, float>(args);
+    cpu_info.set_cache_sizes(L1_size, L2_size, L3_size, L3_cpus);
+    ARM_COMPUTE_ASSERT(gemm != nullptr);
+
+    // K fits in a single K block, and half of the L3 holds (131072 / (256 * 4)) = 128 rows of it, a multiple of the
+    // 8 rows of the kernel, so the 600 rows are split into 5 M blocks.
+    const arm_gemm::GemmConfig gemm_cfg = gemm->get_config();
+    ARM_COMPUTE_EXPECT(gemm_cfg.inner_block_size == K, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(gemm_cfg.m_block_size == 128, framework::LogLevel::ERRORS);
+
+    const TensorShape lhs_shape(K, M);
+    const TensorShape rhs_shape(N, K);
+    const TensorShape dst_shape(N, M);
+    auto              lhs = create_tensor<Tensor>(lhs_shape, DataType::F32);
+    auto              rhs = create_tensor<Tensor>(rhs_shape, DataType::F32);
+    auto              dst = create_tensor<Tensor>(dst_shape, DataType::F32);
+    lhs.allocator()->allocate();
+    rhs.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(lhs), 0);
+    library->fill_tensor_uniform(Accessor(rhs), 1);
+
+    std::vector<uint8_t> pretransposed_rhs(gemm->get_B_pretransposed_array_size());
+    std::vector<uint8_t> working_space(gemm->get_working_size());
+    const auto          *rhs_ptr = reinterpret_cast<const float *>(rhs.buffer());
+    gemm->set_arrays(reinterpret_cast<const float *>(lhs.buffer()), K, M * K, M * K, rhs_ptr, N, N * K,
+                     reinterpret_cast<float *>(dst.buffer()), N, M * N, M * N, nullptr, 0);
+    gemm->set_working_space(working_space.data());
+    if (gemm->B_pretranspose_required())
+    {
+        gemm->pretranspose_B_array(pretransposed_rhs.data(), rhs_ptr, N, N * K, false);
+    }
+
+    const arm_gemm::ndrange_t window = gemm->get_window_size();
+    gemm->execute({{0, window.get_size(0)},
+                   {0, window.get_size(1)},
+                   {0, window.get_size(2)},
+                   {0, window.get_size(3)},
+                   {0, window.get_size(4)},
+                   {0, window.get_size(5)}},
+                  arm_gemm::ndcoord_t{}, 0);
+
+    SimpleTensor<float> ref_lhs{ lhs_shape, DataType::F32 };
+    SimpleTensor<float> ref_rhs{ rhs_shape, DataType::F32 };
+    SimpleTensor<float> ref_c{ dst_shape, DataType::F32 };
+    library->fill_tensor_uniform(ref_lhs, 0);
+    library->fill_tensor_uniform(ref_rhs, 1);
+    library->fill_tensor_value(ref_c, 0.f);
+    validate(Accessor(dst), reference::gemm<float>(ref_lhs, ref_rhs, ref_c, 1.f, 0.f), tolerance_f);
+}
+#endif // __aarch64__
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
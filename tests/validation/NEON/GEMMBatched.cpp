@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/GEMMBatchedInfo.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMBatched.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/GEMMFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr RelativeTolerance<float> rel_tolerance_f32(0.001f);  /**< Relative tolerance for F32 */
+constexpr float                    abs_tolerance_f32(0.0001f); /**< Absolute tolerance for F32 */
+
+const auto ActivationFunctions =
+    make("ActivationInfo",
+         {ActivationLayerInfo(), ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.5f, -0.5f)});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(GEMMBatched)
+
+// clang-format off
+// *INDENT-OFF*
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
+    zip(
+        make("AInfo", {
+            TensorInfo(TensorShape(64U), 1, DataType::F32),
+            TensorInfo(TensorShape(64U), 1, DataType::F16),  // Unsupported data type
+            TensorInfo(TensorShape(60U), 1, DataType::F32),  // A view out of bounds
+            TensorInfo(TensorShape(64U), 1, DataType::F32),  // D view out of bounds
+            TensorInfo(TensorShape(64U), 1, DataType::F32),  // Uninitialized D
+            TensorInfo(TensorShape(64U), 1, DataType::F32),  // Unsupported activation
+        }),
+        make("BInfo", {
+            TensorInfo(TensorShape(128U), 1, DataType::F32),
+            TensorInfo(TensorShape(128U), 1, DataType::F16),
+            TensorInfo(TensorShape(128U), 1, DataType::F32),
+            TensorInfo(TensorShape(128U), 1, DataType::F32),
+            TensorInfo(TensorShape(128U), 1, DataType::F32),
+            TensorInfo(TensorShape(128U), 1, DataType::F32),
+        }),
+        make("DInfo", {
+            TensorInfo(TensorShape(64U), 1, DataType::F32),
+            TensorInfo(TensorShape(64U), 1, DataType::F16),
+            TensorInfo(TensorShape(64U), 1, DataType::F32),
+            TensorInfo(TensorShape(63U), 1, DataType::F32),
+            TensorInfo(),
+            TensorInfo(TensorShape(64U), 1, DataType::F32),
+        }),
+        make("ActivationInfo", {
+            ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+            ActivationLayerInfo(),
+            ActivationLayerInfo(),
+            ActivationLayerInfo(),
+            ActivationLayerInfo(),
+            ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH),
+        }),
+        make("Expected", { true, false, false, false, false, false })),
+    a_info, b_info, d_info, act_info, expected)
+{
+    // Two 4x8 problems with a K of 8, each one using its own half of the B matrices
+    const std::vector<GEMMBatchedProblem> problems{GEMMBatchedProblem(4U, 8U, 8U, 0U, 0U, 0U),
+                                                   GEMMBatchedProblem(4U, 8U, 8U, 32U, 64U, 32U)};
+
+    GEMMInfo gemm_info;
+    gemm_info.set_activation_info(act_info);
+
+    const Status status = NEGEMMBatched::validate(&a_info.clone()->set_is_resizable(true),
+                                                  &b_info.clone()->set_is_resizable(true),
+                                                  nullptr,
+                                                  &d_info.clone()->set_is_resizable(true),
+                                                  problems, gemm_info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEGEMMBatchedFixture = GEMMBatchedValidationFixture<Tensor, Accessor, NEGEMMBatched, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEGEMMBatchedFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(make("NumProblems", {1U, 7U, 64U}),
+                               make("SharedRhs", false),
+                               make("Strided", {false, true}),
+                               make("HasBias", {false, true}),
+                               ActivationFunctions,
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSharedRhs,
+                       NEGEMMBatchedFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(make("NumProblems", {5U, 33U}),
+                               make("SharedRhs", true),
+                               make("Strided", {false, true}),
+                               make("HasBias", true),
+                               make("ActivationInfo", ActivationLayerInfo()),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge,
+                       NEGEMMBatchedFixture<float>,
+                       framework::DatasetMode::NIGHTLY,
+                       combine(make("NumProblems", 2000U),
+                               make("SharedRhs", {false, true}),
+                               make("Strided", false),
+                               make("HasBias", true),
+                               make("ActivationInfo",
+                                    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+TEST_SUITE_END() // GEMMBatched
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEMatMul.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/FullyConnectedLayerFixture.h"
+#include "tests/validation/fixtures/GEMMFixture.h"
+#include "tests/validation/fixtures/MatMulFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr RelativeTolerance<float> rel_tolerance_f32(0.001f);      /**< Relative tolerance for F32 */
+constexpr float                    abs_tolerance_f32(0.0001f);     /**< Absolute tolerance for F32 */
+constexpr RelativeTolerance<float> rel_tolerance_fast_math(0.02f); /**< Relative tolerance with an 8-bit lhs */
+constexpr float                    abs_tolerance_fast_math(0.05f); /**< Absolute tolerance with an 8-bit lhs */
+#ifdef ARM_COMPUTE_ENABLE_FP16
+const RelativeTolerance<half_float::half> rel_tolerance_f16(half(0.01f)); /**< Relative tolerance for F16 */
+constexpr float                           abs_tolerance_f16(0.01f);      /**< Absolute tolerance for F16 */
+const RelativeTolerance<half_float::half> rel_tolerance_f16_fast_math(
+    half(0.02f)); /**< Relative tolerance for F16 with an 8-bit lhs */
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+/** K is chosen to cover full groups as well as partially filled last groups */
+const auto LhsShapes = make("LhsShape", {TensorShape(64U, 1U), TensorShape(75U, 4U), TensorShape(200U, 13U)});
+/** Batched lhs, the weights are shared by all the batches */
+const auto BatchedLhsShapes = make("LhsShape", {TensorShape(96U, 3U, 2U), TensorShape(128U, 6U, 3U)});
+const auto OutputChannels   = make("N", {7U, 33U});
+const auto GroupSizes       = make("GroupSize", {32U, 128U});
+const auto WeightsFormats =
+    combine(make("ScaleDataType", {DataType::F32, DataType::F16}), make("HasZeroPoints", {false, true}));
+const auto ActivationFunctions =
+    make("ActivationInfo", {ActivationLayerInfo(), ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(GEMMInt4)
+
+// clang-format off
+// *INDENT-OFF*
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
+    zip(
+        make("LhsInfo", {
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),     // Invalid row size
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),     // Group size not a multiple of 32
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::QASYMM8), // Unsupported lhs data type
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),     // Mismatching data types
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),     // Bias is not a vector
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),     // F16 scales and zero points
+        }),
+        make("RhsInfo", {
+            TensorInfo(TensorShape(40U, 8U), 1, DataType::U8),
+            TensorInfo(TensorShape(36U, 8U), 1, DataType::U8),
+            TensorInfo(TensorShape(56U, 8U), 1, DataType::U8),
+            TensorInfo(TensorShape(40U, 8U), 1, DataType::U8),
+            TensorInfo(TensorShape(40U, 8U), 1, DataType::U8),
+            TensorInfo(TensorShape(40U, 8U), 1, DataType::U8),
+            TensorInfo(TensorShape(38U, 8U), 1, DataType::U8),
+        }),
+        make("BiasInfo", {
+            TensorInfo(TensorShape(8U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U), 1, DataType::F32),
+        }),
+        make("OutputInfo", {
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::QASYMM8),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F16),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+        }),
+        make("Int4WeightsInfo", {
+            Int4WeightsInfo(32U),
+            Int4WeightsInfo(32U),
+            Int4WeightsInfo(48U),
+            Int4WeightsInfo(32U),
+            Int4WeightsInfo(32U),
+            Int4WeightsInfo(32U),
+            Int4WeightsInfo(32U, DataType::F16, true),
+        }),
+        make("Expected", { true, false, false, false, false, false, true })),
+    lhs_info, rhs_info, bias_info, output_info, int4_info, expected)
+{
+    GEMMInfo gemm_info;
+    gemm_info.set_int4_weights_info(int4_info);
+
+    const Status status = NEGEMM::validate(&lhs_info.clone()->set_is_resizable(true),
+                                           &rhs_info.clone()->set_is_resizable(true),
+                                           &bias_info.clone()->set_is_resizable(true),
+                                           &output_info.clone()->set_is_resizable(true),
+                                           1.f, 1.f, gemm_info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEGEMMInt4Fixture = GEMMInt4ValidationFixture<Tensor, Accessor, NEGEMM, T>;
+
+template <typename T>
+using NEFullyConnectedLayerInt4Fixture =
+    FullyConnectedInt4ValidationFixture<Tensor, Accessor, NEFullyConnectedLayer, T>;
+
+template <typename T>
+using NEMatMulInt4Fixture = MatMulInt4ValidationFixture<Tensor, Accessor, NEMatMul, CpuMatMulSettings, T>;
+
+TEST_SUITE(GEMM)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEGEMMInt4Fixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(LhsShapes,
+                               OutputChannels,
+                               GroupSizes,
+                               WeightsFormats,
+                               make("HasBias", {false, true}),
+                               make("FastMath", false),
+                               ActivationFunctions,
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallBatched,
+                       NEGEMMInt4Fixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(BatchedLhsShapes,
+                               OutputChannels,
+                               make("GroupSize", 64U),
+                               WeightsFormats,
+                               make("HasBias", true),
+                               make("FastMath", false),
+                               make("ActivationInfo", ActivationLayerInfo()),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallFastMath,
+                       NEGEMMInt4Fixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(LhsShapes,
+                               OutputChannels,
+                               GroupSizes,
+                               WeightsFormats,
+                               make("HasBias", true),
+                               make("FastMath", true),
+                               ActivationFunctions,
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_fast_math, 0.f, abs_tolerance_fast_math);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEGEMMInt4Fixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(LhsShapes,
+                               OutputChannels,
+                               GroupSizes,
+                               WeightsFormats,
+                               make("HasBias", true),
+                               make("FastMath", false),
+                               make("ActivationInfo", ActivationLayerInfo()),
+                               make("DataType", DataType::F16)))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, 0.f, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunSmallFastMath,
+                       NEGEMMInt4Fixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(LhsShapes,
+                               OutputChannels,
+                               GroupSizes,
+                               WeightsFormats,
+                               make("HasBias", true),
+                               make("FastMath", true),
+                               make("ActivationInfo", ActivationLayerInfo()),
+                               make("DataType", DataType::F16)))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16_fast_math, 0.f, abs_tolerance_fast_math);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // GEMM
+
+TEST_SUITE(FullyConnectedLayer)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEFullyConnectedLayerInt4Fixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(LhsShapes,
+                               OutputChannels,
+                               GroupSizes,
+                               make("ScaleDataType", DataType::F32),
+                               make("HasZeroPoints", true),
+                               make("HasBias", {false, true}),
+                               make("FastMath", false),
+                               ActivationFunctions,
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // FullyConnectedLayer
+
+TEST_SUITE(MatMul)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEMatMulInt4Fixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(concat(LhsShapes, BatchedLhsShapes),
+                               OutputChannels,
+                               make("GroupSize", 64U),
+                               make("ScaleDataType", DataType::F16),
+                               make("HasZeroPoints", false),
+                               make("ConstantWeights", {false, true}),
+                               make("FastMath", false),
+                               ActivationFunctions,
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallFastMath,
+                       NEMatMulInt4Fixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(concat(LhsShapes, BatchedLhsShapes),
+                               OutputChannels,
+                               make("GroupSize", 64U),
+                               make("ScaleDataType", DataType::F16),
+                               make("HasZeroPoints", false),
+                               make("ConstantWeights", {false, true}),
+                               make("FastMath", true),
+                               ActivationFunctions,
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_fast_math, 0.f, abs_tolerance_fast_math);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // MatMul
+
+TEST_SUITE_END() // GEMMInt4
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/FullyConnectedLayerFixture.h"
+#include "tests/validation/fixtures/GEMMFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr RelativeTolerance<float> rel_tolerance_f32(0.001f);  /**< Relative tolerance for F32 */
+constexpr float                    abs_tolerance_f32(0.0001f); /**< Absolute tolerance for F32 */
+
+/** K is chosen to cover full groups of 4 values as well as a partially filled last group */
+const auto LhsShapes = make("LhsShape", {TensorShape(64U, 1U), TensorShape(75U, 4U), TensorShape(130U, 13U)});
+/** Batched lhs, the weights are shared by all the batches */
+const auto BatchedLhsShapes = make("LhsShape", {TensorShape(96U, 3U, 2U), TensorShape(33U, 6U, 3U)});
+const auto OutputChannels   = make("N", {7U, 33U});
+/** Block-sparse weights with 50% and 90% of zero blocks, and 2:4 structured weights */
+const auto SparsityPatterns =
+    concat(combine(make("Sparsity", WeightsSparsity::BLOCK_4X4), make("ZeroBlocksRatio", {0.5f, 0.9f})),
+           combine(make("Sparsity", WeightsSparsity::STRUCTURED_2_4), make("ZeroBlocksRatio", 0.f)));
+const auto ActivationFunctions =
+    make("ActivationInfo", {ActivationLayerInfo(), ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(GEMMSparse)
+
+// clang-format off
+// *INDENT-OFF*
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
+    zip(
+        make("LhsInfo", {
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F16),  // Unsupported data type
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),  // Batched weights
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),  // Mismatching K
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),  // Bias is not a vector
+            TensorInfo(TensorShape(64U, 4U), 1, DataType::F32),  // Alpha is not 1
+        }),
+        make("RhsInfo", {
+            TensorInfo(TensorShape(8U, 64U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 64U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 64U), 1, DataType::F16),
+            TensorInfo(TensorShape(8U, 64U, 2U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 60U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 64U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 64U), 1, DataType::F32),
+        }),
+        make("BiasInfo", {
+            TensorInfo(TensorShape(8U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U), 1, DataType::F16),
+            TensorInfo(TensorShape(8U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U), 1, DataType::F32),
+        }),
+        make("OutputInfo", {
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F16),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+        }),
+        make("Sparsity", {
+            WeightsSparsity::BLOCK_4X4,
+            WeightsSparsity::STRUCTURED_2_4,
+            WeightsSparsity::BLOCK_4X4,
+            WeightsSparsity::BLOCK_4X4,
+            WeightsSparsity::STRUCTURED_2_4,
+            WeightsSparsity::BLOCK_4X4,
+            WeightsSparsity::BLOCK_4X4,
+        }),
+        make("Alpha", { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 2.f }),
+        make("Expected", { true, true, false, false, false, false, false })),
+    lhs_info, rhs_info, bias_info, output_info, sparsity, alpha, expected)
+{
+    GEMMInfo gemm_info;
+    gemm_info.set_weights_sparsity(sparsity);
+
+    const Status status = NEGEMM::validate(&lhs_info.clone()->set_is_resizable(true),
+                                           &rhs_info.clone()->set_is_resizable(true),
+                                           &bias_info.clone()->set_is_resizable(true),
+                                           &output_info.clone()->set_is_resizable(true),
+                                           alpha, 1.f, gemm_info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+/** Weights with more than 2 non-zero values in a group of 4 along K are rejected instead of being pruned, and valid
+ * weights are accepted again afterwards
+ */
+DATA_TEST_CASE(RejectDense2_4Weights,
+               framework::DatasetMode::ALL,
+               make("ConstantWeights", {true, false}),
+               constant_weights)
+{
+    Tensor a   = create_tensor<Tensor>(TensorShape(64U, 4U), DataType::F32);
+    Tensor b   = create_tensor<Tensor>(TensorShape(8U, 64U), DataType::F32);
+    Tensor dst = create_tensor<Tensor>(TensorShape(8U, 4U), DataType::F32);
+    b.info()->set_are_values_constant(constant_weights);
+
+    GEMMInfo gemm_info;
+    gemm_info.set_weights_sparsity(WeightsSparsity::STRUCTURED_2_4);
+
+    NEGEMM gemm;
+    gemm.configure(&a, &b, nullptr, &dst, 1.f, 1.f, gemm_info);
+
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    std::uniform_real_distribution<float> distribution(0.5f, 1.0f);
+    library->fill(Accessor(a), distribution, 0);
+    library->fill(Accessor(b), distribution, 1);
+
+    bool exception_caught = false;
+    try
+    {
+        gemm.run();
+    }
+    catch (const std::exception &)
+    {
+        exception_caught = true;
+    }
+    ARM_COMPUTE_EXPECT(exception_caught, framework::LogLevel::ERRORS);
+
+    // The rejected weights must not make the next run on valid weights fail
+    library->fill_tensor_value(Accessor(b), 0.f);
+    exception_caught = false;
+    try
+    {
+        gemm.run();
+    }
+    catch (const std::exception &)
+    {
+        exception_caught = true;
+    }
+    ARM_COMPUTE_EXPECT(!exception_caught, framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEGEMMSparseFixture = GEMMSparseValidationFixture<Tensor, Accessor, NEGEMM, T>;
+
+template <typename T>
+using NEFullyConnectedLayerSparseFixture =
+    FullyConnectedSparseValidationFixture<Tensor, Accessor, NEFullyConnectedLayer, T>;
+
+TEST_SUITE(GEMM)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEGEMMSparseFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(LhsShapes,
+                               OutputChannels,
+                               SparsityPatterns,
+                               make("HasBias", {false, true}),
+                               ActivationFunctions,
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallBatched,
+                       NEGEMMSparseFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(BatchedLhsShapes,
+                               OutputChannels,
+                               SparsityPatterns,
+                               make("HasBias", true),
+                               make("ActivationInfo", ActivationLayerInfo()),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // GEMM
+
+TEST_SUITE(FullyConnectedLayer)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEFullyConnectedLayerSparseFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(LhsShapes,
+                               OutputChannels,
+                               SparsityPatterns,
+                               make("HasBias", {false, true}),
+                               ActivationFunctions,
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // FullyConnectedLayer
+
+TEST_SUITE_END() // GEMMSparse
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2022-2025 Arm Limited.
+ * Copyright (c) 2017-2020, 2022-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -317,6 +317,41 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NESoftmaxLayerFixture<float>, framework::Datase
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+
+/** Test case for the in-place computation of @ref NESoftmaxLayer
+ *
+ * Checks performed in order:
+ * - The in-place softmax computes the same output as the out-of-place one
+ */
+DATA_TEST_CASE(RunInPlace, framework::DatasetMode::ALL, make("Axis", { 0, 1 }), axis)
+{
+    const TensorInfo info(TensorShape(27U, 13U, 2U), 1, DataType::F32);
+
+    Tensor src    = create_tensor<Tensor>(info);
+    Tensor dst    = create_tensor<Tensor>(info);
+    Tensor in_out = create_tensor<Tensor>(info);
+
+    NESoftmaxLayer softmax;
+    NESoftmaxLayer softmax_in_place;
+    softmax.configure(&src, &dst, 1.f, axis);
+    softmax_in_place.configure(&in_out, &in_out, 1.f, axis);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    in_out.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0);
+    library->fill_tensor_uniform(Accessor(in_out), 0);
+
+    softmax.run();
+    softmax_in_place.run();
+
+    const auto *dst_ptr    = reinterpret_cast<const float *>(dst.buffer());
+    const auto *in_out_ptr = reinterpret_cast<const float *>(in_out.buffer());
+    for (size_t i = 0; i < info.tensor_shape().total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(dst_ptr[i] == in_out_ptr[i], framework::LogLevel::ERRORS);
+    }
+}
 TEST_SUITE_END() //FP32
 TEST_SUITE_END() //Float
 
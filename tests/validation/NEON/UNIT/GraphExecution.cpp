@@ -0,0 +1,572 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/MemoryFootprint.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/graph/backends/NEON/NETensorHandle.h"
+#include "arm_compute/runtime/PreparedWeightsCache.h"
+
+#include "src/graph/detail/BranchExecutor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Copy values to the graph input at each run */
+class VectorInputAccessor final : public graph::ITensorAccessor
+{
+public:
+    explicit VectorInputAccessor(const std::vector<float> &values) : _values(values)
+    {
+    }
+    bool access_tensor(ITensor &tensor) override
+    {
+        const TensorShape &shape = tensor.info()->tensor_shape();
+        Accessor           accessor(tensor);
+        for (size_t i = 0; i < shape.total_size(); ++i)
+        {
+            *reinterpret_cast<float *>(accessor(index2coord(shape, i))) = _values[i];
+        }
+        return true;
+    }
+
+private:
+    const std::vector<float> &_values;
+};
+
+/** Copy the graph output and stop the execution */
+class VectorOutputAccessor final : public graph::ITensorAccessor
+{
+public:
+    explicit VectorOutputAccessor(std::vector<float> &values) : _values(values)
+    {
+    }
+    bool access_tensor(ITensor &tensor) override
+    {
+        const TensorShape &shape = tensor.info()->tensor_shape();
+        Accessor           accessor(tensor);
+        _values.resize(shape.total_size());
+        for (size_t i = 0; i < shape.total_size(); ++i)
+        {
+            _values[i] = *reinterpret_cast<const float *>(accessor(index2coord(shape, i)));
+        }
+        return false;
+    }
+
+private:
+    std::vector<float> &_values;
+};
+
+std::vector<float> random_values(size_t size, unsigned int seed_offset = 0)
+{
+    std::mt19937                          gen(library->seed() + seed_offset);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float>                    values(size);
+    for (auto &v : values)
+    {
+        v = dist(gen);
+    }
+    return values;
+}
+
+/** Build a graph with two independent branches: output = RELU(input) + (2 * input + 1) */
+void build_branches_graph(graph::Graph             &g,
+                          const TensorShape        &shape,
+                          const std::vector<float> &input,
+                          std::vector<float>       &output)
+{
+    const graph::NodeParams params{"", graph::Target::NEON};
+
+    const graph::NodeID input_id = graph::GraphBuilder::add_input_node(
+        g, params, graph::TensorDescriptor(shape, DataType::F32), std::make_unique<VectorInputAccessor>(input));
+    const graph::NodeID relu_id = graph::GraphBuilder::add_activation_node(
+        g, params, {input_id, 0}, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    const graph::NodeID linear_id = graph::GraphBuilder::add_activation_node(
+        g, params, {input_id, 0}, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, 2.f, 1.f));
+    const graph::NodeID add_id    = graph::GraphBuilder::add_elementwise_node(g, params, {relu_id, 0}, {linear_id, 0},
+                                                                              graph::EltwiseOperation::Add);
+    graph::GraphBuilder::add_output_node(g, params, {add_id, 0}, std::make_unique<VectorOutputAccessor>(output));
+}
+
+float branches_reference(float x)
+{
+    return std::max(x, 0.f) + (2.f * x + 1.f);
+}
+
+/** Build a graph whose samples are computed independently: output = FC(RELU(conv(input)) + (2 * conv(input) + 1))
+ *
+ * @note @p weights holds the values of all the weights and biases, it must be larger than each of them
+ */
+void build_batch_graph(graph::Graph             &g,
+                       const TensorShape        &shape,
+                       const std::vector<float> &input,
+                       const std::vector<float> &weights,
+                       std::vector<float>       &output)
+{
+    const graph::NodeParams params{"", graph::Target::NEON};
+
+    const graph::NodeID input_id = graph::GraphBuilder::add_input_node(
+        g, params, graph::TensorDescriptor(shape, DataType::F32), std::make_unique<VectorInputAccessor>(input));
+    const graph::NodeID conv_id = graph::GraphBuilder::add_convolution_node(
+        g, params, {input_id, 0}, Size2D(3U, 3U), 8U, PadStrideInfo(1, 1, 1, 1), 1,
+        graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+        std::make_unique<VectorInputAccessor>(weights), std::make_unique<VectorInputAccessor>(weights));
+    const graph::NodeID relu_id = graph::GraphBuilder::add_activation_node(
+        g, params, {conv_id, 0}, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    const graph::NodeID linear_id = graph::GraphBuilder::add_activation_node(
+        g, params, {conv_id, 0}, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, 2.f, 1.f));
+    const graph::NodeID add_id    = graph::GraphBuilder::add_elementwise_node(g, params, {relu_id, 0}, {linear_id, 0},
+                                                                              graph::EltwiseOperation::Add);
+    const graph::NodeID fc_id     = graph::GraphBuilder::add_fully_connected_layer(
+        g, params, {add_id, 0}, 10U, std::make_unique<VectorInputAccessor>(weights),
+        std::make_unique<VectorInputAccessor>(weights));
+    graph::GraphBuilder::add_output_node(g, params, {fc_id, 0}, std::make_unique<VectorOutputAccessor>(output));
+}
+
+/** Buffer laid out with the strides of a tensor, used as external memory of the tensor */
+class ExternalBuffer
+{
+public:
+    ExternalBuffer(const ITensorInfo &info, const std::vector<float> &values)
+        : _data((info.total_size() + sizeof(float) - 1) / sizeof(float))
+    {
+        const TensorShape &shape = info.tensor_shape();
+        for (size_t i = 0; i < shape.total_size(); ++i)
+        {
+            *reinterpret_cast<float *>(data() + info.offset_element_in_bytes(index2coord(shape, i))) = values[i];
+        }
+    }
+    uint8_t *data()
+    {
+        return reinterpret_cast<uint8_t *>(_data.data());
+    }
+
+private:
+    std::vector<float> _data;
+};
+
+/** Accessor providing the memory of a constant tensor, or filling it if the memory isn't imported */
+class ImportAccessor final : public graph::ITensorAccessor
+{
+public:
+    ImportAccessor(const std::vector<float> &values, bool import) : _values(values), _import(import)
+    {
+    }
+    void *memory_to_import(const ITensorInfo &info) override
+    {
+        if (!_import)
+        {
+            return nullptr;
+        }
+        _buffer = std::make_unique<ExternalBuffer>(info, _values);
+        return _buffer->data();
+    }
+    bool access_tensor(ITensor &tensor) override
+    {
+        ++_num_accesses;
+        const TensorShape &shape = tensor.info()->tensor_shape();
+        Accessor           accessor(tensor);
+        for (size_t i = 0; i < shape.total_size(); ++i)
+        {
+            *reinterpret_cast<float *>(accessor(index2coord(shape, i))) = _values[i];
+        }
+        return true;
+    }
+    /** Memory provided to the tensor, nullptr if none */
+    const uint8_t *imported() const
+    {
+        return _buffer != nullptr ? _buffer->data() : nullptr;
+    }
+    /** Number of times the tensor has been filled */
+    unsigned int num_accesses() const
+    {
+        return _num_accesses;
+    }
+
+private:
+    const std::vector<float>       &_values;
+    const bool                      _import;
+    std::unique_ptr<ExternalBuffer> _buffer{nullptr};
+    unsigned int                    _num_accesses{0};
+};
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphExecution)
+
+TEST_CASE(ConcurrentBranchesStages, framework::DatasetMode::ALL)
+{
+    const TensorShape  shape(16U, 8U, 3U);
+    std::vector<float> input = random_values(shape.total_size());
+    std::vector<float> output;
+
+    graph::Graph g(0, "Branches");
+    build_branches_graph(g, shape, input, output);
+
+    graph::GraphConfig config;
+    config.max_concurrent_branches = 4;
+    graph::GraphContext ctx;
+    ctx.set_config(config);
+
+    graph::force_target_to_graph(g, graph::Target::NEON);
+    graph::setup_requested_backend_context(ctx, graph::Target::NEON);
+    graph::detail::configure_all_tensors(g);
+    graph::ExecutionWorkload workload = graph::detail::configure_all_nodes(g, ctx, graph::dfs(g));
+    graph::detail::configure_execution_stages(g, workload, config.max_concurrent_branches);
+
+    // The two activations run together, then the addition
+    ARM_COMPUTE_EXPECT(workload.stages == std::vector<unsigned int>({2U, 1U}), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(workload.branch_executor != nullptr);
+    ARM_COMPUTE_EXPECT(workload.branch_executor->num_lanes() == 2U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(workload.tasks[2].node->type() == graph::NodeType::EltwiseLayer, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ConcurrentBranchesResult, framework::DatasetMode::ALL)
+{
+    const TensorShape        shape(16U, 8U, 3U);
+    const std::vector<float> input = random_values(shape.total_size());
+
+    for (unsigned int max_concurrent_branches : {1U, 2U})
+    {
+        std::vector<float> output;
+        graph::Graph       g(0, "Branches");
+        build_branches_graph(g, shape, input, output);
+
+        graph::GraphConfig config;
+        config.max_concurrent_branches = max_concurrent_branches;
+        graph::GraphContext ctx;
+        ctx.set_config(config);
+
+        graph::PassManager  pm = graph::create_default_pass_manager(graph::Target::NEON, config);
+        graph::GraphManager manager;
+        manager.finalize_graph(g, ctx, pm, graph::Target::NEON);
+        manager.execute_graph(g);
+
+        ARM_COMPUTE_ASSERT(output.size() == input.size());
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            ARM_COMPUTE_EXPECT(std::abs(output[i] - branches_reference(input[i])) < 1e-5f,
+                               framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+TEST_SUITE(DynamicBatch)
+/** Validate that the smaller batches are configured with the stages of the whole batch */
+TEST_CASE(Stages, framework::DatasetMode::ALL)
+{
+    const TensorShape        shape(8U, 8U, 4U, 4U);
+    const std::vector<float> input   = random_values(shape.total_size());
+    const std::vector<float> weights = random_values(8192, 1);
+    std::vector<float>       output;
+
+    graph::Graph g(0, "DynamicBatch");
+    build_batch_graph(g, shape, input, weights, output);
+
+    graph::GraphConfig config;
+    config.max_concurrent_branches = 2;
+    config.dynamic_batch           = true;
+    graph::GraphContext ctx;
+    ctx.set_config(config);
+
+    graph::force_target_to_graph(g, graph::Target::NEON);
+    graph::setup_requested_backend_context(ctx, graph::Target::NEON);
+    graph::detail::configure_all_tensors(g);
+    const std::vector<graph::NodeID> node_order = graph::dfs(g);
+    graph::ExecutionWorkload         workload   = graph::detail::configure_all_nodes(g, ctx, node_order);
+    graph::detail::configure_execution_stages(g, workload, config.max_concurrent_branches);
+    graph::detail::configure_batch_workloads(g, ctx, workload, node_order);
+
+    // The convolution, the two activations together, the addition and the fully connected layer
+    const std::vector<unsigned int> stages({1U, 2U, 1U, 1U});
+    ARM_COMPUTE_EXPECT(workload.stages == stages, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(workload.max_batch_size == 4U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(workload.batch_workloads.size() == 2U);
+    for (const auto &batch_workload : workload.batch_workloads)
+    {
+        ARM_COMPUTE_EXPECT(batch_workload.second.stages == stages, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(batch_workload.second.tasks[2].node->type() == graph::NodeType::ActivationLayer,
+                           framework::LogLevel::ERRORS);
+    }
+}
+
+/** Validate that running fewer samples computes the same first samples as a graph configured for the whole batch */
+TEST_CASE(Result, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int   max_batch_size = 4;
+    constexpr unsigned int   num_outputs    = 10;
+    const TensorShape        shape(8U, 8U, 4U, max_batch_size);
+    const std::vector<float> input   = random_values(shape.total_size());
+    const std::vector<float> weights = random_values(8192, 1);
+
+    // Reference computed by a static batch graph
+    std::vector<float> reference;
+    {
+        graph::Graph g(0, "StaticBatch");
+        build_batch_graph(g, shape, input, weights, reference);
+
+        graph::GraphConfig  config;
+        graph::GraphContext ctx;
+        ctx.set_config(config);
+        graph::PassManager  pm = graph::create_default_pass_manager(graph::Target::NEON, config);
+        graph::GraphManager manager;
+        manager.finalize_graph(g, ctx, pm, graph::Target::NEON);
+        manager.execute_graph(g);
+    }
+    ARM_COMPUTE_ASSERT(reference.size() == num_outputs * max_batch_size);
+
+    for (unsigned int max_concurrent_branches : {1U, 2U})
+    {
+        std::vector<float> output;
+        graph::Graph       g(0, "DynamicBatch");
+        build_batch_graph(g, shape, input, weights, output);
+
+        graph::GraphConfig config;
+        config.max_concurrent_branches = max_concurrent_branches;
+        config.dynamic_batch           = true;
+        graph::GraphContext ctx;
+        ctx.set_config(config);
+
+        // The functions of the different batch sizes share their pretransposed weights while the graph is finalized
+        PreparedWeightsCache &cache  = PreparedWeightsCache::get();
+        const unsigned int    shares = cache.stats().shares;
+
+        graph::PassManager  pm = graph::create_default_pass_manager(graph::Target::NEON, config);
+        graph::GraphManager manager;
+        manager.finalize_graph(g, ctx, pm, graph::Target::NEON);
+
+        ARM_COMPUTE_EXPECT(cache.stats().shares > shares, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!cache.is_sharing_enabled(), framework::LogLevel::ERRORS);
+
+        for (unsigned int batch_size = 1; batch_size <= max_batch_size; ++batch_size)
+        {
+            output.clear();
+            manager.execute_graph(g, batch_size);
+
+            ARM_COMPUTE_ASSERT(output.size() == reference.size());
+            for (size_t i = 0; i < num_outputs * batch_size; ++i)
+            {
+                ARM_COMPUTE_EXPECT(std::abs(output[i] - reference[i]) <= 1e-4f * std::max(1.f, std::abs(reference[i])),
+                                   framework::LogLevel::ERRORS);
+            }
+        }
+    }
+}
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+/** Validate that a batch size the graph isn't configured for is rejected, and leaves the graph usable */
+TEST_CASE(InvalidBatchSize, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int   max_batch_size = 4;
+    const TensorShape        shape(8U, 8U, 4U, max_batch_size);
+    const std::vector<float> input   = random_values(shape.total_size());
+    const std::vector<float> weights = random_values(8192, 1);
+    std::vector<float>       output;
+
+    graph::Graph g(0, "DynamicBatch");
+    build_batch_graph(g, shape, input, weights, output);
+
+    graph::GraphConfig config;
+    config.dynamic_batch = true;
+    graph::GraphContext ctx;
+    ctx.set_config(config);
+    graph::PassManager  pm = graph::create_default_pass_manager(graph::Target::NEON, config);
+    graph::GraphManager manager;
+    manager.finalize_graph(g, ctx, pm, graph::Target::NEON);
+
+    for (unsigned int batch_size : {0U, max_batch_size + 1})
+    {
+        bool exception_caught = false;
+        try
+        {
+            manager.execute_graph(g, batch_size);
+        }
+        catch (const std::exception &)
+        {
+            exception_caught = true;
+        }
+        ARM_COMPUTE_EXPECT(exception_caught, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(output.empty(), framework::LogLevel::ERRORS);
+    }
+
+    manager.execute_graph(g, max_batch_size);
+    ARM_COMPUTE_EXPECT(output.size() == 10U * max_batch_size, framework::LogLevel::ERRORS);
+}
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+TEST_SUITE_END() // DynamicBatch
+
+TEST_SUITE(ImportMemory)
+/** Validate that a constant node uses the memory provided by its accessor, or falls back to an allocation */
+TEST_CASE(ConstantNode, framework::DatasetMode::ALL)
+{
+    const TensorShape        shape(16U, 8U, 3U);
+    const std::vector<float> input     = random_values(shape.total_size());
+    const std::vector<float> constants = random_values(shape.total_size(), 1);
+
+    for (bool import : {true, false})
+    {
+        std::vector<float>      output;
+        graph::Graph            g(0, "ImportMemory");
+        const graph::NodeParams params{"", graph::Target::NEON};
+
+        const graph::TensorDescriptor desc(shape, DataType::F32);
+        auto                          accessor     = std::make_unique<ImportAccessor>(constants, import);
+        ImportAccessor               *accessor_ptr = accessor.get();
+
+        const graph::NodeID input_id =
+            graph::GraphBuilder::add_input_node(g, params, desc, std::make_unique<VectorInputAccessor>(input));
+        const graph::NodeID const_id = graph::GraphBuilder::add_const_node(g, params, desc, std::move(accessor));
+        const graph::NodeID add_id   = graph::GraphBuilder::add_elementwise_node(g, params, {input_id, 0},
+                                                                                 {const_id, 0},
+                                                                                 graph::EltwiseOperation::Add);
+        graph::GraphBuilder::add_output_node(g, params, {add_id, 0}, std::make_unique<VectorOutputAccessor>(output));
+
+        graph::GraphConfig  config;
+        graph::GraphContext ctx;
+        ctx.set_config(config);
+        graph::PassManager  pm = graph::create_default_pass_manager(graph::Target::NEON, config);
+        graph::GraphManager manager;
+        manager.finalize_graph(g, ctx, pm, graph::Target::NEON);
+        manager.execute_graph(g);
+
+        // The imported memory is used as is, the tensor is only filled when allocated
+        const uint8_t *buffer = g.node(const_id)->output(0)->handle()->tensor().buffer();
+        ARM_COMPUTE_EXPECT((buffer == accessor_ptr->imported()) == import, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(accessor_ptr->num_accesses() == (import ? 0U : 1U), framework::LogLevel::ERRORS);
+
+        ARM_COMPUTE_ASSERT(output.size() == input.size());
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            ARM_COMPUTE_EXPECT(std::abs(output[i] - (input[i] + constants[i])) < 1e-5f, framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+/** Validate that the CPU tensor handle imports memory laid out with padding or custom strides */
+TEST_CASE(PaddedAndStridedHandle, framework::DatasetMode::ALL)
+{
+    const TensorShape        shape(7U, 5U, 3U);
+    const std::vector<float> values = random_values(shape.total_size());
+
+    TensorInfo padded(shape, 1, DataType::F32);
+    padded.extend_padding(PaddingSize(1U, 3U, 2U, 1U));
+
+    // Rows of 9 elements, planes of 6 rows
+    TensorInfo    strided;
+    const Strides strides(sizeof(float), 9 * sizeof(float), 9 * 6 * sizeof(float));
+    strided.init(shape, 1, DataType::F32, strides, 0, 3 * 9 * 6 * sizeof(float));
+
+    for (const TensorInfo *info : std::vector<const TensorInfo *>{&padded, &strided})
+    {
+        ExternalBuffer                  buffer(*info, values);
+        graph::backends::NETensorHandle handle(*info);
+        ARM_COMPUTE_ASSERT(handle.import_memory(buffer.data()));
+        ARM_COMPUTE_EXPECT(handle.tensor().buffer() == buffer.data(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(handle.tensor().info()->strides_in_bytes() == info->strides_in_bytes(),
+                           framework::LogLevel::ERRORS);
+
+        Accessor accessor(handle.tensor());
+        for (size_t i = 0; i < shape.total_size(); ++i)
+        {
+            ARM_COMPUTE_EXPECT(*reinterpret_cast<const float *>(accessor(index2coord(shape, i))) == values[i],
+                               framework::LogLevel::ERRORS);
+        }
+    }
+}
+TEST_SUITE_END() // ImportMemory
+
+/** Validate the memory footprint reported for a graph against the sizes of its tensors */
+TEST_CASE(MemoryFootprint, framework::DatasetMode::ALL)
+{
+    const TensorShape        shape(16U, 8U, 3U);
+    const size_t             bytes     = shape.total_size() * sizeof(float);
+    const std::vector<float> input     = random_values(shape.total_size());
+    const std::vector<float> constants = random_values(shape.total_size(), 1);
+    std::vector<float>       output;
+
+    // output = input + constant: one input, one constant and one activation tensor
+    graph::Graph                  g(0, "MemoryFootprint");
+    const graph::NodeParams       params{"", graph::Target::NEON};
+    const graph::TensorDescriptor desc(shape, DataType::F32);
+    const graph::NodeID           input_id =
+        graph::GraphBuilder::add_input_node(g, params, desc, std::make_unique<VectorInputAccessor>(input));
+    const graph::NodeID const_id =
+        graph::GraphBuilder::add_const_node(g, params, desc, std::make_unique<VectorInputAccessor>(constants));
+    const graph::NodeID add_id = graph::GraphBuilder::add_elementwise_node(g, params, {input_id, 0}, {const_id, 0},
+                                                                           graph::EltwiseOperation::Add);
+    graph::GraphBuilder::add_output_node(g, params, {add_id, 0}, std::make_unique<VectorOutputAccessor>(output));
+
+    graph::GraphConfig config;
+    config.record_memory_footprint = true;
+    graph::GraphContext ctx;
+    ctx.set_config(config);
+    graph::PassManager  pm = graph::create_default_pass_manager(graph::Target::NEON, config);
+    graph::GraphManager manager;
+    manager.finalize_graph(g, ctx, pm, graph::Target::NEON);
+
+    const graph::GraphMemoryFootprint footprint = graph::memory_footprint(g, ctx);
+    for (const auto &node : footprint.nodes)
+    {
+        const size_t expected_activations = (node.id == input_id || node.id == add_id) ? bytes : 0U;
+        const size_t expected_weights     = node.id == const_id ? bytes : 0U;
+        ARM_COMPUTE_EXPECT(node.footprint.activations == expected_activations, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(node.footprint.weights == expected_weights, framework::LogLevel::ERRORS);
+        // An elementwise addition transforms no weights
+        ARM_COMPUTE_EXPECT(node.footprint.transformed_weights == 0U, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(footprint.total.activations == 2 * bytes, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(footprint.total.weights == bytes, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(footprint.total.total() >= 3 * bytes, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // GraphExecution
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
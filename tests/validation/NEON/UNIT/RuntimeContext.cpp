@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,6 +39,9 @@
 #if !defined(BARE_METAL)
 #include <thread>
 #endif // !defined(BARE_METAL)
+#if defined(ARM_COMPUTE_CPP_SCHEDULER) && defined(__linux__)
+#include <sched.h>
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER) && defined(__linux__)
 
 namespace arm_compute
 {
@@ -170,6 +173,51 @@ TEST_CASE(MultipleThreadedScheduller, framework::DatasetMode::ALL)
 }
 #endif // !defined(BARE_METAL)
 
+#if defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL) && defined(__linux__)
+// The worker threads of a context bound to a CPU set are pinned, but the calling thread must keep its own affinity
+TEST_CASE(CpuSetLeavesCallerAffinity, framework::DatasetMode::ALL)
+{
+    cpu_set_t affinity_before;
+    CPU_ZERO(&affinity_before);
+    ARM_COMPUTE_ASSERT(sched_getaffinity(0, sizeof(affinity_before), &affinity_before) == 0);
+
+    RuntimeContext ctx(std::vector<int>{0});
+    // One worker thread pinned to CPU 0, plus the calling thread
+    ARM_COMPUTE_ASSERT(ctx.scheduler()->num_threads() == 2);
+
+    NEActivationLayer act_layer(&ctx);
+    Tensor            src = create_tensor<Tensor>(TensorShape(128, 128), DataType::F32, 1);
+    Tensor            dst = create_tensor<Tensor>(TensorShape(128, 128), DataType::F32, 1);
+    act_layer.configure(&src, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR));
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0);
+    act_layer.run();
+
+    cpu_set_t affinity_after;
+    CPU_ZERO(&affinity_after);
+    ARM_COMPUTE_ASSERT(sched_getaffinity(0, sizeof(affinity_after), &affinity_after) == 0);
+    ARM_COMPUTE_EXPECT(CPU_EQUAL(&affinity_before, &affinity_after), framework::LogLevel::ERRORS);
+}
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL) && defined(__linux__)
+
+#if defined(ARM_COMPUTE_OPENMP_SCHEDULER) && !defined(ARM_COMPUTE_EXCEPTIONS_DISABLED)
+// The OpenMP runtime can't bind its threads to a CPU set: the request must be rejected rather than ignored
+TEST_CASE(CpuSetRejectedByOpenMP, framework::DatasetMode::ALL)
+{
+    bool exception_caught = false;
+    try
+    {
+        SchedulerFactory::create(std::vector<int>{0}, SchedulerFactory::Type::OMP);
+    }
+    catch(const std::exception &)
+    {
+        exception_caught = true;
+    }
+    ARM_COMPUTE_EXPECT(exception_caught, framework::LogLevel::ERRORS);
+}
+#endif // defined(ARM_COMPUTE_OPENMP_SCHEDULER) && !defined(ARM_COMPUTE_EXCEPTIONS_DISABLED)
+
 TEST_SUITE_END() // RuntimeContext
 TEST_SUITE_END() // UNIT
 TEST_SUITE_END() // Neon
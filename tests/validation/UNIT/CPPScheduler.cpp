@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,10 +24,16 @@
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
 
 #include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/runtime/SchedulerTracer.h"
+#include "src/runtime/SchedulerUtils.h"
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
 
+#include <atomic>
+#include <future>
+#include <sstream>
 #include <stdexcept>
+#include <vector>
 
 using namespace arm_compute;
 using namespace arm_compute::test;
@@ -64,6 +70,51 @@ public:
     }
 
 };
+
+class CountingKernel : public ICPPKernel
+{
+public:
+    explicit CountingKernel(unsigned int width, unsigned int height = 1) : _width(width), _counters(width * height)
+    {
+        Window window;
+        window.set(Window::DimX, Window::Dimension(0, width));
+        window.set(Window::DimY, Window::Dimension(0, height));
+        configure(window);
+    }
+
+    const char *name() const override
+    {
+        return "CountingKernel";
+    }
+
+    void run(const Window &window, const ThreadInfo &) override
+    {
+        for (int y = window.y().start(); y < window.y().end(); ++y)
+        {
+            for (int x = window.x().start(); x < window.x().end(); ++x)
+            {
+                ++_counters[y * _width + x];
+            }
+        }
+    }
+
+    /** Check that each iteration of the window was executed exactly once */
+    bool all_executed_once() const
+    {
+        for (const auto &counter : _counters)
+        {
+            if (counter.load() != 1)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    unsigned int                           _width;
+    std::vector<std::atomic<unsigned int>> _counters;
+};
 }
 
 TEST_SUITE(UNIT)
@@ -86,6 +137,202 @@ TEST_CASE(RethrowException, framework::DatasetMode::ALL)
     }
     ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
 }
+
+TEST_CASE(StealModeRunsAllWorkloads, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(4);
+    scheduler.set_scheduling_mode(CPPScheduler::SchedulingMode::Steal);
+
+    CountingKernel      kernel(1024);
+    CPPScheduler::Hints hints(Window::DimX, CPPScheduler::StrategyHint::DYNAMIC, 64);
+    scheduler.schedule(&kernel, hints);
+
+    ARM_COMPUTE_EXPECT(kernel.all_executed_once(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(CostModelPartitionsNarrowDimension, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(4);
+
+    // Only two rows along the hinted dimension: the cost model must split along X to use all the threads
+    CountingKernel           kernel(1024, 2);
+    IScheduler::WorkloadCost cost{};
+    cost.macs    = 1 << 24;
+    cost.granule = 1;
+    CPPScheduler::Hints hints(Window::DimY);
+    hints.set_cost(cost);
+    scheduler.schedule(&kernel, hints);
+
+    ARM_COMPUTE_EXPECT(kernel.all_executed_once(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(CapacityWeightedSplit, framework::DatasetMode::ALL)
+{
+    Window window;
+    window.set(Window::DimX, Window::Dimension(0, 100));
+
+    // Windows are proportional to the weights
+    const std::vector<float> weights{1.f, 3.f};
+    const Window             win0 = scheduler_utils::split_window_weighted(window, Window::DimX, weights, 0);
+    const Window             win1 = scheduler_utils::split_window_weighted(window, Window::DimX, weights, 1);
+    ARM_COMPUTE_EXPECT(win0.x().start() == 0 && win0.x().end() == 25, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(win1.x().start() == 25 && win1.x().end() == 100, framework::LogLevel::ERRORS);
+
+    // Every window gets at least one iteration
+    Window small_window;
+    small_window.set(Window::DimX, Window::Dimension(0, 3));
+    const std::vector<float> skewed_weights{1.f, 1000.f, 1.f};
+    for (unsigned int id = 0; id < skewed_weights.size(); ++id)
+    {
+        const Window win = scheduler_utils::split_window_weighted(small_window, Window::DimX, skewed_weights, id);
+        ARM_COMPUTE_EXPECT(win.x().start() == static_cast<int>(id) && win.x().end() == static_cast<int>(id + 1),
+                           framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(SpinWaitDispatchStats, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(4);
+    scheduler.set_spin_wait(CPPScheduler::SpinWaitConfig{200, 16});
+    scheduler.set_dispatch_stats_enabled(true);
+
+    constexpr unsigned int num_runs = 10;
+    for (unsigned int i = 0; i < num_runs; ++i)
+    {
+        CountingKernel      kernel(64);
+        CPPScheduler::Hints hints(Window::DimX);
+        scheduler.schedule(&kernel, hints);
+        ARM_COMPUTE_EXPECT(kernel.all_executed_once(), framework::LogLevel::ERRORS);
+    }
+
+    const CPPScheduler::DispatchStats stats = scheduler.dispatch_stats();
+    ARM_COMPUTE_EXPECT(stats.num_dispatches == num_runs, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.max_latency_ns <= stats.total_latency_ns, framework::LogLevel::ERRORS);
+
+    scheduler.reset_dispatch_stats();
+    ARM_COMPUTE_EXPECT(scheduler.dispatch_stats().num_dispatches == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(TracerRecordsWorkloads, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(4);
+
+    SchedulerTracer &tracer = SchedulerTracer::get();
+    tracer.clear();
+    tracer.set_enabled(true);
+    CountingKernel      kernel(1024);
+    CPPScheduler::Hints hints(Window::DimX);
+    scheduler.schedule(&kernel, hints);
+    tracer.set_enabled(false);
+
+    ARM_COMPUTE_EXPECT(kernel.all_executed_once(), framework::LogLevel::ERRORS);
+
+    const std::vector<SchedulerTracer::KernelRecord> records = tracer.records();
+    ARM_COMPUTE_ASSERT(records.size() == 1);
+    const SchedulerTracer::KernelRecord &record = records[0];
+    ARM_COMPUTE_EXPECT(record.scheduler == &scheduler, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(record.name == "CountingKernel", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(record.window == "1024", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(record.num_threads == 4, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(record.workloads.size() == 4, framework::LogLevel::ERRORS);
+    for (const auto &workload : record.workloads)
+    {
+        ARM_COMPUTE_EXPECT(workload.thread_id < 4, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(record.start_ns <= workload.start_ns, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(workload.start_ns <= workload.end_ns, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(workload.end_ns <= record.end_ns, framework::LogLevel::ERRORS);
+    }
+
+    std::stringstream trace;
+    tracer.write_chrome_trace(trace);
+    ARM_COMPUTE_EXPECT(trace.str().find("\"traceEvents\"") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(trace.str().find("\"idle_us\"") != std::string::npos, framework::LogLevel::ERRORS);
+
+    // Nothing is recorded once disabled
+    scheduler.schedule(&kernel, hints);
+    ARM_COMPUTE_EXPECT(tracer.records().size() == 1, framework::LogLevel::ERRORS);
+    tracer.clear();
+}
+
+TEST_CASE(TracerKeepsMostRecentRecords, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(2);
+
+    SchedulerTracer &tracer           = SchedulerTracer::get();
+    const size_t     default_capacity = tracer.capacity();
+    tracer.clear();
+    tracer.set_capacity(2);
+    tracer.set_enabled(true);
+    CountingKernel      kernel0(16);
+    CountingKernel      kernel1(32);
+    CountingKernel      kernel2(64);
+    CPPScheduler::Hints hints(Window::DimX);
+    scheduler.schedule(&kernel0, hints);
+    scheduler.schedule(&kernel1, hints);
+    scheduler.schedule(&kernel2, hints);
+    tracer.set_enabled(false);
+
+    // The oldest record has been overwritten, the others are returned in completion order
+    const std::vector<SchedulerTracer::KernelRecord> records = tracer.records();
+    ARM_COMPUTE_ASSERT(records.size() == 2);
+    ARM_COMPUTE_EXPECT(records[0].window == "32", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(records[1].window == "64", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tracer.num_dropped() == 1, framework::LogLevel::ERRORS);
+
+    // Shrinking the ring buffer keeps the most recent records
+    tracer.set_capacity(1);
+    ARM_COMPUTE_ASSERT(tracer.records().size() == 1);
+    ARM_COMPUTE_EXPECT(tracer.records()[0].window == "64", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tracer.num_dropped() == 2, framework::LogLevel::ERRORS);
+
+    tracer.set_capacity(default_capacity);
+    tracer.clear();
+}
+
+TEST_CASE(AsyncScheduleAndSync, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(2);
+
+    CountingKernel      kernel0(256);
+    CountingKernel      kernel1(256);
+    CPPScheduler::Hints hints(Window::DimX);
+    ITensorPack         tensors;
+
+    std::future<void> future0 = scheduler.schedule_op_async(&kernel0, hints, kernel0.window(), tensors);
+    scheduler.schedule_op_async(&kernel1, hints, kernel1.window(), tensors);
+    future0.get();
+    scheduler.sync();
+
+    ARM_COMPUTE_EXPECT(kernel0.all_executed_once(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel1.all_executed_once(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(AsyncRethrowException, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(2);
+
+    TestKernel          kernel;
+    CPPScheduler::Hints hints(0);
+    ITensorPack         tensors;
+
+    std::future<void> future = scheduler.schedule_op_async(&kernel, hints, kernel.window(), tensors);
+    try
+    {
+        future.get();
+    }
+    catch (const TestException &)
+    {
+        return;
+    }
+    ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
+}
 #endif // defined(ARM_COMPUTE_CPP_SCHEDULER) &&  !defined(BARE_METAL)
 TEST_SUITE_END()
 TEST_SUITE_END()
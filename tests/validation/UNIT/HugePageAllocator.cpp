@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HugePageAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(UNIT)
+TEST_SUITE(HugePageAllocator)
+
+/** Validate that the size classes cover the requested sizes with a bounded rounding */
+TEST_CASE(SizeClasses, framework::DatasetMode::ALL)
+{
+    constexpr size_t huge_page_size = arm_compute::HugePageAllocator::huge_page_size;
+
+    ARM_COMPUTE_EXPECT(arm_compute::HugePageAllocator::size_class(0) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arm_compute::HugePageAllocator::size_class(huge_page_size) == huge_page_size,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arm_compute::HugePageAllocator::size_class(huge_page_size + 1) == 2 * huge_page_size,
+                       framework::LogLevel::ERRORS);
+
+    const size_t page = arm_compute::HugePageAllocator::size_class(1);
+    for (size_t size = 1; size < 4 * huge_page_size; size = size * 3 / 2 + 1)
+    {
+        const size_t size_class = arm_compute::HugePageAllocator::size_class(size);
+        ARM_COMPUTE_EXPECT(size_class >= size, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(size_class % page == 0, framework::LogLevel::ERRORS);
+        if (size >= huge_page_size)
+        {
+            ARM_COMPUTE_EXPECT(size_class < size + huge_page_size, framework::LogLevel::ERRORS);
+        }
+        else
+        {
+            ARM_COMPUTE_EXPECT(size_class <= size + size / 4 + page || size_class == huge_page_size,
+                               framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+/** Validate that freed buffers are handed out again and that huge buffers are aligned to huge pages */
+TEST_CASE(RecycleFreedBuffers, framework::DatasetMode::ALL)
+{
+    constexpr size_t huge_size  = 3 * arm_compute::HugePageAllocator::huge_page_size + 100;
+    constexpr size_t small_size = 10000;
+
+    arm_compute::HugePageAllocator allocator(8 * arm_compute::HugePageAllocator::huge_page_size);
+
+    auto        region = allocator.make_region(huge_size, 0);
+    void *const buffer = region->buffer();
+    ARM_COMPUTE_ASSERT(buffer != nullptr);
+#if defined(__linux__) && !defined(BARE_METAL)
+    ARM_COMPUTE_EXPECT(reinterpret_cast<uintptr_t>(buffer) % arm_compute::HugePageAllocator::huge_page_size == 0,
+                       framework::LogLevel::ERRORS);
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+    std::memset(buffer, 1, huge_size);
+    region.reset();
+
+    region = allocator.make_region(huge_size + 1000, 0);
+    ARM_COMPUTE_EXPECT(region->buffer() == buffer, framework::LogLevel::ERRORS);
+
+    void *small = allocator.allocate(small_size, 64);
+    ARM_COMPUTE_ASSERT(small != nullptr);
+    std::memset(small, 1, small_size);
+    allocator.free(small);
+    ARM_COMPUTE_EXPECT(allocator.allocate(small_size + 1, 64) == small, framework::LogLevel::ERRORS);
+
+    arm_compute::HugePageAllocator::Stats stats = allocator.stats();
+    ARM_COMPUTE_EXPECT(stats.num_allocations == 4, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.num_recycled == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.bytes_cached == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.bytes_in_use == arm_compute::HugePageAllocator::size_class(huge_size) +
+                                                 arm_compute::HugePageAllocator::size_class(small_size),
+                       framework::LogLevel::ERRORS);
+
+    allocator.free(small);
+    region.reset();
+    allocator.release_cached();
+    stats = allocator.stats();
+    ARM_COMPUTE_EXPECT(stats.bytes_in_use == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.bytes_cached == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.huge_page_bytes == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.peak_bytes_mapped == arm_compute::HugePageAllocator::size_class(huge_size) +
+                                                      arm_compute::HugePageAllocator::size_class(small_size),
+                       framework::LogLevel::ERRORS);
+}
+
+/** Validate that freed buffers aren't kept beyond the cache limit and that regions outlive the allocator */
+TEST_CASE(CacheLimit, framework::DatasetMode::ALL)
+{
+    constexpr size_t size = arm_compute::HugePageAllocator::huge_page_size;
+
+    std::unique_ptr<IMemoryRegion> region;
+    {
+        arm_compute::HugePageAllocator allocator(size);
+
+        auto first  = allocator.make_region(size, 0);
+        auto second = allocator.make_region(size, 0);
+        region      = allocator.make_region(size, 0);
+        first.reset();
+        second.reset();
+        ARM_COMPUTE_EXPECT(allocator.stats().bytes_cached == size, framework::LogLevel::ERRORS);
+    }
+    std::memset(region->buffer(), 1, size);
+    region.reset();
+}
+
+TEST_SUITE_END() // HugePageAllocator
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019 Arm Limited.
+ * Copyright (c) 2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/IntervalLifetimeManager.h"
 #include "arm_compute/runtime/Memory.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
@@ -95,6 +96,8 @@ TEST_CASE(MemoryGroupRegister, framework::DatasetMode::ALL)
     ARM_COMPUTE_EXPECT(lft_mgr->info()[1].alignment == 8, framework::LogLevel::ERRORS);
     ARM_COMPUTE_EXPECT(lft_mgr->info()[1].owners == 2, framework::LogLevel::ERRORS);
     ARM_COMPUTE_EXPECT(mg.mappings().size() == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lft_mgr->managed_size() == 172, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lft_mgr->pool_size() == 160, framework::LogLevel::ERRORS);
 }
 
 /** Validate memory group release */
@@ -119,6 +122,51 @@ TEST_CASE(MemoryGroupRelease, framework::DatasetMode::ALL)
     ARM_COMPUTE_EXPECT(mg.mappings().size() == 0, framework::LogLevel::ERRORS);
 }
 
+/** Validate that the interval-aware planner overlaps the objects whose lifetimes don't intersect */
+TEST_CASE(IntervalPlanner, framework::DatasetMode::ALL)
+{
+    auto        lft_mgr  = std::make_shared<IntervalLifetimeManager>();
+    auto        pool_mgr = std::make_shared<PoolManager>();
+    auto        mm       = std::make_shared<MemoryManagerOnDemand>(lft_mgr, pool_mgr);
+    MemoryGroup mg(mm);
+
+    // Register group
+    lft_mgr->register_group(&mg);
+
+    // e lives across the whole group. a and b are freed in reverse order, so a greedy reuse of their slots puts the
+    // large c and small d in the slots of a and b respectively.
+    MockMemoryManageable a{}, b{}, c{}, d{}, e{};
+    Memory               m_a{}, m_b{}, m_c{}, m_d{}, m_e{};
+    mg.manage(&e);
+    mg.manage(&a);
+    mg.manage(&b);
+    mg.finalize_memory(&b, m_b, 128U /* size */, 0U /* alignment */);
+    mg.finalize_memory(&a, m_a, 16U /* size */, 0U /* alignment */);
+    mg.manage(&c);
+    mg.manage(&d);
+    mg.finalize_memory(&c, m_c, 128U /* size */, 0U /* alignment */);
+    mg.finalize_memory(&d, m_d, 16U /* size */, 0U /* alignment */);
+    mg.finalize_memory(&e, m_e, 8U /* size */, 0U /* alignment */);
+
+    // Validate the plan
+    const IntervalLifetimeManager::Footprint &footprint = lft_mgr->footprint();
+    ARM_COMPUTE_EXPECT(footprint.peak_live == 152, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(footprint.planned == 152, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(footprint.offset == 264, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(footprint.blob == 264, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lft_mgr->info().size == 152, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lft_mgr->pool_size() == 152, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lft_mgr->managed_size() == 296, framework::LogLevel::ERRORS);
+
+    // Objects alive at the same time must not overlap
+    auto &mappings = mg.mappings();
+    ARM_COMPUTE_EXPECT(mappings.size() == 5, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mappings[&m_a] >= mappings[&m_b] + 128 || mappings[&m_b] >= mappings[&m_a] + 16,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mappings[&m_c] >= mappings[&m_d] + 16 || mappings[&m_d] >= mappings[&m_c] + 128,
+                       framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END() // LifetimeManager
 TEST_SUITE_END()
 } // namespace validation
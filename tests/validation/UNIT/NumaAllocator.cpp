@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NumaAllocator.h"
+
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(UNIT)
+TEST_SUITE(NumaAllocator)
+
+/** Validate that regions of the allocator are usable and aligned */
+TEST_CASE(MakeRegion, framework::DatasetMode::ALL)
+{
+    NumaAllocator allocator(0);
+    auto          region = allocator.make_region(100000, 64);
+    ARM_COMPUTE_EXPECT(region != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(region->buffer() != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(region->size() == 100000, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reinterpret_cast<uintptr_t>(region->buffer()) % 64 == 0, framework::LogLevel::ERRORS);
+
+    // Pages must be writable
+    std::memset(region->buffer(), 0xAB, region->size());
+
+    auto sub = region->extract_subregion(1024, 2048);
+    ARM_COMPUTE_EXPECT(sub != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(static_cast<uint8_t *>(sub->buffer())[0] == 0xAB, framework::LogLevel::ERRORS);
+}
+
+/** Validate that the large buffers are aligned to huge pages when they are requested */
+TEST_CASE(HugePages, framework::DatasetMode::ALL)
+{
+    constexpr size_t huge_page_size = 2 * 1024 * 1024;
+    NumaAllocator    allocator(0, true);
+    ARM_COMPUTE_EXPECT(allocator.huge_pages(), framework::LogLevel::ERRORS);
+
+    auto region = allocator.make_region(3 * huge_page_size, 64);
+    ARM_COMPUTE_EXPECT(region->buffer() != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reinterpret_cast<uintptr_t>(region->buffer()) % huge_page_size == 0,
+                       framework::LogLevel::ERRORS);
+    std::memset(region->buffer(), 0xAB, region->size());
+
+    void *ptr = allocator.allocate(huge_page_size, 64);
+    ARM_COMPUTE_EXPECT(reinterpret_cast<uintptr_t>(ptr) % huge_page_size == 0, framework::LogLevel::ERRORS);
+    std::memset(ptr, 0, huge_page_size);
+    allocator.free(ptr);
+}
+
+/** Validate that the thread allocator is used by unmanaged tensors */
+TEST_CASE(ThreadAllocator, framework::DatasetMode::ALL)
+{
+    NumaAllocator allocator(-1);
+    Tensor        tensor;
+    tensor.allocator()->init(TensorInfo(TensorShape(64U, 64U), 1, DataType::F32));
+
+    IAllocator *prev_allocator = TensorAllocator::thread_allocator();
+    TensorAllocator::set_thread_allocator(&allocator);
+    tensor.allocator()->allocate();
+    TensorAllocator::set_thread_allocator(prev_allocator);
+
+    ARM_COMPUTE_EXPECT(tensor.buffer() != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(TensorAllocator::thread_allocator() == prev_allocator, framework::LogLevel::ERRORS);
+    std::memset(tensor.buffer(), 0, tensor.info()->total_size());
+    tensor.allocator()->free();
+}
+
+/** Validate that the binding functions only return CPUs of the requested node */
+TEST_CASE(BindFunc, framework::DatasetMode::ALL)
+{
+    const std::vector<int> cpus = numa::node_cpus(0);
+    ARM_COMPUTE_EXPECT(!cpus.empty(), framework::LogLevel::ERRORS);
+
+    const auto bind = numa::make_bind_func(numa::BindPolicy::Compact, 0);
+    for (int i = 0; i < 8; ++i)
+    {
+        const int cpu = bind(i, 8);
+        ARM_COMPUTE_EXPECT(std::find(cpus.begin(), cpus.end(), cpu) != cpus.end(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(numa::cpu_node(cpu) == 0, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // NumaAllocator
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
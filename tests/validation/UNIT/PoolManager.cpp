@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/AffinityPoolManager.h"
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/BlobMemoryPool.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <chrono>
+#include <future>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Register a given number of pools to a pool manager */
+void register_pools(IPoolManager &pool_mgr, Allocator &allocator, unsigned int num_pools)
+{
+    for (unsigned int i = 0; i < num_pools; ++i)
+    {
+        pool_mgr.register_pool(std::make_unique<BlobMemoryPool>(&allocator, std::vector<BlobInfo>{BlobInfo(64, 8)}));
+    }
+}
+} // namespace
+TEST_SUITE(UNIT)
+TEST_SUITE(PoolManager)
+
+/** Validate that a thread gets back the pool it used last */
+TEST_CASE(AffinityPoolReuse, framework::DatasetMode::ALL)
+{
+    Allocator           allocator{};
+    AffinityPoolManager pool_mgr;
+    register_pools(pool_mgr, allocator, 2);
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 2, framework::LogLevel::ERRORS);
+
+    // Lock and unlock a pool from another thread
+    auto lock_from_other_thread = [&]()
+    {
+        return std::async(std::launch::async,
+                          [&]()
+                          {
+                              IMemoryPool *pool = pool_mgr.lock_pool();
+                              pool_mgr.unlock_pool(pool);
+                              return pool;
+                          })
+            .get();
+    };
+
+    IMemoryPool *pool = pool_mgr.lock_pool();
+    pool_mgr.unlock_pool(pool);
+
+    // The pool used by another thread in between doesn't change the pool of this thread
+    lock_from_other_thread();
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        IMemoryPool *same_pool = pool_mgr.lock_pool();
+        ARM_COMPUTE_EXPECT(same_pool == pool, framework::LogLevel::ERRORS);
+        pool_mgr.unlock_pool(same_pool);
+    }
+
+    // A thread locking while the pool is occupied gets the other one
+    IMemoryPool *locked_pool = pool_mgr.lock_pool();
+    ARM_COMPUTE_EXPECT(lock_from_other_thread() != locked_pool, framework::LogLevel::ERRORS);
+    pool_mgr.unlock_pool(locked_pool);
+
+    pool_mgr.clear_pools();
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 0, framework::LogLevel::ERRORS);
+}
+
+/** Validate that a thread blocks until a pool is unlocked when all of them are occupied */
+TEST_CASE(AffinityPoolBlocksWhenExhausted, framework::DatasetMode::ALL)
+{
+    Allocator           allocator{};
+    AffinityPoolManager pool_mgr;
+    register_pools(pool_mgr, allocator, 1);
+
+    IMemoryPool      *pool   = pool_mgr.lock_pool();
+    std::future<bool> waiter = std::async(std::launch::async,
+                                          [&]()
+                                          {
+                                              IMemoryPool *other_pool = pool_mgr.lock_pool();
+                                              pool_mgr.unlock_pool(other_pool);
+                                              return other_pool == pool;
+                                          });
+    ARM_COMPUTE_EXPECT(waiter.wait_for(std::chrono::milliseconds(10)) == std::future_status::timeout,
+                       framework::LogLevel::ERRORS);
+    pool_mgr.unlock_pool(pool);
+    ARM_COMPUTE_EXPECT(waiter.get(), framework::LogLevel::ERRORS);
+
+    std::unique_ptr<IMemoryPool> released_pool = pool_mgr.release_pool();
+    ARM_COMPUTE_EXPECT(released_pool.get() == pool, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // PoolManager
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
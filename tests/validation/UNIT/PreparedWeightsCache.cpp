@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if !defined(_WIN64) && !defined(BARE_METAL)
+
+#include "arm_compute/runtime/PreparedWeightsCache.h"
+
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(UNIT)
+TEST_SUITE(PreparedWeightsCache)
+
+/** Validate that stored weights are only mapped back with the same key and size */
+TEST_CASE(StoreAndLoad, framework::DatasetMode::ALL)
+{
+    const TemporaryDirectory directory("/tmp/acl_prepared_weights_");
+
+    PreparedWeightsCache &cache              = PreparedWeightsCache::get();
+    const std::string     previous_directory = cache.directory();
+    cache.set_directory(directory.path());
+    ARM_COMPUTE_EXPECT(cache.is_enabled(), framework::LogLevel::ERRORS);
+
+    std::vector<uint8_t> data(10000);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+    const std::string key       = PreparedWeightsCache::make_key("Op", 0x1234, "config");
+    const std::string other_key = PreparedWeightsCache::make_key("Op", 0x1235, "config");
+
+    ARM_COMPUTE_EXPECT(cache.load(key, data.size()) == nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.store(key, data.data(), data.size()), framework::LogLevel::ERRORS);
+
+    const auto mapped = cache.load(key, data.size());
+    ARM_COMPUTE_ASSERT(mapped != nullptr);
+    ARM_COMPUTE_EXPECT(std::memcmp(mapped.get(), data.data(), data.size()) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reinterpret_cast<uintptr_t>(mapped.get()) % 128 == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.load(key, data.size() + 1) == nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.load(other_key, data.size()) == nullptr, framework::LogLevel::ERRORS);
+
+    const PreparedWeightsCache::Stats stats = cache.stats();
+    ARM_COMPUTE_EXPECT(stats.hits == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.misses == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.stores == 1, framework::LogLevel::ERRORS);
+
+    cache.set_directory(previous_directory);
+}
+
+/** Validate that the hash only depends on the elements of the tensor */
+TEST_CASE(HashIgnoresPadding, framework::DatasetMode::ALL)
+{
+    const TensorInfo info(TensorShape(17U, 5U, 3U), 1, DataType::F32);
+    TensorInfo       padded_info(info);
+    padded_info.extend_padding(PaddingSize(1, 3, 2, 1));
+
+    Tensor tensor;
+    Tensor padded_tensor;
+    tensor.allocator()->init(info);
+    padded_tensor.allocator()->init(padded_info);
+    tensor.allocator()->allocate();
+    padded_tensor.allocator()->allocate();
+    std::memset(padded_tensor.buffer(), 0xFF, padded_tensor.info()->total_size());
+
+    library->fill_tensor_uniform(Accessor(tensor), 0);
+    library->fill_tensor_uniform(Accessor(padded_tensor), 0);
+    ARM_COMPUTE_EXPECT(PreparedWeightsCache::hash(tensor) == PreparedWeightsCache::hash(padded_tensor),
+                       framework::LogLevel::ERRORS);
+
+    *reinterpret_cast<float *>(tensor.ptr_to_element(Coordinates(16, 4, 2))) += 1.f;
+    ARM_COMPUTE_EXPECT(PreparedWeightsCache::hash(tensor) != PreparedWeightsCache::hash(padded_tensor),
+                       framework::LogLevel::ERRORS);
+}
+
+/** Validate that shared weights are found while an operator uses them, and released with the last one */
+TEST_CASE(ShareInProcess, framework::DatasetMode::ALL)
+{
+    PreparedWeightsCache &cache = PreparedWeightsCache::get();
+
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 3);
+    }
+    const std::string key = PreparedWeightsCache::make_key("Op", 0x4321, "shared");
+    ARM_COMPUTE_EXPECT(cache.find_shared(key, data.size()) == nullptr, framework::LogLevel::ERRORS);
+
+    std::shared_ptr<const uint8_t> shared = cache.share(key, data.data(), data.size());
+    ARM_COMPUTE_ASSERT(shared != nullptr);
+    ARM_COMPUTE_EXPECT(shared.get() != data.data(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::memcmp(shared.get(), data.data(), data.size()) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reinterpret_cast<uintptr_t>(shared.get()) % 128 == 0, framework::LogLevel::ERRORS);
+
+    // The weights shared first are kept for the other operators
+    const unsigned int shares = cache.stats().shares;
+    ARM_COMPUTE_EXPECT(cache.find_shared(key, data.size()) == shared, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.share(key, data.data(), data.size()) == shared, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.find_shared(key, data.size() + 1) == nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.stats().shares == shares + 2, framework::LogLevel::ERRORS);
+
+    shared.reset();
+    ARM_COMPUTE_EXPECT(cache.find_shared(key, data.size()) == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // PreparedWeightsCache
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/TrackingAllocator.h"
+
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(UNIT)
+TEST_SUITE(TrackingAllocator)
+
+/** Validate that the memory is accounted to the tag current at allocation until it's freed */
+TEST_CASE(AccountPerTag, framework::DatasetMode::ALL)
+{
+    Allocator                      backing_allocator{};
+    arm_compute::TrackingAllocator allocator(&backing_allocator);
+
+    allocator.set_tag(1);
+    auto  region = allocator.make_region(1000, 64);
+    void *ptr    = allocator.allocate(24, 0);
+    ARM_COMPUTE_ASSERT(region->buffer() != nullptr);
+    ARM_COMPUTE_ASSERT(ptr != nullptr);
+    allocator.set_tag(2);
+    auto other_region = allocator.make_region(100, 0);
+    allocator.set_tag(arm_compute::TrackingAllocator::no_tag);
+
+    ARM_COMPUTE_EXPECT(allocator.bytes_held(1) == 1024, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(allocator.bytes_held(2) == 100, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(allocator.bytes_held(3) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(allocator.bytes_held() == 1124, framework::LogLevel::ERRORS);
+
+    region.reset();
+    allocator.free(ptr);
+    ARM_COMPUTE_EXPECT(allocator.bytes_held(1) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(allocator.bytes_held() == 100, framework::LogLevel::ERRORS);
+    other_region.reset();
+    ARM_COMPUTE_EXPECT(allocator.bytes_held() == 0, framework::LogLevel::ERRORS);
+}
+
+/** Validate that the tensors allocated by a thread are tracked when the allocator is set for it */
+TEST_CASE(ThreadAllocator, framework::DatasetMode::ALL)
+{
+    arm_compute::TrackingAllocator allocator{};
+    IAllocator *const              previous_allocator = TensorAllocator::thread_allocator();
+
+    Tensor tensor;
+    tensor.allocator()->init(TensorInfo(TensorShape(16U, 8U), 1, DataType::F32));
+    TensorAllocator::set_thread_allocator(&allocator);
+    allocator.set_tag(7);
+    tensor.allocator()->allocate();
+    TensorAllocator::set_thread_allocator(previous_allocator);
+
+    ARM_COMPUTE_EXPECT(allocator.bytes_held(7) == tensor.info()->total_size(), framework::LogLevel::ERRORS);
+    tensor.allocator()->free();
+    ARM_COMPUTE_EXPECT(allocator.bytes_held(7) == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // TrackingAllocator
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
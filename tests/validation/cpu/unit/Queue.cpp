@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,9 +21,14 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "src/cpu/CpuQueue.h"
 #include "tests/validation/fixtures/UNIT/QueueFixture.h"
 
-#include "src/cpu/CpuQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 namespace arm_compute
 {
@@ -31,6 +36,52 @@ namespace test
 {
 namespace validation
 {
+namespace
+{
+/** Kernel whose workloads wait until a given number of workloads, across all the queues, are running */
+class RendezvousKernel : public ICPPKernel
+{
+public:
+    RendezvousKernel(std::atomic<unsigned int> &arrived, unsigned int expected, unsigned int num_iterations)
+        : _arrived(arrived), _expected(expected)
+    {
+        Window window;
+        window.set(Window::DimX, Window::Dimension(0, num_iterations));
+        configure(window);
+    }
+
+    const char *name() const override
+    {
+        return "RendezvousKernel";
+    }
+
+    void run(const Window &, const ThreadInfo &) override
+    {
+        ++_arrived;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (_arrived.load() < _expected && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+        if (_arrived.load() < _expected)
+        {
+            _timed_out = true;
+        }
+    }
+
+    /** Check that all the workloads met the workloads of the other queues */
+    bool met() const
+    {
+        return !_timed_out.load();
+    }
+
+private:
+    std::atomic<unsigned int> &_arrived;
+    const unsigned int         _expected;
+    std::atomic<bool>          _timed_out{false};
+};
+} // namespace
+
 TEST_SUITE(CPU)
 TEST_SUITE(UNIT)
 TEST_SUITE(Queue)
@@ -40,6 +91,49 @@ EMPTY_BODY_FIXTURE_TEST_CASE(CreateQueuerWithInvalidOptions, CreateQueuerWithInv
 EMPTY_BODY_FIXTURE_TEST_CASE(DestroyInvalidQueue, DestroyInvalidQueueFixture<acl::Target::Cpu>, framework::DatasetMode::ALL)
 EMPTY_BODY_FIXTURE_TEST_CASE(SimpleQueue, SimpleQueueFixture<acl::Target::Cpu>, framework::DatasetMode::ALL)
 
+TEST_CASE(CreateQueueOnInvalidCpuSet, framework::DatasetMode::ALL)
+{
+    acl::Context ctx(acl::Target::Cpu);
+
+    AclQueue              queue        = nullptr;
+    const int32_t         cpu_ids[]    = {0, -1};
+    AclQueueCpuSetOptions invalid_opts = {{AclTuningModeNone, 2}, nullptr, 2};
+    ARM_COMPUTE_ASSERT(AclCreateQueueOnCpuSet(&queue, ctx.get(), &invalid_opts) == AclStatus::AclInvalidArgument);
+
+    invalid_opts.cpu_ids = cpu_ids;
+    ARM_COMPUTE_ASSERT(AclCreateQueueOnCpuSet(&queue, ctx.get(), &invalid_opts) == AclStatus::AclInvalidArgument);
+    ARM_COMPUTE_ASSERT(AclCreateQueueOnCpuSet(&queue, ctx.get(), nullptr) == AclStatus::AclInvalidArgument);
+}
+
+#if defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+TEST_CASE(BoundQueuesRunConcurrently, framework::DatasetMode::ALL)
+{
+    const int32_t num_cpus = std::max(1U, std::thread::hardware_concurrency());
+
+    acl::Context ctx(acl::Target::Cpu);
+    acl::Queue   queue0(ctx, acl::Queue::Options(std::vector<int32_t>{0, 1 % num_cpus}));
+    acl::Queue   queue1(ctx, acl::Queue::Options(std::vector<int32_t>{2 % num_cpus, 3 % num_cpus}));
+
+    IScheduler &scheduler0 = static_cast<cpu::CpuQueue *>(get_internal(queue0.get()))->scheduler();
+    IScheduler &scheduler1 = static_cast<cpu::CpuQueue *>(get_internal(queue1.get()))->scheduler();
+    ARM_COMPUTE_ASSERT(&scheduler0 != &scheduler1);
+    // One worker thread per core of the set, plus the calling thread
+    ARM_COMPUTE_ASSERT(scheduler0.num_threads() == 3 && scheduler1.num_threads() == 3);
+
+    // Each workload only completes once the two workloads of each queue are running at the same time
+    std::atomic<unsigned int> arrived{0};
+    RendezvousKernel          kernel0(arrived, 4, 2);
+    RendezvousKernel          kernel1(arrived, 4, 2);
+
+    std::thread thread1([&]() { scheduler1.schedule(&kernel1, IScheduler::Hints(Window::DimX)); });
+    scheduler0.schedule(&kernel0, IScheduler::Hints(Window::DimX));
+    thread1.join();
+
+    ARM_COMPUTE_EXPECT(kernel0.met(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel1.met(), framework::LogLevel::ERRORS);
+}
+#endif /* defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL) */
+
 TEST_SUITE_END() // Queue
 TEST_SUITE_END() // UNIT
 TEST_SUITE_END() // CPU
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,8 +37,11 @@
 #include "tests/validation/Validation.h"
 #include "tests/validation/reference/ActivationLayer.h"
 #include "tests/validation/reference/FullyConnectedLayer.h"
+#include "tests/validation/reference/GEMM.h"
+#include "tests/validation/reference/Transpose.h"
 #include "tests/validation/reference/Utils.h"
 
+#include <algorithm>
 #include <random>
 
 namespace arm_compute
@@ -174,6 +177,73 @@ protected:
         }
     }
 
+    /** Fill the weights of the target, after their allocation
+     *
+     * Fixtures with weights of a specific format or content override it.
+     *
+     * @param[in, out] weights Weights to fill
+     */
+    virtual void fill_weights(TensorType &weights)
+    {
+        fill(AccessorType(weights), 1 + _hash);
+    }
+
+    /** Compute a fully connected layer on the target with the weights filled by @ref fill_weights
+     *
+     * The source is filled with the seed 0 and the bias with the seed 2.
+     *
+     * @param[in] input_shape       Shape of the source
+     * @param[in] weights_shape     Shape of the weights
+     * @param[in] output_shape      Shape of the destination
+     * @param[in] weights_data_type Data type of the weights, the other tensors are of type _data_type
+     * @param[in] has_bias          True to pass the bias to the function
+     * @param[in] configure         Callable configuring the function on (fc, src, weights, bias, dst), with bias
+     *                              nullptr without bias. It can also add padding to the tensors.
+     *
+     * @return The destination tensor
+     */
+    template <typename ConfigureFunction>
+    TensorType compute_target_with_weights(const TensorShape &input_shape, const TensorShape &weights_shape,
+                                           const TensorShape &output_shape, DataType weights_data_type, bool has_bias,
+                                           ConfigureFunction &&configure)
+    {
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, _data_type, 1);
+        TensorType weights = create_tensor<TensorType>(weights_shape, weights_data_type, 1);
+        TensorType bias    = create_tensor<TensorType>(TensorShape(output_shape[0]), _data_type, 1);
+        TensorType dst     = create_tensor<TensorType>(output_shape, _data_type, 1);
+
+        // Create and configure function
+        FunctionType fc;
+        configure(fc, src, weights, has_bias ? &bias : nullptr, dst);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src), 0 + _hash);
+        fill_weights(weights);
+        fill(AccessorType(bias), 2 + _hash);
+
+        // Compute fully connected function
+        fc.run();
+
+        return dst;
+    }
+
     TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape, bool transpose_weights,
                               bool reshape_weights)
     {
@@ -257,7 +327,7 @@ protected:
         }
         else
         {
-            fill(AccessorType(weights), 1 + _hash);
+            fill_weights(weights);
         }
 
         if(_mixed_layout)
@@ -337,6 +407,158 @@ public:
     }
 };
 
+/** Validates a fully connected layer with block-quantized signed 4-bit weights, see @ref Int4WeightsInfo */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FullyConnectedInt4ValidationFixture
+    : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape input_shape, unsigned int num_outputs, unsigned int group_size, DataType scale_data_type,
+               bool has_zero_points, bool has_bias, bool fast_math, ActivationLayerInfo activation_info,
+               DataType data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _int4_info = Int4WeightsInfo(group_size, scale_data_type, has_zero_points);
+        _weights   = generate_int4_weights(input_shape[0], num_outputs, _int4_info, library->seed());
+
+        FullyConnectedLayerInfo fc_info;
+        fc_info.activation_info   = activation_info;
+        fc_info.enable_fast_math  = fast_math;
+        fc_info.int4_weights_info = _int4_info;
+
+        this->_data_type       = data_type;
+        this->_activation_info = activation_info;
+        this->_target          = compute_target(input_shape, fc_info, has_bias);
+        this->_reference       = compute_reference(input_shape, has_bias);
+    }
+
+protected:
+    void fill_weights(TensorType &weights) override
+    {
+        AccessorType weights_accessor(weights);
+        pack_int4_weights(_weights, _int4_info, weights_accessor);
+    }
+
+    TensorType compute_target(const TensorShape &input_shape, const FullyConnectedLayerInfo &fc_info, bool has_bias)
+    {
+        TensorShape output_shape = input_shape;
+        output_shape.set(0, _weights.n);
+        const TensorShape weights_shape(_int4_info.row_size(_weights.k), _weights.n);
+
+        const auto configure = [&](FunctionType &fc, TensorType &src, TensorType &weights, TensorType *bias,
+                                   TensorType &dst)
+        {
+            fc.configure(&src, &weights, bias, &dst, fc_info);
+            add_padding_x({ &src, &dst });
+        };
+        return this->compute_target_with_weights(input_shape, weights_shape, output_shape, DataType::U8, has_bias,
+                                                 configure);
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape, bool has_bias)
+    {
+        // Create reference
+        SimpleTensor<T> src{ input_shape, this->_data_type, 1 };
+        SimpleTensor<T> bias{ TensorShape(_weights.n), this->_data_type, 1 };
+
+        // Fill reference
+        this->fill(src, 0);
+        if(has_bias)
+        {
+            this->fill(bias, 2);
+        }
+        else
+        {
+            std::fill_n(bias.data(), bias.num_elements(), T(0));
+        }
+
+        return reference::activation_layer(reference::gemm_int4<T>(src, _weights, bias), this->_activation_info);
+    }
+
+    Int4WeightsInfo _int4_info{};
+    Int4Weights     _weights{};
+};
+
+/** Validates a fully connected layer with sparse F32 weights, see @ref WeightsInfo::weights_sparsity() */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FullyConnectedSparseValidationFixture
+    : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape input_shape, unsigned int num_outputs, WeightsSparsity sparsity, float zero_blocks_ratio,
+               bool has_bias, ActivationLayerInfo activation_info, DataType data_type)
+    {
+        // The weights of the layer are the transposed GEMM weights, of shape [K, N]
+        _weights = reference::transpose(
+            generate_sparse_weights(input_shape[0], num_outputs, sparsity, zero_blocks_ratio, library->seed()));
+
+        FullyConnectedLayerInfo fc_info;
+        fc_info.activation_info = activation_info;
+
+        WeightsInfo weights_info;
+        weights_info.set_weights_sparsity(sparsity);
+
+        this->_data_type       = data_type;
+        this->_activation_info = activation_info;
+        this->_target          = compute_target(input_shape, fc_info, weights_info, has_bias);
+        this->_reference       = compute_reference(input_shape, has_bias);
+    }
+
+protected:
+    void fill_weights(TensorType &weights) override
+    {
+        library->fill_static_values(AccessorType(weights),
+                                    std::vector<T>(_weights.data(), _weights.data() + _weights.num_elements()));
+    }
+
+    TensorType compute_target(const TensorShape &input_shape, const FullyConnectedLayerInfo &fc_info,
+                              const WeightsInfo &weights_info, bool has_bias)
+    {
+        TensorShape output_shape = input_shape;
+        output_shape.set(0, _weights.shape()[1]);
+
+        const auto configure = [&](FunctionType &fc, TensorType &src, TensorType &weights, TensorType *bias,
+                                   TensorType &dst)
+        {
+            fc.configure(&src, &weights, bias, &dst, fc_info, weights_info);
+            add_padding_x({ &src, &weights, &dst });
+        };
+        return this->compute_target_with_weights(input_shape, _weights.shape(), output_shape, this->_data_type,
+                                                 has_bias, configure);
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape, bool has_bias)
+    {
+        TensorShape output_shape = input_shape;
+        output_shape.set(0, _weights.shape()[1]);
+
+        // Create reference
+        SimpleTensor<T> src{ input_shape, this->_data_type, 1 };
+        SimpleTensor<T> bias{ TensorShape(_weights.shape()[1]), this->_data_type, 1 };
+
+        // Fill reference
+        this->fill(src, 0);
+        if(has_bias)
+        {
+            this->fill(bias, 2);
+        }
+        else
+        {
+            std::fill_n(bias.data(), bias.num_elements(), T(0));
+        }
+
+        return reference::activation_layer(reference::fully_connected_layer<T>(src, _weights, bias, output_shape),
+                                           this->_activation_info);
+    }
+
+    SimpleTensor<T> _weights{};
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
 class FullyConnectedWithDynamicTensorsFixture : public framework::Fixture
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,7 +37,9 @@
 #include "tests/validation/reference/ElementwiseOperations.h"
 #include "tests/validation/reference/GEMM.h"
 
+#include <algorithm>
 #include <random>
+#include <vector>
 
 namespace arm_compute
 {
@@ -85,6 +87,76 @@ protected:
         }
     }
 
+    /** Fill the weights B of the target, after their allocation
+     *
+     * Fixtures with weights of a specific format or content override it.
+     *
+     * @param[in, out] b Weights to fill
+     */
+    virtual void fill_weights(TensorType &b)
+    {
+        fill(AccessorType(b), 1);
+    }
+
+    /** Compute a GEMM on the target with the weights filled by @ref fill_weights
+     *
+     * A is filled with the seed 0, C with the seed 2 and the destination with the seed 3.
+     *
+     * @param[in] shape_a     Shape of the input A
+     * @param[in] shape_b     Shape of the weights B
+     * @param[in] shape_c     Shape of the bias C
+     * @param[in] shape_dst   Shape of the destination
+     * @param[in] data_type   Data type of A, C and the destination
+     * @param[in] data_type_b Data type of B
+     * @param[in] has_bias    True to pass C to the function
+     * @param[in] configure   Callable configuring the function on (gemm, a, b, c, dst), with c nullptr without bias.
+     *                        It can also add padding to the tensors.
+     *
+     * @return The destination tensor
+     */
+    template <typename ConfigureFunction>
+    TensorType compute_target_with_weights(const TensorShape &shape_a, const TensorShape &shape_b,
+                                           const TensorShape &shape_c, const TensorShape &shape_dst, DataType data_type,
+                                           DataType data_type_b, bool has_bias, ConfigureFunction &&configure)
+    {
+        // Create tensors
+        TensorType a   = create_tensor<TensorType>(shape_a, data_type, 1);
+        TensorType b   = create_tensor<TensorType>(shape_b, data_type_b, 1);
+        TensorType c   = create_tensor<TensorType>(shape_c, data_type, 1);
+        TensorType dst = create_tensor<TensorType>(shape_dst, data_type, 1);
+
+        // Create and configure function
+        FunctionType gemm;
+        configure(gemm, a, b, has_bias ? &c : nullptr, dst);
+
+        ARM_COMPUTE_ASSERT(a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(c.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        c.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!c.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(a), 0);
+        fill_weights(b);
+        fill(AccessorType(c), 2);
+        fill(AccessorType(dst), 3);
+
+        // Compute GEMM function
+        gemm.run();
+
+        return dst;
+    }
+
     TensorType compute_target(const TensorShape &input_shape_a, const TensorShape &input_shape_b, const TensorShape &input_shape_c, const TensorShape &output_shape, float alpha, float beta,
                               DataType data_type, bool accumulate, bool dynamic, bool constant_b_and_c)
     {
@@ -158,7 +230,7 @@ protected:
 
         // Fill tensors
         fill(AccessorType(a), 0);
-        fill(AccessorType(b), 1);
+        fill_weights(b);
         if (accumulate)
         {
             fill(AccessorType(dst), 6);
@@ -339,6 +411,262 @@ public:
     }
 };
 
+/** Validates a GEMM of a F32/F16 matrix with block-quantized signed 4-bit weights, see @ref Int4WeightsInfo */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GEMMInt4ValidationFixture : protected GEMMGenericValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape shape_a, unsigned int n, unsigned int group_size, DataType scale_data_type,
+               bool has_zero_points, bool has_bias, bool fast_math, ActivationLayerInfo act_info, DataType data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _int4_info = Int4WeightsInfo(group_size, scale_data_type, has_zero_points);
+        _weights   = generate_int4_weights(shape_a[0], n, _int4_info, library->seed());
+
+        GEMMInfo gemm_info;
+        gemm_info.set_fast_math(fast_math);
+        gemm_info.set_activation_info(act_info);
+        gemm_info.set_int4_weights_info(_int4_info);
+
+        this->_target    = compute_target(shape_a, gemm_info, has_bias, data_type);
+        this->_reference = compute_reference(shape_a, act_info, has_bias, data_type);
+    }
+
+protected:
+    void fill_weights(TensorType &b) override
+    {
+        AccessorType b_accessor(b);
+        pack_int4_weights(_weights, _int4_info, b_accessor);
+    }
+
+    TensorType compute_target(const TensorShape &shape_a, const GEMMInfo &gemm_info, bool has_bias, DataType data_type)
+    {
+        TensorShape output_shape = shape_a;
+        output_shape.set(0, _weights.n);
+        const TensorShape shape_b(_int4_info.row_size(_weights.k), _weights.n);
+
+        const auto configure = [&](FunctionType &gemm, TensorType &a, TensorType &b, TensorType *c, TensorType &dst)
+        {
+            gemm.configure(&a, &b, c, &dst, 1.f, 1.f, gemm_info);
+            add_padding_x({ &a, &dst });
+        };
+        return this->compute_target_with_weights(shape_a, shape_b, TensorShape(_weights.n), output_shape, data_type,
+                                                 DataType::U8, has_bias, configure);
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape_a, const ActivationLayerInfo &act_info, bool has_bias,
+                                      DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> a{ shape_a, data_type, 1 };
+        SimpleTensor<T> bias{ TensorShape(_weights.n), data_type, 1 };
+
+        // Fill reference
+        this->fill(a, 0);
+        if(has_bias)
+        {
+            this->fill(bias, 2);
+        }
+        else
+        {
+            std::fill_n(bias.data(), bias.num_elements(), T(0));
+        }
+
+        const SimpleTensor<T> dst = reference::gemm_int4<T>(a, _weights, bias);
+        return act_info.enabled() ? reference::activation_layer<T>(dst, act_info) : dst;
+    }
+
+    Int4WeightsInfo _int4_info{};
+    Int4Weights     _weights{};
+};
+
+/** Validates a GEMM of a F32 matrix with sparse weights, see @ref GEMMInfo::weights_sparsity()
+ *
+ * The weights are provided dense with explicit zeros following the sparsity pattern, and the reference is the dense
+ * GEMM on the same weights.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GEMMSparseValidationFixture : protected GEMMGenericValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape shape_a, unsigned int n, WeightsSparsity sparsity, float zero_blocks_ratio, bool has_bias,
+               ActivationLayerInfo act_info, DataType data_type)
+    {
+        _weights = generate_sparse_weights(shape_a[0], n, sparsity, zero_blocks_ratio, library->seed());
+
+        GEMMInfo gemm_info;
+        gemm_info.set_activation_info(act_info);
+        gemm_info.set_weights_sparsity(sparsity);
+
+        this->_target    = compute_target(shape_a, gemm_info, has_bias, data_type);
+        this->_reference = compute_reference(shape_a, act_info, has_bias, data_type);
+    }
+
+protected:
+    void fill_weights(TensorType &b) override
+    {
+        library->fill_static_values(AccessorType(b),
+                                    std::vector<T>(_weights.data(), _weights.data() + _weights.num_elements()));
+    }
+
+    TensorType compute_target(const TensorShape &shape_a, const GEMMInfo &gemm_info, bool has_bias, DataType data_type)
+    {
+        TensorShape output_shape = shape_a;
+        output_shape.set(0, _weights.shape()[0]);
+
+        const auto configure = [&](FunctionType &gemm, TensorType &a, TensorType &b, TensorType *c, TensorType &dst)
+        {
+            gemm.configure(&a, &b, c, &dst, 1.f, 1.f, gemm_info);
+            add_padding_x({ &a, &b, &dst });
+        };
+        return this->compute_target_with_weights(shape_a, _weights.shape(), TensorShape(_weights.shape()[0]),
+                                                 output_shape, data_type, data_type, has_bias, configure);
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape_a, const ActivationLayerInfo &act_info, bool has_bias,
+                                      DataType data_type)
+    {
+        TensorShape output_shape = shape_a;
+        output_shape.set(0, _weights.shape()[0]);
+
+        // Create reference
+        SimpleTensor<T> a{ shape_a, data_type, 1 };
+        SimpleTensor<T> bias{ TensorShape(_weights.shape()[0]), data_type, 1 };
+        SimpleTensor<T> c{ output_shape, data_type, 1 };
+
+        // Fill reference
+        this->fill(a, 0);
+        this->fill(bias, 2);
+        for(int i = 0; i < c.num_elements(); ++i)
+        {
+            c[i] = has_bias ? bias[i % bias.num_elements()] : T(0);
+        }
+
+        const SimpleTensor<T> dst = reference::gemm<T>(a, _weights, c, 1.f, 1.f);
+        return act_info.enabled() ? reference::activation_layer<T>(dst, act_info) : dst;
+    }
+
+    SimpleTensor<T> _weights{};
+};
+
+/** Validates a batched GEMM computing many independent products of differently sized matrices
+ *
+ * All the matrices of a same operand are stored in a single 1D tensor, the problems describe the views on them.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GEMMBatchedValidationFixture : protected GEMMGenericValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    /** Set up the test
+     *
+     * @param[in] num_problems Number of independent matrix products
+     * @param[in] shared_rhs   True if all the problems multiply with the same B matrix
+     * @param[in] strided      True to use row strides larger than the matrix widths for A and D, and a transposed B
+     * @param[in] has_bias     True if a bias is added to each row of the results
+     * @param[in] act_info     Activation fused to the products
+     * @param[in] data_type    Data type of all the tensors
+     */
+    void setup(unsigned int num_problems, bool shared_rhs, bool strided, bool has_bias, ActivationLayerInfo act_info,
+               DataType data_type)
+    {
+        generate_problems(num_problems, shared_rhs, strided);
+
+        GEMMInfo gemm_info;
+        gemm_info.set_activation_info(act_info);
+
+        this->_target    = compute_target(gemm_info, has_bias, data_type);
+        this->_reference = compute_reference(act_info, has_bias, data_type);
+    }
+
+protected:
+    void generate_problems(unsigned int num_problems, bool shared_rhs, bool strided)
+    {
+        std::mt19937                                gen(library->seed());
+        std::uniform_int_distribution<unsigned int> m_dist(1U, 20U);
+        std::uniform_int_distribution<unsigned int> n_dist(1U, 40U);
+        std::uniform_int_distribution<unsigned int> k_dist(1U, 48U);
+
+        const unsigned int shared_n = n_dist(gen);
+        const unsigned int shared_k = k_dist(gen);
+
+        _problems.clear();
+        _a_size    = 0;
+        _b_size    = 0;
+        _bias_size = 0;
+        _d_size    = 0;
+
+        for(unsigned int i = 0; i < num_problems; ++i)
+        {
+            const unsigned int m = m_dist(gen);
+            const unsigned int n = shared_rhs ? shared_n : n_dist(gen);
+            const unsigned int k = shared_rhs ? shared_k : k_dist(gen);
+
+            GEMMBatchedProblem problem(m, n, k, _a_size, shared_rhs ? 0 : _b_size, _d_size, _bias_size);
+            if(strided)
+            {
+                problem.lda        = k + 3;
+                problem.ldd        = n + 2;
+                problem.b_stride_k = 1;
+                problem.b_stride_n = k;
+            }
+
+            _a_size += m * problem.lda;
+            _b_size += (shared_rhs && i > 0) ? 0 : n * k;
+            _bias_size += n;
+            _d_size += m * problem.ldd;
+
+            _problems.push_back(problem);
+        }
+    }
+
+    TensorType compute_target(const GEMMInfo &gemm_info, bool has_bias, DataType data_type)
+    {
+        // The destination is filled before the run, the elements outside of the views must be left untouched
+        const auto configure = [&](FunctionType &gemm, TensorType &a, TensorType &b, TensorType *c, TensorType &d)
+        {
+            gemm.configure(&a, &b, c, &d, _problems, gemm_info);
+        };
+        return this->compute_target_with_weights(TensorShape(_a_size), TensorShape(_b_size), TensorShape(_bias_size),
+                                                 TensorShape(_d_size), data_type, data_type, has_bias, configure);
+    }
+
+    SimpleTensor<T> compute_reference(const ActivationLayerInfo &act_info, bool has_bias, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> a{ TensorShape(_a_size), data_type, 1 };
+        SimpleTensor<T> b{ TensorShape(_b_size), data_type, 1 };
+        SimpleTensor<T> bias{ TensorShape(_bias_size), data_type, 1 };
+        SimpleTensor<T> d{ TensorShape(_d_size), data_type, 1 };
+
+        // Fill reference
+        this->fill(a, 0);
+        this->fill(b, 1);
+        if(has_bias)
+        {
+            this->fill(bias, 2);
+        }
+        else
+        {
+            std::fill_n(bias.data(), bias.num_elements(), T(0));
+        }
+        this->fill(d, 3);
+
+        reference::gemm_batched<T>(a, b, bias, _problems, act_info, d);
+        return d;
+    }
+
+    std::vector<GEMMBatchedProblem> _problems{};
+    size_t                          _a_size{ 0 };
+    size_t                          _b_size{ 0 };
+    size_t                          _bias_size{ 0 };
+    size_t                          _d_size{ 0 };
+};
+
 template <typename TensorType, typename AccessorType, typename T, typename GEMMOperatorType>
 class GEMMMatrixMultiplyValidationFixture : public framework::Fixture
 {
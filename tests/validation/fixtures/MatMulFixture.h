@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,7 @@
 #include "tests/validation/reference/ReshapeLayer.h"
 #include "tests/validation/Validation.h"
 
+#include <algorithm>
 #include <limits>
 #include <random>
 #include <type_traits>
@@ -612,6 +613,121 @@ public:
     }
 };
 
+/** Validates a MatMul with block-quantized signed 4-bit rhs, see @ref Int4WeightsInfo
+ *
+ * The rhs is stored transposed, with one row per output column, and is shared by all the batches of the lhs.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename Settings, typename T>
+class MatMulInt4ValidationFixture
+    : public MatMulGenericValidationFixture<TensorType, AccessorType, FunctionType, Settings, T>
+{
+public:
+    void setup(TensorShape         shape_a,
+               unsigned int        n,
+               unsigned int        group_size,
+               DataType            scale_data_type,
+               bool                has_zero_points,
+               bool                constant_weights,
+               bool                fast_math,
+               ActivationLayerInfo act_info,
+               DataType            data_type)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const Int4WeightsInfo int4_info(group_size, scale_data_type, has_zero_points);
+        _weights          = generate_int4_weights(shape_a[0], n, int4_info, library->seed());
+        _constant_weights = constant_weights;
+
+        TensorShape output_shape = shape_a;
+        output_shape.set(0, n);
+
+        // Run twice, so that constant weights are only packed by the first run
+        const Settings    settings = Settings().fast_math(fast_math).int4_weights_info(int4_info);
+        const TensorShape shape_b(int4_info.row_size(shape_a[0]), n);
+        this->_target    = compute_target(shape_a, shape_b, output_shape, false, true, data_type, act_info,
+                                          1 /* num_extra_runs */, settings, QuantizationInfo(), QuantizationInfo(),
+                                          QuantizationInfo());
+        this->_reference = compute_reference(shape_a, act_info, data_type);
+    }
+
+protected:
+    TensorType compute_target(const TensorShape  &shape_a,
+                              const TensorShape  &shape_b,
+                              const TensorShape  &output_shape,
+                              bool                transpose_a,
+                              bool                transpose_b,
+                              DataType            data_type,
+                              ActivationLayerInfo act_info,
+                              int                 num_extra_runs,
+                              const Settings     &settings,
+                              QuantizationInfo    a_qinfo,
+                              QuantizationInfo    b_qinfo,
+                              QuantizationInfo    o_qinfo) override
+    {
+        ARM_COMPUTE_UNUSED(b_qinfo);
+
+        TensorType a   = create_tensor<TensorType>(shape_a, data_type, 1, a_qinfo);
+        TensorType b   = create_tensor<TensorType>(shape_b, DataType::U8, 1);
+        TensorType dst = create_tensor<TensorType>(output_shape, data_type, 1, o_qinfo);
+
+        MatMulInfo mm_info;
+        mm_info.adj_lhs(transpose_a).adj_rhs(transpose_b);
+
+        a.info()->set_are_values_constant(false);
+        b.info()->set_are_values_constant(_constant_weights);
+
+        FunctionType matmul;
+        matmul.configure(&a, &b, &dst, mm_info, settings, act_info);
+
+        ARM_COMPUTE_ASSERT(a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        AccessorType b_accessor(b);
+        pack_int4_weights(_weights, settings.int4_weights_info(), b_accessor);
+
+        // Only the lhs changes between the runs, as constant weights are not read again after the first run
+        for (int i = 0; i < num_extra_runs; i++)
+        {
+            this->fill(AccessorType(a), num_extra_runs * 100);
+            matmul.run();
+        }
+
+        this->fill(AccessorType(a), 2);
+        matmul.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T>
+    compute_reference(const TensorShape &shape_a, const ActivationLayerInfo &act_info, DataType data_type)
+    {
+        SimpleTensor<T> a{shape_a, data_type, 1};
+        SimpleTensor<T> bias{TensorShape(_weights.n), data_type, 1};
+
+        this->fill(a, 2);
+        std::fill_n(bias.data(), bias.num_elements(), T(0));
+
+        const SimpleTensor<T> dst = reference::gemm_int4<T>(a, _weights, bias);
+        return act_info.enabled() ? reference::activation_layer<T>(dst, act_info) : dst;
+    }
+
+    Int4Weights _weights{};
+    bool        _constant_weights{false};
+};
+
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Types.h"
+#include "tests/validation/reference/ActivationLayer.h"
 #include "tests/validation/reference/ArithmeticOperations.h"
 
 namespace arm_compute
@@ -193,10 +194,87 @@ void gemm_accumulate(const SimpleTensor<T> &a, const SimpleTensor<T> &b, const S
     reference::arithmetic_operation<T>(reference::ArithmeticOperation::ADD, dst, dst_gemm, dst, ConvertPolicy::SATURATE);
 }
 
+template <typename T, typename std::enable_if<is_floating_point<T>::value, int>::type>
+SimpleTensor<T> gemm_int4(const SimpleTensor<T> &a, const Int4Weights &b, const SimpleTensor<T> &bias)
+{
+    const size_t num_groups = b.scales.size() / b.n;
+
+    TensorShape dst_shape = a.shape();
+    dst_shape.set(0, b.n);
+
+    SimpleTensor<float> a_f32{a.shape(), DataType::F32};
+    SimpleTensor<float> b_f32{TensorShape(b.n, b.k), DataType::F32};
+    SimpleTensor<float> c_f32{dst_shape, DataType::F32};
+
+    for (int i = 0; i < a.num_elements(); ++i)
+    {
+        a_f32[i] = static_cast<float>(a[i]);
+    }
+    for (int i = 0; i < c_f32.num_elements(); ++i)
+    {
+        c_f32[i] = static_cast<float>(bias[i % b.n]);
+    }
+    for (size_t col = 0; col < b.n; ++col)
+    {
+        for (size_t k = 0; k < b.k; ++k)
+        {
+            const size_t group   = col * num_groups + k / b.group_size;
+            const int    value   = b.values[col * num_groups * b.group_size + k];
+            b_f32[k * b.n + col] = (value - b.zero_points[group]) * b.scales[group];
+        }
+    }
+
+    const SimpleTensor<float> dst_f32 = gemm<float>(a_f32, b_f32, c_f32, 1.f, 1.f);
+
+    SimpleTensor<T> dst{dst_shape, a.data_type()};
+    for (int i = 0; i < dst.num_elements(); ++i)
+    {
+        dst[i] = static_cast<T>(dst_f32[i]);
+    }
+    return dst;
+}
+
+template <typename T, typename std::enable_if<is_floating_point<T>::value, int>::type>
+void gemm_batched(const SimpleTensor<T>                 &a,
+                  const SimpleTensor<T>                 &b,
+                  const SimpleTensor<T>                 &bias,
+                  const std::vector<GEMMBatchedProblem> &problems,
+                  const ActivationLayerInfo             &act_info,
+                  SimpleTensor<T>                       &dst)
+{
+    for (const auto &p : problems)
+    {
+        for (size_t row = 0; row < p.m; ++row)
+        {
+            for (size_t col = 0; col < p.n; ++col)
+            {
+                T acc = bias[p.bias_offset + col];
+                for (size_t i = 0; i < p.k; ++i)
+                {
+                    acc += a[p.a_offset + row * p.lda + i] * b[p.b_offset + i * p.b_stride_k + col * p.b_stride_n];
+                }
+                if (act_info.enabled())
+                {
+                    acc = activate_float<T>(acc, act_info.a(), act_info.b(), act_info.activation());
+                }
+                dst[p.d_offset + row * p.ldd + col] = acc;
+            }
+        }
+    }
+}
+
 template SimpleTensor<bfloat16> gemm(const SimpleTensor<bfloat16> &a, const SimpleTensor<bfloat16> &b, const SimpleTensor<bfloat16> &c, float alpha, float beta, bool fast_math=false);
 template SimpleTensor<float> gemm(const SimpleTensor<float> &a, const SimpleTensor<float> &b, const SimpleTensor<float> &c, float alpha, float beta, bool fast_math=false);
 template SimpleTensor<half> gemm(const SimpleTensor<half> &a, const SimpleTensor<half> &b, const SimpleTensor<half> &c, float alpha, float beta, bool fast_math=false);
 
+template SimpleTensor<float>
+gemm_int4(const SimpleTensor<float> &a, const Int4Weights &b, const SimpleTensor<float> &bias);
+template SimpleTensor<half>
+gemm_int4(const SimpleTensor<half> &a, const Int4Weights &b, const SimpleTensor<half> &bias);
+
+template void gemm_batched(const SimpleTensor<float> &a, const SimpleTensor<float> &b, const SimpleTensor<float> &bias, const std::vector<GEMMBatchedProblem> &problems,
+                           const ActivationLayerInfo &act_info, SimpleTensor<float> &dst);
+
 template void gemm_accumulate(const SimpleTensor<float> &a, const SimpleTensor<float> &b, const SimpleTensor<float> &c, float alpha, float beta, SimpleTensor<float> &dst);
 template void gemm_accumulate(const SimpleTensor<half> &a, const SimpleTensor<half> &b, const SimpleTensor<half> &c, float alpha, float beta, SimpleTensor<half> &dst);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,9 +24,13 @@
 #ifndef ACL_TESTS_VALIDATION_REFERENCE_GEMM_H
 #define ACL_TESTS_VALIDATION_REFERENCE_GEMM_H
 
+#include "arm_compute/function_info/GEMMBatchedInfo.h"
+
 #include "tests/SimpleTensor.h"
 #include "tests/validation/Helpers.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
@@ -44,6 +48,34 @@ SimpleTensor<Tout> gemm_mixed_precision(const SimpleTensor<T> &a, const SimpleTe
 template <typename T, typename std::enable_if<is_floating_point<T>::value, int>::type = 0>
 void gemm_accumulate(const SimpleTensor<T> &a, const SimpleTensor<T> &b, const SimpleTensor<T> &c, float alpha, float beta, SimpleTensor<T> &dst);
 
+/** GEMM of a F32/F16 matrix with block-quantized signed 4-bit weights, computed in F32 on the dequantized weights
+ *
+ * @param[in] a    Lhs of shape [K, M, batches]
+ * @param[in] b    Weights, shared by all the batches of @p a
+ * @param[in] bias Bias of shape [N], added to every row of the result
+ *
+ * @return The result of shape [N, M, batches]
+ */
+template <typename T, typename std::enable_if<is_floating_point<T>::value, int>::type = 0>
+SimpleTensor<T> gemm_int4(const SimpleTensor<T> &a, const Int4Weights &b, const SimpleTensor<T> &bias);
+
+/** Batched GEMM of independent matrix products, each one computed on views of the tensors, see @ref GEMMBatchedProblem
+ *
+ * @param[in]      a        Tensor holding the A matrices
+ * @param[in]      b        Tensor holding the B matrices
+ * @param[in]      bias     Tensor holding the biases, added to every row of the results
+ * @param[in]      problems Problems of the batched GEMM
+ * @param[in]      act_info Activation applied to the results
+ * @param[in, out] dst      Tensor holding the D matrices. The elements outside of the views are left untouched
+ */
+template <typename T, typename std::enable_if<is_floating_point<T>::value, int>::type = 0>
+void gemm_batched(const SimpleTensor<T>                 &a,
+                  const SimpleTensor<T>                 &b,
+                  const SimpleTensor<T>                 &bias,
+                  const std::vector<GEMMBatchedProblem> &problems,
+                  const ActivationLayerInfo             &act_info,
+                  SimpleTensor<T>                       &dst);
+
 } // namespace reference
 } // namespace validation
 } // namespace test
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/experimental/WorkspaceArena.h"
+
+#include "arm_compute/runtime/experimental/operators/CpuGemm.h"
+
+#include "src/core/helpers/MemoryHelpers.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using arm_compute::experimental::MemoryInfo;
+using arm_compute::experimental::MemoryLifetime;
+using arm_compute::experimental::WorkspaceArena;
+
+TEST_SUITE(NEON)
+TEST_SUITE(OPERATORS)
+TEST_SUITE(WorkspaceArena)
+
+/** Test case for the layout of the workspace tensors in @ref arm_compute::experimental::WorkspaceArena
+ *
+ * Checks performed in order:
+ * - The Persistent tensors of the operators don't overlap
+ * - The Temporary tensors of different operators share memory
+ * - The Prepare and Temporary tensors of an operator don't overlap
+ * - The tensors are added to the right packs
+ */
+TEST_CASE(Layout, framework::DatasetMode::ALL)
+{
+    WorkspaceArena     arena;
+    const unsigned int id0 = arena.add_operator({MemoryInfo(ACL_INT_VEC, MemoryLifetime::Temporary, 100, 64),
+                                                 MemoryInfo(ACL_INT_VEC + 1, MemoryLifetime::Persistent, 200, 64),
+                                                 MemoryInfo(ACL_INT_VEC + 2, MemoryLifetime::Prepare, 50, 64),
+                                                 MemoryInfo(ACL_INT_VEC + 3, MemoryLifetime::Temporary, 0, 64)});
+    const unsigned int id1 = arena.add_operator({MemoryInfo(ACL_INT_VEC, MemoryLifetime::Temporary, 300, 64),
+                                                 MemoryInfo(ACL_INT_VEC + 1, MemoryLifetime::Persistent, 64, 64)});
+    arena.allocate();
+
+    ARM_COMPUTE_EXPECT(arena.persistent_size() == 320, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arena.size() == 620, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arena.unshared_size() == 714, framework::LogLevel::ERRORS);
+
+    ITensorPack run_pack0, prep_pack0, run_pack1, prep_pack1;
+    arena.add_workspace(id0, run_pack0, prep_pack0);
+    arena.add_workspace(id1, run_pack1, prep_pack1);
+
+    ARM_COMPUTE_EXPECT(run_pack0.size() == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(prep_pack0.size() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_pack1.size() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(prep_pack1.size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(prep_pack0.get_tensor(ACL_INT_VEC) == nullptr, framework::LogLevel::ERRORS);
+
+    const uint8_t *persistent0 = run_pack0.get_tensor(ACL_INT_VEC + 1)->buffer();
+    const uint8_t *persistent1 = run_pack1.get_tensor(ACL_INT_VEC + 1)->buffer();
+    const uint8_t *temporary0  = run_pack0.get_tensor(ACL_INT_VEC)->buffer();
+    const uint8_t *prepare0    = run_pack0.get_tensor(ACL_INT_VEC + 2)->buffer();
+    const uint8_t *temporary1  = run_pack1.get_tensor(ACL_INT_VEC)->buffer();
+
+    ARM_COMPUTE_EXPECT(persistent1 - persistent0 == 256, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(temporary0 - persistent0 == 320, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(temporary0 == temporary1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(prepare0 - temporary0 == 128, framework::LogLevel::ERRORS);
+}
+
+/** Test case for a sequence of @ref arm_compute::experimental::op::CpuGemm sharing a @ref WorkspaceArena
+ *
+ * Checks performed in order:
+ * - The output is the same as when each operator allocates its own workspace
+ */
+TEST_CASE(GemmSequence, framework::DatasetMode::ALL)
+{
+    const auto a_info  = TensorInfo(TensorShape(64U, 48U), 1, DataType::F32);
+    const auto b0_info = TensorInfo(TensorShape(96U, 64U), 1, DataType::F32);
+    const auto b1_info = TensorInfo(TensorShape(32U, 96U), 1, DataType::F32);
+    auto       c_info  = TensorInfo(TensorShape(96U, 48U), 1, DataType::F32);
+    auto       d_info  = TensorInfo(TensorShape(32U, 48U), 1, DataType::F32);
+
+    auto a  = create_tensor<Tensor>(a_info);
+    auto b0 = create_tensor<Tensor>(b0_info);
+    auto b1 = create_tensor<Tensor>(b1_info);
+    a.allocator()->allocate();
+    b0.allocator()->allocate();
+    b1.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(a), 0);
+    library->fill_tensor_uniform(Accessor(b0), 1);
+    library->fill_tensor_uniform(Accessor(b1), 2);
+
+    auto run_gemms = [&](bool use_arena) -> Tensor
+    {
+        arm_compute::experimental::op::CpuGemm gemm0;
+        arm_compute::experimental::op::CpuGemm gemm1;
+        gemm0.configure(&a_info, &b0_info, nullptr, &c_info, 1.f, 0.f);
+        gemm1.configure(&c_info, &b1_info, nullptr, &d_info, 1.f, 0.f);
+
+        auto c = create_tensor<Tensor>(c_info);
+        auto d = create_tensor<Tensor>(d_info);
+        c.allocator()->allocate();
+        d.allocator()->allocate();
+
+        ITensorPack run_pack0{{ACL_SRC_0, &a}, {ACL_SRC_1, &b0}, {ACL_DST, &c}};
+        ITensorPack prep_pack0{{ACL_SRC_1, &b0}};
+        ITensorPack run_pack1{{ACL_SRC_0, &c}, {ACL_SRC_1, &b1}, {ACL_DST, &d}};
+        ITensorPack prep_pack1{{ACL_SRC_1, &b1}};
+
+        WorkspaceArena        arena;
+        MemoryGroup           mg0, mg1;
+        WorkspaceData<Tensor> ws0, ws1;
+        if (use_arena)
+        {
+            const unsigned int id0 = arena.add_operator(gemm0.workspace());
+            const unsigned int id1 = arena.add_operator(gemm1.workspace());
+            arena.allocate();
+            arena.add_workspace(id0, run_pack0, prep_pack0);
+            arena.add_workspace(id1, run_pack1, prep_pack1);
+        }
+        else
+        {
+            ws0 = manage_workspace<Tensor>(gemm0.workspace(), mg0, run_pack0, prep_pack0);
+            ws1 = manage_workspace<Tensor>(gemm1.workspace(), mg1, run_pack1, prep_pack1);
+        }
+
+        gemm0.prepare(prep_pack0);
+        gemm1.prepare(prep_pack1);
+        {
+            MemoryGroupResourceScope scope_mg0(mg0);
+            gemm0.run(run_pack0);
+        }
+        {
+            MemoryGroupResourceScope scope_mg1(mg1);
+            gemm1.run(run_pack1);
+        }
+        return d;
+    };
+
+    auto reference = run_gemms(false);
+    auto result    = run_gemms(true);
+    for (size_t i = 0; i < reference.info()->tensor_shape().total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(reinterpret_cast<float *>(reference.buffer())[i] ==
+                               reinterpret_cast<float *>(result.buffer())[i],
+                           framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // WorkspaceArena
+TEST_SUITE_END() // OPERATORS
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
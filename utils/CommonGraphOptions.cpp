@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,6 +80,7 @@ namespace utils
     std::string true_str  = std::string("true");
 
     os << "Threads : " << common_params.threads << std::endl;
+    os << "Concurrent branches : " << common_params.branches << std::endl;
     os << "Target : " << common_params.target << std::endl;
     os << "Data type : " << common_params.data_type << std::endl;
     os << "Data layout : " << common_params.data_layout << std::endl;
@@ -90,6 +91,8 @@ namespace utils
     os << "MLGO file : " << common_params.mlgo_file << std::endl;
     os << "Fast math enabled? : " << (common_params.fast_math_hint == FastMathHint::Enabled ? true_str : false_str)
        << std::endl;
+    os << "Memory footprint report? : " << (common_params.memory_footprint ? true_str : false_str) << std::endl;
+    os << "Interval memory planner? : " << (common_params.memory_planner ? true_str : false_str) << std::endl;
     if (!common_params.data_path.empty())
     {
         os << "Data path : " << common_params.data_path << std::endl;
@@ -119,6 +122,7 @@ namespace utils
 CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     : help(parser.add_option<ToggleOption>("help")),
       threads(parser.add_option<SimpleOption<int>>("threads", 1)),
+      branches(parser.add_option<SimpleOption<unsigned int>>("branches", 1)),
       batches(parser.add_option<SimpleOption<int>>("batches", 1)),
       target(),
       data_type(),
@@ -134,7 +138,9 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
       validation_path(parser.add_option<SimpleOption<std::string>>("validation-path")),
       validation_range(parser.add_option<SimpleOption<std::string>>("validation-range")),
       tuner_file(parser.add_option<SimpleOption<std::string>>("tuner-file")),
-      mlgo_file(parser.add_option<SimpleOption<std::string>>("mlgo-file"))
+      mlgo_file(parser.add_option<SimpleOption<std::string>>("mlgo-file")),
+      memory_footprint(parser.add_option<ToggleOption>("memory-footprint")),
+      memory_planner(parser.add_option<ToggleOption>("memory-planner"))
 {
     std::set<arm_compute::graph::Target> supported_targets{
         Target::NEON,
@@ -163,6 +169,7 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
 
     help->set_help("Show this help message");
     threads->set_help("Number of threads to use");
+    branches->set_help("Maximum number of independent branches to execute concurrently");
     batches->set_help("Number of batches to use for the inputs");
     target->set_help("Target to execute on");
     data_type->set_help("Data type to use");
@@ -182,6 +189,9 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     validation_range->set_help("Range of the images to validate for (Format : start,end)");
     tuner_file->set_help("File to load/save CLTuner values");
     mlgo_file->set_help("File to load MLGO heuristics");
+    memory_footprint->set_help("Print the memory held by each node of the graph and in total once it is finalized");
+    memory_planner->set_help("Plan the memory of the graph from the lifetime intervals of its tensors (CPU) and print "
+                             "the memory saved compared to the offset and blob memory managers");
 }
 
 CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
@@ -193,6 +203,7 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     CommonGraphParams common_params;
     common_params.help      = options.help->is_set() ? options.help->value() : false;
     common_params.threads   = options.threads->value();
+    common_params.branches  = options.branches->value();
     common_params.batches   = options.batches->value();
     common_params.target    = options.target->value();
     common_params.data_type = options.data_type->value();
@@ -215,6 +226,9 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     common_params.validation_range_end   = validation_range.second;
     common_params.tuner_file             = options.tuner_file->value();
     common_params.mlgo_file              = options.mlgo_file->value();
+    common_params.memory_footprint =
+        options.memory_footprint->is_set() ? options.memory_footprint->value() : false;
+    common_params.memory_planner = options.memory_planner->is_set() ? options.memory_planner->value() : false;
 
     return common_params;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,7 @@ namespace utils
  *
  * --help             : Print the example's help message.
  * --threads          : The number of threads to be used by the example during execution.
+ * --branches         : The maximum number of independent graph branches to execute concurrently (Neon only).
  * --target           : Execution target to be used by the examples. Supported target options: Neon, CL, CLVK.
  * --type             : Data type to be used by the examples. Supported data type options: QASYMM8, F16, F32.
  * --layout           : Data layout to be used by the examples. Supported data layout options : NCHW, NHWC.
@@ -59,6 +60,8 @@ namespace utils
  *                      * Exhaustive: slowest but produces the most performant LWS configuration.
  *                      * Normal: slow but produces the LWS configurations on par with Exhaustive most of the time.
  *                      * Rapid: fast but produces less performant LWS configurations
+ * --memory-planner   : Toggle option to plan the memory from the lifetime intervals of the tensors (Neon only) and
+ *                      print the memory saved compared to the offset and blob memory managers.
  *
  * Note that data, image and labels options should be provided to perform an inference run on an image.
  * Note that validation-file and validation-path should be provided to perform a graph accuracy estimation.
@@ -94,12 +97,15 @@ struct CommonGraphParams
 {
     bool                             help{false};
     int                              threads{0};
+    unsigned int                     branches{1};
     int                              batches{1};
     arm_compute::graph::Target       target{arm_compute::graph::Target::NEON};
     arm_compute::DataType            data_type{DataType::F32};
     arm_compute::DataLayout          data_layout{DataLayout::NHWC};
     bool                             enable_tuner{false};
     bool                             enable_cl_cache{false};
+    bool                             memory_footprint{false};
+    bool                             memory_planner{false};
     arm_compute::CLTunerMode         tuner_mode{CLTunerMode::NORMAL};
     arm_compute::graph::FastMathHint fast_math_hint{arm_compute::graph::FastMathHint::Disabled};
     std::string                      data_path{};
@@ -152,6 +158,7 @@ public:
 
     ToggleOption                           *help;             /**< Show help option */
     SimpleOption<int>                      *threads;          /**< Number of threads option */
+    SimpleOption<unsigned int>             *branches;         /**< Number of concurrent branches option */
     SimpleOption<int>                      *batches;          /**< Number of batches */
     EnumOption<arm_compute::graph::Target> *target;           /**< Graph execution target */
     EnumOption<arm_compute::DataType>      *data_type;        /**< Graph data type */
@@ -168,6 +175,8 @@ public:
     SimpleOption<std::string>              *validation_range; /**< Validation range */
     SimpleOption<std::string>              *tuner_file;       /**< File to load/store the tuner's values from */
     SimpleOption<std::string>              *mlgo_file;        /**< File to load the MLGO heuristics from */
+    ToggleOption                           *memory_footprint; /**< Print the memory footprint of the graph */
+    ToggleOption                           *memory_planner;   /**< Use the interval memory planner and report it */
 };
 
 /** Consumes the common graph options and creates a structure containing any information
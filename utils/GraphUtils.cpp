@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,9 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/MemoryFootprint.h"
+#include "arm_compute/graph/TypePrinter.h"
+#include "arm_compute/runtime/IntervalLifetimeManager.h"
 #include "arm_compute/runtime/SubTensor.h"
 
 #pragma GCC diagnostic push
@@ -39,6 +42,13 @@
 #include <iomanip>
 #include <limits>
 
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
 using namespace arm_compute::graph_utils;
 
 namespace
@@ -783,13 +793,70 @@ bool RandomAccessor::access_tensor(ITensor &tensor)
 }
 
 NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout)
-    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout)
+    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout), _mapped_data(nullptr)
 {
 }
 
+void *NumPyBinLoader::memory_to_import(const ITensorInfo &info)
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    size_t data_offset = 0;
+    {
+        utils::NPYLoader loader;
+        loader.open(_filename, _file_layout);
+        if (!loader.has_tensor_memory_layout(info))
+        {
+            return nullptr;
+        }
+        data_offset = loader.data_offset();
+    }
+
+    // Vector loads of the kernels expect at least 16-byte aligned data
+    constexpr size_t data_alignment = 16;
+    const int        fd             = ::open(_filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0 || data_offset % data_alignment != 0)
+    {
+        if (fd >= 0)
+        {
+            ::close(fd);
+        }
+        return nullptr;
+    }
+
+    struct stat st; // NOLINT
+    void       *base = MAP_FAILED;
+    if (::fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= data_offset + info.total_size())
+    {
+        // Private mapping: functions updating the weights in-place only get a copy of the pages they write to
+        base = ::mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (base == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    const size_t             map_size = st.st_size;
+    std::shared_ptr<uint8_t> mapping(static_cast<uint8_t *>(base),
+                                     [map_size](uint8_t *ptr) { ::munmap(ptr, map_size); });
+    _mapped_data = std::shared_ptr<uint8_t>(mapping, mapping.get() + data_offset);
+    return _mapped_data.get();
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
+    ARM_COMPUTE_UNUSED(info);
+    return nullptr;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+}
+
 bool NumPyBinLoader::access_tensor(ITensor &tensor)
 {
-    if (!_already_loaded)
+    // Nothing to load if the tensor uses the mapped file as memory, else the mapping isn't needed anymore
+    const bool is_mapped = _mapped_data != nullptr && tensor.buffer() == _mapped_data.get();
+    if (!is_mapped)
+    {
+        _mapped_data = nullptr;
+    }
+
+    if (!_already_loaded && !is_mapped)
     {
         utils::NPYLoader loader;
         loader.open(_filename, _file_layout);
@@ -799,3 +866,60 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     _already_loaded = !_already_loaded;
     return _already_loaded;
 }
+
+void arm_compute::graph_utils::print_memory_planner_report(std::ostream &os, graph::GraphContext &ctx)
+{
+    auto print_footprint = [&os](const std::string &name, const std::shared_ptr<IMemoryManager> &mm)
+    {
+        auto *planner =
+            mm != nullptr ? dynamic_cast<IntervalLifetimeManager *>(mm->lifetime_manager()) : nullptr;
+        if (planner == nullptr)
+        {
+            return;
+        }
+        const IntervalLifetimeManager::Footprint &footprint = planner->footprint();
+        auto saved = [&footprint](size_t reference)
+        { return static_cast<int64_t>(reference) - static_cast<int64_t>(footprint.planned); };
+
+        os << name << " memory : " << footprint.planned << " bytes (peak live: " << footprint.peak_live
+           << " bytes, offset manager: " << footprint.offset << " bytes, saved " << saved(footprint.offset)
+           << ", blob manager: " << footprint.blob << " bytes, saved " << saved(footprint.blob) << ")" << std::endl;
+    };
+
+    for (auto &mm_ctx : ctx.memory_managers())
+    {
+        print_footprint("Transition", mm_ctx.second.cross_mm);
+        print_footprint("Function", mm_ctx.second.intra_mm);
+    }
+}
+
+void arm_compute::graph_utils::print_memory_footprint(std::ostream        &os,
+                                                      const graph::Graph  &g,
+                                                      graph::GraphContext &ctx)
+{
+    const graph::GraphMemoryFootprint footprint = graph::memory_footprint(g, ctx);
+
+    auto print_row = [&os](const std::string &id, const graph::MemoryFootprint &f, const std::string &name)
+    {
+        os << std::setw(6) << id << std::setw(14) << f.activations << std::setw(14) << f.workspace << std::setw(14)
+           << f.weights << std::setw(14) << f.transformed_weights << std::setw(12) << f.padding << std::setw(14)
+           << f.total() << "  " << name << std::endl;
+    };
+
+    os << "Memory footprint (bytes):" << std::endl;
+    os << std::setw(6) << "Node" << std::setw(14) << "Activations" << std::setw(14) << "Workspace" << std::setw(14)
+       << "Weights" << std::setw(14) << "Transformed" << std::setw(12) << "Padding" << std::setw(14) << "Total"
+       << "  Name (Type)" << std::endl;
+    for (const auto &node : footprint.nodes)
+    {
+        if (node.footprint.total() != 0)
+        {
+            std::stringstream name;
+            name << node.name << " (" << node.type << ")";
+            print_row(std::to_string(node.id), node.footprint, name.str());
+        }
+    }
+    print_row("Total", footprint.total, "");
+    os << "Transition memory manager pools : " << footprint.transition_pools << " bytes" << std::endl;
+    os << "Function memory manager pools : " << footprint.function_pools << " bytes" << std::endl;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/Utility.h"
 #include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/ITensorAccessor.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/runtime/Tensor.h"
@@ -35,6 +36,7 @@
 #include "utils/CommonGraphOptions.h"
 
 #include <array>
+#include <ostream>
 #include <random>
 #include <string>
 #include <vector>
@@ -449,11 +451,22 @@ public:
 
     // Inherited methods overriden:
     bool access_tensor(ITensor &tensor) override;
+    /** Memory-map the file, if its data is stored like in the memory of the tensor
+     *
+     * The file is mapped copy-on-write, so the weights are shared between the processes loading the same file and
+     * are read from the disk when they are first used.
+     *
+     * @param[in] info Metadata of the tensor
+     *
+     * @return The data of the mapped file, nullptr if the tensor must be allocated and filled from the file instead
+     */
+    void *memory_to_import(const ITensorInfo &info) override;
 
 private:
-    bool              _already_loaded;
-    const std::string _filename;
-    const DataLayout  _file_layout;
+    bool                     _already_loaded;
+    const std::string        _filename;
+    const DataLayout         _file_layout;
+    std::shared_ptr<uint8_t> _mapped_data;
 };
 
 /** Generates appropriate random accessor
@@ -700,6 +713,24 @@ inline graph::Target set_target_hint(int target)
         return graph::Target::NEON;
     }
 }
+
+/** Print the memory planned by the interval-aware lifetime managers of a finalized graph
+ *
+ * The planned sizes are compared with the ones the offset and blob lifetime managers would need for the same
+ * tensor lifetimes. Nothing is printed if the graph doesn't use interval-aware lifetime managers.
+ *
+ * @param[out] os  Output stream to print to
+ * @param[in]  ctx Context of the finalized graph
+ */
+void print_memory_planner_report(std::ostream &os, graph::GraphContext &ctx);
+
+/** Print the memory held by each node of a finalized graph and in total, by category
+ *
+ * @param[out] os  Output stream to print to
+ * @param[in]  g   Finalized graph
+ * @param[in]  ctx Context of the finalized graph
+ */
+void print_memory_footprint(std::ostream &os, const graph::Graph &g, graph::GraphContext &ctx);
 } // namespace graph_utils
 } // namespace arm_compute
 
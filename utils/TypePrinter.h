@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1394,6 +1394,76 @@ inline ::std::ostream &operator<<(::std::ostream &os, const GEMMReshapeInfo &inf
     return os;
 }
 
+/** Formatted output of the Int4WeightsInfo type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  info Type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const Int4WeightsInfo &info)
+{
+    os << "{group_size=" << info.group_size << ",";
+    os << "scale_data_type=" << info.scale_data_type << ",";
+    os << "has_zero_points=" << info.has_zero_points;
+    os << "}";
+
+    return os;
+}
+
+/** Formatted output of the Int4WeightsInfo type.
+ *
+ * @param[in] info Type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const Int4WeightsInfo &info)
+{
+    std::stringstream str;
+    str << info;
+    return str.str();
+}
+
+/** Formatted output of the WeightsSparsity type.
+ *
+ * @param[out] os       Output stream.
+ * @param[in]  sparsity Type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const WeightsSparsity &sparsity)
+{
+    switch (sparsity)
+    {
+        case WeightsSparsity::DENSE:
+            os << "DENSE";
+            break;
+        case WeightsSparsity::STRUCTURED_2_4:
+            os << "STRUCTURED_2_4";
+            break;
+        case WeightsSparsity::BLOCK_4X4:
+            os << "BLOCK_4X4";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+
+    return os;
+}
+
+/** Formatted output of the WeightsSparsity type.
+ *
+ * @param[in] sparsity Type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const WeightsSparsity &sparsity)
+{
+    std::stringstream str;
+    str << sparsity;
+    return str.str();
+}
+
 /** Formatted output of the GEMMInfo type.
  *
  * @param[out] os   Output stream.
@@ -1412,6 +1482,8 @@ inline ::std::ostream &operator<<(::std::ostream &os, const GEMMInfo &info)
     os << "fp_mixed_precision=" << info.fp_mixed_precision() << ",";
     os << "broadcast_bias=" << info.broadcast_bias() << ",";
     os << "pretranspose_B=" << info.pretranspose_B() << ",";
+    os << "int4_group_size=" << info.int4_weights_info().group_size << ",";
+    os << "weights_sparsity=" << info.weights_sparsity() << ",";
     os << "}";
 
     return os;
@@ -2616,7 +2688,8 @@ inline ::std::ostream &operator<<(::std::ostream &os, const FullyConnectedLayerI
        << "transpose_weights=" << layer_info.transpose_weights << ", "
        << "are_weights_reshaped=" << layer_info.are_weights_reshaped << ", "
        << "retain_internal_weights=" << layer_info.retain_internal_weights << ", "
-       << "fp_mixed_precision=" << layer_info.fp_mixed_precision << "}";
+       << "fp_mixed_precision=" << layer_info.fp_mixed_precision << ", "
+       << "int4_group_size=" << layer_info.int4_weights_info.group_size << "}";
     return os;
 }
 
@@ -3353,7 +3426,8 @@ inline ::std::ostream &operator<<(::std::ostream &os, const arm_compute::CpuMatM
 {
     os << "CpuMatMulSettings="
        << "["
-       << "fast_math=" << settings.fast_math() << ",fixed_format=" << settings.fixed_format() << "]";
+       << "fast_math=" << settings.fast_math() << ",fixed_format=" << settings.fixed_format()
+       << ",int4_group_size=" << settings.int4_weights_info().group_size << "]";
 
     return os;
 }
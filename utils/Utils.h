@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024 Arm Limited.
+ * Copyright (c) 2016-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -343,6 +343,63 @@ public:
         return _fortran_order;
     }
 
+    /** Return the offset in bytes of the data in the NPY file currently open */
+    size_t data_offset()
+    {
+        ARM_COMPUTE_ERROR_ON(!is_open());
+        return static_cast<size_t>(_fs.tellg());
+    }
+
+    /** Return true if the data of the NPY file currently open is stored like in the memory of a tensor
+     *
+     * In that case the data can be read to, or used as, the memory of the tensor as is.
+     *
+     * @param[in] info Metadata of the tensor
+     */
+    bool has_tensor_memory_layout(const ITensorInfo &info)
+    {
+        ARM_COMPUTE_ERROR_ON(!is_open());
+        if (_fortran_order || _typestring != get_typestring(info.data_type()) ||
+            info.offset_first_element_in_bytes() != 0)
+        {
+            return false;
+        }
+
+        // The data of the file is permuted when the layouts differ, unless the tensor has at most 2 dimensions
+        const TensorShape &shape = info.tensor_shape();
+        if (_file_layout != info.data_layout() && shape.num_dimensions() > 2)
+        {
+            return false;
+        }
+
+        // Trailing dimensions of size 1 are not part of the tensor shape
+        if (_shape.size() > TensorShape::num_max_dimensions)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < TensorShape::num_max_dimensions; ++i)
+        {
+            const size_t file_dimension = i < _shape.size() ? _shape[i] : 1;
+            if (file_dimension != shape[i])
+            {
+                return false;
+            }
+        }
+
+        // The elements of the file are contiguous: so must be the ones of the tensor
+        const Strides &strides      = info.strides_in_bytes();
+        size_t         dense_stride = info.element_size();
+        for (size_t i = 0; i < shape.num_dimensions(); ++i)
+        {
+            if (shape[i] > 1 && strides[i] != dense_stride)
+            {
+                return false;
+            }
+            dense_stride *= shape[i];
+        }
+        return true;
+    }
+
     /** Initialise the tensor's metadata with the dimensions of the NPY file currently open
      *
      * @param[out] tensor Tensor to initialise